@@ -0,0 +1,318 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "ContentChunker.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include "MappedFile.hpp"
+#include "ReadAheadReader.hpp"
+#include "sha256/Hasher.hpp"
+
+namespace libstriezel::hash
+{
+
+/* table of the gear hash, filled with the output of SplitMix64 */
+struct GearTable
+{
+  uint64_t values[256];
+};
+
+constexpr GearTable generateGearTable()
+{
+  GearTable table = { };
+  uint64_t state = 0x6C69627374726965ULL;
+  for (unsigned int i = 0; i < 256; ++i)
+  {
+    state += 0x9E3779B97F4A7C15ULL;
+    uint64_t z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    table.values[i] = z ^ (z >> 31);
+  }
+  return table;
+}
+
+inline constexpr GearTable gear = generateGearTable();
+
+/* returns a mask of the given number of upper bits */
+inline uint64_t upperBits(const unsigned int bits)
+{
+  return ~static_cast<uint64_t>(0) << (64 - bits);
+}
+
+/* returns the binary logarithm of a power of two */
+inline unsigned int binaryLogarithm(std::size_t value)
+{
+  unsigned int result = 0;
+  while (value > 1)
+  {
+    value >>= 1;
+    ++result;
+  }
+  return result;
+}
+
+ChunkParameters::ChunkParameters(const std::size_t minimum, const std::size_t average, const std::size_t maximum)
+: minSize(minimum), averageSize(average), maxSize(maximum)
+{
+}
+
+bool ChunkParameters::isValid() const
+{
+  return (minSize >= 64) && (minSize <= averageSize) && (averageSize <= maxSize)
+      && ((averageSize & (averageSize - 1)) == 0) && (averageSize <= (1u << 30));
+}
+
+std::size_t findChunkEnd(const uint8_t* data, const std::size_t length, const ChunkParameters& params)
+{
+  if (length <= params.minSize)
+    return length;
+  // Normalization level two: two bits more before the average size, two
+  // bits less after it.
+  const unsigned int bits = binaryLogarithm(params.averageSize);
+  const uint64_t maskSmall = upperBits(bits + 2);
+  const uint64_t maskLarge = upperBits(bits - 2);
+  const std::size_t end = std::min(length, params.maxSize);
+  const std::size_t normal = std::min(params.averageSize, end);
+  uint64_t fingerprint = 0;
+  std::size_t i = params.minSize;
+  for ( ; i < normal; ++i)
+  {
+    fingerprint = (fingerprint << 1) + gear.values[data[i]];
+    if ((fingerprint & maskSmall) == 0)
+      return i + 1;
+  }
+  for ( ; i < end; ++i)
+  {
+    fingerprint = (fingerprint << 1) + gear.values[data[i]];
+    if ((fingerprint & maskLarge) == 0)
+      return i + 1;
+  }
+  return end;
+}
+
+/* Hashes chunks in worker threads while the producer continues to find
+   boundaries. Without workers, the chunks are hashed by the producer. */
+class ChunkPipeline
+{
+  public:
+    ChunkPipeline(const unsigned int workers)
+    : m_Chunks(), m_Tasks(), m_MaxTasks(4 * std::max(workers, 1u)), m_Done(false),
+      m_Mutex(), m_TaskAvailable(), m_SpaceAvailable(), m_Workers()
+    {
+      for (unsigned int i = 0; i < workers; ++i)
+      {
+        m_Workers.emplace_back(&ChunkPipeline::work, this);
+      }
+    }
+
+    ~ChunkPipeline()
+    {
+      stop();
+    }
+
+    ChunkPipeline(const ChunkPipeline& other) = delete;
+    ChunkPipeline& operator=(const ChunkPipeline& other) = delete;
+
+    /* adds a chunk whose data stays valid until finish() returns */
+    void add(const uint64_t offset, const uint8_t* data, const std::size_t length)
+    {
+      push(Task{ newChunk(offset, length), data, std::vector<uint8_t>() });
+    }
+
+    /* adds a chunk that owns its data */
+    void add(const uint64_t offset, std::vector<uint8_t>&& data)
+    {
+      Chunk* chunk = newChunk(offset, data.size());
+      const uint8_t* ptr = data.data();
+      push(Task{ chunk, ptr, std::move(data) });
+    }
+
+    /* waits until all chunks are hashed and returns them */
+    std::vector<Chunk> finish()
+    {
+      stop();
+      return std::vector<Chunk>(m_Chunks.begin(), m_Chunks.end());
+    }
+  private:
+    struct Task
+    {
+      Chunk* chunk;                 /* chunk that receives the digest */
+      const uint8_t* data;          /* start of the chunk's data */
+      std::vector<uint8_t> storage; /* data, if the task owns it */
+    };
+
+    /* appends a chunk, references to the elements of a deque stay valid */
+    Chunk* newChunk(const uint64_t offset, const std::size_t length)
+    {
+      m_Chunks.push_back(Chunk{ offset, length, SHA256::MessageDigest() });
+      return &m_Chunks.back();
+    }
+
+    static void hash(const Task& task)
+    {
+      SHA256::Hasher hasher;
+      hasher.update(task.data, task.chunk->length);
+      task.chunk->digest = hasher.finalize();
+    }
+
+    void push(Task&& task)
+    {
+      if (m_Workers.empty())
+      {
+        hash(task);
+        return;
+      }
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_SpaceAvailable.wait(lock, [this]() { return m_Tasks.size() < m_MaxTasks; });
+        m_Tasks.push_back(std::move(task));
+      }
+      m_TaskAvailable.notify_one();
+    }
+
+    void work()
+    {
+      while (true)
+      {
+        Task task{ nullptr, nullptr, std::vector<uint8_t>() };
+        {
+          std::unique_lock<std::mutex> lock(m_Mutex);
+          m_TaskAvailable.wait(lock, [this]() { return m_Done || !m_Tasks.empty(); });
+          if (m_Tasks.empty())
+            return;
+          task = std::move(m_Tasks.front());
+          m_Tasks.pop_front();
+        }
+        m_SpaceAvailable.notify_one();
+        hash(task);
+      }
+    }
+
+    /* lets the workers finish the remaining tasks and joins them */
+    void stop()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Done = true;
+      }
+      m_TaskAvailable.notify_all();
+      for (std::thread& worker : m_Workers)
+      {
+        worker.join();
+      }
+      m_Workers.clear();
+    }
+
+    std::deque<Chunk> m_Chunks;
+    std::deque<Task> m_Tasks;
+    std::size_t m_MaxTasks;
+    bool m_Done;
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskAvailable;
+    std::condition_variable m_SpaceAvailable;
+    std::vector<std::thread> m_Workers;
+}; //class
+
+/* determines the number of hashing threads besides the calling thread */
+unsigned int workerCount(const unsigned int maxThreads)
+{
+  const unsigned int threads = (maxThreads != 0) ? maxThreads : std::thread::hardware_concurrency();
+  return (threads > 1) ? threads - 1 : 0;
+}
+
+bool chunkBuffer(const void* data, const std::size_t length, std::vector<Chunk>& chunks,
+                 const ChunkParameters& params, const unsigned int maxThreads)
+{
+  if (!params.isValid())
+    return false;
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  // Small buffers have too few chunks to keep other threads busy.
+  ChunkPipeline pipeline((length >= 4 * params.maxSize) ? workerCount(maxThreads) : 0);
+  std::size_t offset = 0;
+  while (offset < length)
+  {
+    const std::size_t chunkLength = findChunkEnd(bytes + offset, length - offset, params);
+    pipeline.add(offset, bytes + offset, chunkLength);
+    offset += chunkLength;
+  }
+  chunks = pipeline.finish();
+  return true;
+}
+
+bool chunkFile(const std::string& fileName, std::vector<Chunk>& chunks,
+               const ChunkParameters& params, const unsigned int maxThreads)
+{
+  if (!params.isValid())
+    return false;
+  MappedFile mapped;
+  if (mapped.open(fileName))
+  {
+    return chunkBuffer(mapped.data(), mapped.size(), chunks, params, maxThreads);
+  }
+
+  ReadAheadReader reader;
+  if (!reader.open(fileName))
+  {
+    std::cout << "Could not open file \""<<fileName<<"\" for chunking!\n";
+    return false;
+  }
+  ChunkPipeline pipeline(workerCount(maxThreads));
+  // The window holds the data that is not part of a chunk yet. A boundary
+  // is only searched once a whole chunk of maximum size is available.
+  std::vector<uint8_t> window;
+  uint64_t offset = 0;
+  const uint8_t* data = nullptr;
+  std::size_t length = 0;
+  while (reader.next(data, length))
+  {
+    window.insert(window.end(), data, data + length);
+    std::size_t start = 0;
+    while (window.size() - start >= params.maxSize)
+    {
+      const std::size_t chunkLength = findChunkEnd(window.data() + start, window.size() - start, params);
+      pipeline.add(offset, std::vector<uint8_t>(window.begin() + start, window.begin() + start + chunkLength));
+      start += chunkLength;
+      offset += chunkLength;
+    }
+    window.erase(window.begin(), window.begin() + start);
+  }
+  if (reader.failed())
+  {
+    std::cout << "Could not read file \""<<fileName<<"\"!\n";
+    return false;
+  }
+  std::size_t start = 0;
+  while (start < window.size())
+  {
+    const std::size_t chunkLength = findChunkEnd(window.data() + start, window.size() - start, params);
+    pipeline.add(offset, window.data() + start, chunkLength);
+    start += chunkLength;
+    offset += chunkLength;
+  }
+  chunks = pipeline.finish();
+  return true;
+}
+
+} //namespace
@@ -0,0 +1,132 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_CONTENTCHUNKER_HPP
+#define LIBSTRIEZEL_HASH_CONTENTCHUNKER_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "sha256/sha256.hpp"
+
+/* Content-defined chunking with the FastCDC algorithm
+
+   A gear hash rolls over the data, and a chunk ends where the upper bits of
+   the gear hash are all zero. Before the average chunk size is reached more
+   bits have to be zero than after it ("normalized chunking"), so that the
+   chunk sizes concentrate around the average. Because the boundaries only
+   depend on the nearby data, an insertion or deletion in a file changes
+   only the chunks around it, and all other chunks can be deduplicated.
+
+   The gear table and the masks are part of the format: the same data and
+   parameters always result in the same chunks.
+*/
+
+namespace libstriezel::hash
+{
+
+/// sizes of the chunks
+struct ChunkParameters
+{
+  std::size_t minSize;     /**< minimum size of a chunk in bytes */
+  std::size_t averageSize; /**< desired average size of a chunk in bytes,
+                                has to be a power of two */
+  std::size_t maxSize;     /**< maximum size of a chunk in bytes */
+
+  /** \brief constructor
+   *
+   * \param minimum  minimum size of a chunk in bytes
+   * \param average  desired average size of a chunk in bytes
+   * \param maximum  maximum size of a chunk in bytes
+   * \remarks The defaults of 2 KiB, 8 KiB and 64 KiB are those of the
+   *          FastCDC paper.
+   */
+  ChunkParameters(const std::size_t minimum = 2048, const std::size_t average = 8192, const std::size_t maximum = 65536);
+
+
+  /** \brief checks whether the parameters can be used for chunking
+   *
+   * \return Returns true, if 64 <= minSize <= averageSize <= maxSize, and
+   *         if averageSize is a power of two not above 2^30.
+   */
+  bool isValid() const;
+};
+
+
+/// a chunk of the data and its SHA-256 message digest
+struct Chunk
+{
+  uint64_t offset;               /**< offset of the chunk in bytes */
+  std::size_t length;            /**< length of the chunk in bytes */
+  SHA256::MessageDigest digest;  /**< message digest of the chunk's data */
+};
+
+
+/** \brief finds the end of the chunk that starts at the given data
+ *
+ * \param data    pointer to the start of the chunk
+ * \param length  number of bytes available, the end of the data is always
+ *                the end of a chunk
+ * \param params  the chunk parameters, have to be valid
+ * \return Returns the length of the chunk in bytes.
+ * \remarks If length is less than params.maxSize and more data follows, a
+ *          returned value of length is no real chunk boundary.
+ */
+std::size_t findChunkEnd(const uint8_t* data, const std::size_t length, const ChunkParameters& params);
+
+
+/** \brief splits a buffer into chunks and computes their message digests
+ *
+ * \param data        pointer to the data
+ * \param length      length of the data in bytes
+ * \param chunks      receives the chunks in the order of the data
+ * \param params      the chunk parameters
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns true, if the data was chunked.
+ *         Returns false, if the parameters are invalid.
+ * \remarks The calling thread finds the boundaries, while the other
+ *          threads hash the chunks that have been found so far. Empty data
+ *          results in no chunks at all.
+ */
+bool chunkBuffer(const void* data, const std::size_t length, std::vector<Chunk>& chunks,
+                 const ChunkParameters& params = ChunkParameters(), const unsigned int maxThreads = 0);
+
+
+/** \brief splits a file into chunks and computes their message digests
+ *
+ * \param fileName    name of the file
+ * \param chunks      receives the chunks in the order of the file data
+ * \param params      the chunk parameters
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns true, if the file was chunked.
+ *         Returns false, if the parameters are invalid or an error occurred.
+ * \remarks Regular files are memory-mapped and chunked like a buffer. Other
+ *          files are read by a separate thread, so reading, chunking and
+ *          hashing overlap.
+ */
+bool chunkFile(const std::string& fileName, std::vector<Chunk>& chunks,
+               const ChunkParameters& params = ChunkParameters(), const unsigned int maxThreads = 0);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_CONTENTCHUNKER_HPP
@@ -0,0 +1,330 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "DigestCache.hpp"
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include "MappedFile.hpp"
+#include "sha1/FileSourceUtility.hpp"
+#include "sha256/FileSourceUtility.hpp"
+#include "sha512/FileSourceUtility.hpp"
+#include "../filesystem/file.hpp"
+
+namespace libstriezel::hash
+{
+
+const char cacheMagic[4] = { 'L', 'S', 'D', 'C' };
+const uint32_t cacheVersion = 1;
+
+/* gets size and modification time of a file
+
+   parameters:
+       fileName - name of the file
+       size     - receives the file size
+       mtime    - receives the modification time
+*/
+bool getFileStatus(const std::string& fileName, int64_t& size, int64_t& mtime)
+{
+  time_t fileTime = -1;
+  if (!libstriezel::filesystem::file::getSizeAndModificationTime(fileName, size, fileTime))
+    return false;
+  mtime = static_cast<int64_t>(fileTime);
+  return true;
+}
+
+/* appends an unsigned integer in little endian byte order */
+template<typename T>
+void appendLittleEndian(std::string& buffer, const T value)
+{
+  for (unsigned int i = 0; i < sizeof(T); ++i)
+  {
+    buffer.push_back(static_cast<char>(static_cast<uint64_t>(value) >> (8 * i)));
+  }
+}
+
+/* reads an unsigned integer in little endian byte order and advances the
+   read position, returns false if there is not enough data */
+template<typename T>
+bool readLittleEndian(const uint8_t*& pos, const uint8_t* end, T& value)
+{
+  if (static_cast<std::size_t>(end - pos) < sizeof(T))
+    return false;
+  uint64_t result = 0;
+  for (unsigned int i = 0; i < sizeof(T); ++i)
+  {
+    result |= static_cast<uint64_t>(pos[i]) << (8 * i);
+  }
+  value = static_cast<T>(result);
+  pos += sizeof(T);
+  return true;
+}
+
+/* appends the words of a digest in big endian byte order */
+template<typename W, std::size_t N>
+void appendDigest(std::string& buffer, const W (&words)[N])
+{
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    for (unsigned int j = sizeof(W); j > 0; --j)
+    {
+      buffer.push_back(static_cast<char>(words[i] >> (8 * (j - 1))));
+    }
+  }
+}
+
+/* reads the words of a digest in big endian byte order and advances the
+   read position, returns false if there is not enough data */
+template<typename W, std::size_t N>
+bool readDigest(const uint8_t*& pos, const uint8_t* end, W (&words)[N])
+{
+  if (static_cast<std::size_t>(end - pos) < N * sizeof(W))
+    return false;
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    W word = 0;
+    for (unsigned int j = 0; j < sizeof(W); ++j)
+    {
+      word = static_cast<W>((word << 8) | *pos);
+      ++pos;
+    }
+    words[i] = word;
+  }
+  return true;
+}
+
+DigestCache::DigestCache()
+: m_Entries(), m_Mutex()
+{
+}
+
+template<typename D>
+bool DigestCache::get(const std::string& fileName, const DigestFlag flag, D Entry::* member, D& digest) const
+{
+  int64_t size = -1;
+  int64_t mtime = -1;
+  if (!getFileStatus(fileName, size, mtime))
+    return false;
+  std::shared_lock<std::shared_mutex> lock(m_Mutex);
+  const auto iter = m_Entries.find(fileName);
+  if ((iter == m_Entries.end()) || ((iter->second.flags & flag) == 0)
+      || (iter->second.size != size) || (iter->second.modificationTime != mtime))
+    return false;
+  digest = iter->second.*member;
+  return true;
+}
+
+template<typename D>
+D DigestCache::getOrCompute(const std::string& fileName, const DigestFlag flag, D Entry::* member, D (*compute)(const std::string&))
+{
+  D digest;
+  if (get(fileName, flag, member, digest))
+    return digest;
+
+  int64_t sizeBefore = -1;
+  int64_t mtimeBefore = -1;
+  if (!getFileStatus(fileName, sizeBefore, mtimeBefore))
+    return D();
+  digest = compute(fileName);
+  if (digest.isNull())
+    return digest;
+  int64_t sizeAfter = -1;
+  int64_t mtimeAfter = -1;
+  if (!getFileStatus(fileName, sizeAfter, mtimeAfter)
+      || (sizeAfter != sizeBefore) || (mtimeAfter != mtimeBefore))
+  {
+    // file was changed while it was hashed, do not cache the result
+    return digest;
+  }
+  // The modification time has a resolution of one second, so a change in
+  // the same second as the hashing would go unnoticed later.
+  if (mtimeAfter >= static_cast<int64_t>(std::time(nullptr)) - 1)
+    return digest;
+
+  std::unique_lock<std::shared_mutex> lock(m_Mutex);
+  Entry& entry = m_Entries[fileName];
+  if ((entry.size != sizeAfter) || (entry.modificationTime != mtimeAfter))
+  {
+    entry.size = sizeAfter;
+    entry.modificationTime = mtimeAfter;
+    entry.flags = 0;
+  }
+  entry.*member = digest;
+  entry.flags |= flag;
+  return digest;
+}
+
+SHA1::MessageDigest DigestCache::computeSHA1(const std::string& fileName)
+{
+  return getOrCompute(fileName, dfSHA1, &Entry::sha1, &SHA1::computeFromFile);
+}
+
+SHA256::MessageDigest DigestCache::computeSHA256(const std::string& fileName)
+{
+  return getOrCompute(fileName, dfSHA256, &Entry::sha256, &SHA256::computeFromFile);
+}
+
+SHA512::MessageDigest DigestCache::computeSHA512(const std::string& fileName)
+{
+  return getOrCompute(fileName, dfSHA512, &Entry::sha512, &SHA512::computeFromFile);
+}
+
+bool DigestCache::lookup(const std::string& fileName, SHA1::MessageDigest& digest) const
+{
+  return get(fileName, dfSHA1, &Entry::sha1, digest);
+}
+
+bool DigestCache::lookup(const std::string& fileName, SHA256::MessageDigest& digest) const
+{
+  return get(fileName, dfSHA256, &Entry::sha256, digest);
+}
+
+bool DigestCache::lookup(const std::string& fileName, SHA512::MessageDigest& digest) const
+{
+  return get(fileName, dfSHA512, &Entry::sha512, digest);
+}
+
+std::size_t DigestCache::size() const
+{
+  std::shared_lock<std::shared_mutex> lock(m_Mutex);
+  return m_Entries.size();
+}
+
+void DigestCache::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(m_Mutex);
+  m_Entries.clear();
+}
+
+std::size_t DigestCache::removeStaleEntries()
+{
+  std::unique_lock<std::shared_mutex> lock(m_Mutex);
+  std::size_t removed = 0;
+  for (auto iter = m_Entries.begin(); iter != m_Entries.end(); )
+  {
+    int64_t size = -1;
+    int64_t mtime = -1;
+    if (!getFileStatus(iter->first, size, mtime)
+        || (size != iter->second.size) || (mtime != iter->second.modificationTime))
+    {
+      iter = m_Entries.erase(iter);
+      ++removed;
+    }
+    else
+      ++iter;
+  } //for
+  return removed;
+}
+
+bool DigestCache::load(const std::string& cacheFileName)
+{
+  MappedFile mapped;
+  if (!mapped.open(cacheFileName))
+    return false;
+  const uint8_t* pos = mapped.data();
+  const uint8_t* const end = pos + mapped.size();
+  uint32_t version = 0;
+  uint64_t count = 0;
+  if ((mapped.size() < sizeof(cacheMagic)) || (memcmp(pos, cacheMagic, sizeof(cacheMagic)) != 0))
+    return false;
+  pos += sizeof(cacheMagic);
+  if (!readLittleEndian(pos, end, version) || (version != cacheVersion)
+      || !readLittleEndian(pos, end, count))
+    return false;
+
+  std::unordered_map<std::string, Entry> entries;
+  for (uint64_t i = 0; i < count; ++i)
+  {
+    uint32_t pathLength = 0;
+    if (!readLittleEndian(pos, end, pathLength) || (static_cast<std::size_t>(end - pos) < pathLength))
+      return false;
+    const std::string path(reinterpret_cast<const char*>(pos), pathLength);
+    pos += pathLength;
+    Entry entry;
+    uint64_t size = 0;
+    uint64_t mtime = 0;
+    if (!readLittleEndian(pos, end, size) || !readLittleEndian(pos, end, mtime)
+        || !readLittleEndian(pos, end, entry.flags))
+      return false;
+    entry.size = static_cast<int64_t>(size);
+    entry.modificationTime = static_cast<int64_t>(mtime);
+    if (((entry.flags & dfSHA1) != 0) && !readDigest(pos, end, entry.sha1.hash))
+      return false;
+    if (((entry.flags & dfSHA256) != 0) && !readDigest(pos, end, entry.sha256.hash))
+      return false;
+    if (((entry.flags & dfSHA512) != 0) && !readDigest(pos, end, entry.sha512.hash))
+      return false;
+    entries[path] = entry;
+  } //for
+  if (pos != end)
+    return false;
+
+  std::unique_lock<std::shared_mutex> lock(m_Mutex);
+  for (auto& item : entries)
+  {
+    m_Entries[item.first] = item.second;
+  }
+  return true;
+}
+
+bool DigestCache::save(const std::string& cacheFileName) const
+{
+  std::string buffer(cacheMagic, sizeof(cacheMagic));
+  {
+    std::shared_lock<std::shared_mutex> lock(m_Mutex);
+    appendLittleEndian(buffer, cacheVersion);
+    appendLittleEndian(buffer, static_cast<uint64_t>(m_Entries.size()));
+    for (const auto& item : m_Entries)
+    {
+      const Entry& entry = item.second;
+      appendLittleEndian(buffer, static_cast<uint32_t>(item.first.size()));
+      buffer.append(item.first);
+      appendLittleEndian(buffer, static_cast<uint64_t>(entry.size));
+      appendLittleEndian(buffer, static_cast<uint64_t>(entry.modificationTime));
+      appendLittleEndian(buffer, entry.flags);
+      if ((entry.flags & dfSHA1) != 0)
+        appendDigest(buffer, entry.sha1.hash);
+      if ((entry.flags & dfSHA256) != 0)
+        appendDigest(buffer, entry.sha256.hash);
+      if ((entry.flags & dfSHA512) != 0)
+        appendDigest(buffer, entry.sha512.hash);
+    } //for
+  }
+
+  const std::string tempFileName = cacheFileName + ".tmp";
+  std::ofstream stream(tempFileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!stream.good())
+    return false;
+  stream.write(buffer.data(), buffer.size());
+  stream.close();
+  if (!stream.good())
+  {
+    libstriezel::filesystem::file::remove(tempFileName);
+    return false;
+  }
+  if (!libstriezel::filesystem::file::rename(tempFileName, cacheFileName))
+  {
+    libstriezel::filesystem::file::remove(tempFileName);
+    return false;
+  }
+  return true;
+}
+
+} //namespace
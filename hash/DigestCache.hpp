@@ -0,0 +1,206 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_DIGESTCACHE_HPP
+#define LIBSTRIEZEL_HASH_DIGESTCACHE_HPP
+
+#include <ctime>
+#include <shared_mutex>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include "sha1/sha1.hpp"
+#include "sha256/sha256.hpp"
+#include "sha512/sha512.hpp"
+
+namespace libstriezel::hash
+{
+
+/** \brief cache for message digests of files
+ *
+ * Cached digests are only used while size and modification time of the
+ * file are unchanged. The cache can be used from several threads at once.
+ *
+ * The on-disk format is a binary file with all integers in little endian
+ * byte order:
+ *
+ *   "LSDC" (4 bytes), version (uint32, currently 1), entry count (uint64)
+ *   for each entry:
+ *     path length (uint32), path (UTF-8, not terminated),
+ *     file size (int64), modification time (int64), flags (uint8),
+ *     SHA-1 (20 bytes, if flag 1), SHA-256 (32 bytes, if flag 2),
+ *     SHA-512 (64 bytes, if flag 4)
+ *
+ * Digests are stored in their usual byte order, i.e. as in the hex string.
+ */
+class DigestCache
+{
+  public:
+    /** \brief constructor - creates an empty cache */
+    DigestCache();
+
+
+    /** \brief gets the SHA-1 digest of a file, from the cache if possible
+     *
+     * \param fileName  name of the file
+     * \return Returns the SHA-1 message digest on success.
+     *         Returns the "null" message digest, if an error occurred.
+     * \remarks If the file is not in the cache or was changed since it was
+     *          cached, its digest is computed and added to the cache.
+     */
+    SHA1::MessageDigest computeSHA1(const std::string& fileName);
+
+
+    /** \brief gets the SHA-256 digest of a file, from the cache if possible
+     *
+     * \param fileName  name of the file
+     * \return Returns the SHA-256 message digest on success.
+     *         Returns the "null" message digest, if an error occurred.
+     * \remarks If the file is not in the cache or was changed since it was
+     *          cached, its digest is computed and added to the cache.
+     */
+    SHA256::MessageDigest computeSHA256(const std::string& fileName);
+
+
+    /** \brief gets the SHA-512 digest of a file, from the cache if possible
+     *
+     * \param fileName  name of the file
+     * \return Returns the SHA-512 message digest on success.
+     *         Returns the "null" message digest, if an error occurred.
+     * \remarks If the file is not in the cache or was changed since it was
+     *          cached, its digest is computed and added to the cache.
+     */
+    SHA512::MessageDigest computeSHA512(const std::string& fileName);
+
+
+    /** \brief gets a cached SHA-1 digest without computing it
+     *
+     * \param fileName  name of the file
+     * \param digest    receives the cached digest
+     * \return Returns true, if a valid digest was found in the cache.
+     */
+    bool lookup(const std::string& fileName, SHA1::MessageDigest& digest) const;
+
+
+    /** \brief gets a cached SHA-256 digest without computing it
+     *
+     * \param fileName  name of the file
+     * \param digest    receives the cached digest
+     * \return Returns true, if a valid digest was found in the cache.
+     */
+    bool lookup(const std::string& fileName, SHA256::MessageDigest& digest) const;
+
+
+    /** \brief gets a cached SHA-512 digest without computing it
+     *
+     * \param fileName  name of the file
+     * \param digest    receives the cached digest
+     * \return Returns true, if a valid digest was found in the cache.
+     */
+    bool lookup(const std::string& fileName, SHA512::MessageDigest& digest) const;
+
+
+    /** \brief gets the number of files in the cache
+     *
+     * \return Returns the number of entries.
+     */
+    std::size_t size() const;
+
+
+    /** \brief removes all entries from the cache */
+    void clear();
+
+
+    /** \brief removes entries of files that were changed or deleted
+     *
+     * \return Returns the number of removed entries.
+     */
+    std::size_t removeStaleEntries();
+
+
+    /** \brief loads cache entries from a file
+     *
+     * \param cacheFileName  name of the cache file
+     * \return Returns true, if the file was loaded successfully.
+     *         Returns false, if the file could not be read or has an
+     *         invalid format. The cache is unchanged in that case.
+     * \remarks Entries of the file replace existing entries for the same
+     *          file name.
+     */
+    bool load(const std::string& cacheFileName);
+
+
+    /** \brief saves all cache entries to a file
+     *
+     * \param cacheFileName  name of the cache file
+     * \return Returns true, if the file was saved successfully.
+     * \remarks The data is written to a temporary file first, which then
+     *          replaces the cache file, so readers never see partial data.
+     */
+    bool save(const std::string& cacheFileName) const;
+  private:
+    /// flags for the digests that are present in an entry
+    enum DigestFlag : uint8_t
+    {
+      dfSHA1   = 1,
+      dfSHA256 = 2,
+      dfSHA512 = 4
+    };
+
+    /// cached data for a single file
+    struct Entry
+    {
+      int64_t size = -1;             /**< file size in bytes */
+      int64_t modificationTime = -1; /**< time of last modification */
+      uint8_t flags = 0;             /**< which digests are present */
+      SHA1::MessageDigest sha1;      /**< SHA-1 digest */
+      SHA256::MessageDigest sha256;  /**< SHA-256 digest */
+      SHA512::MessageDigest sha512;  /**< SHA-512 digest */
+    };
+
+    /** \brief gets a digest from the cache
+     *
+     * \param fileName  name of the file
+     * \param flag      flag of the requested digest
+     * \param member    pointer to the digest member of Entry
+     * \param digest    receives the cached digest
+     * \return Returns true, if a valid digest was found in the cache.
+     */
+    template<typename D>
+    bool get(const std::string& fileName, const DigestFlag flag, D Entry::* member, D& digest) const;
+
+    /** \brief gets a digest from the cache or computes it
+     *
+     * \param fileName  name of the file
+     * \param flag      flag of the requested digest
+     * \param member    pointer to the digest member of Entry
+     * \param compute   function that computes the digest of a file
+     * \return Returns the message digest.
+     */
+    template<typename D>
+    D getOrCompute(const std::string& fileName, const DigestFlag flag, D Entry::* member, D (*compute)(const std::string&));
+
+    std::unordered_map<std::string, Entry> m_Entries; /**< entries by file name */
+    mutable std::shared_mutex m_Mutex; /**< protects m_Entries */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_DIGESTCACHE_HPP
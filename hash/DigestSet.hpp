@@ -0,0 +1,581 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_DIGESTSET_HPP
+#define LIBSTRIEZEL_HASH_DIGESTSET_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "MappedFile.hpp"
+#include "../filesystem/file.hpp"
+
+namespace libstriezel::hash
+{
+
+/// slot of a DigestSet
+template<typename Digest>
+struct DigestSetSlot
+{
+  Digest digest; /**< the digest, the "null" digest marks an empty slot */
+};
+
+
+/// slot of a DigestMap
+template<typename Digest, typename Value>
+struct DigestMapSlot
+{
+  Digest digest; /**< the digest, the "null" digest marks an empty slot */
+  Value value;   /**< the value that belongs to the digest */
+};
+
+
+/** \brief open addressing hash table with message digests as keys
+ *
+ * The slots are stored in a single array and contain the digest itself, so
+ * a lookup usually touches only one or two cache lines. The first bits of
+ * the digest are used directly as hash value (see the std::hash
+ * specializations of the MessageDigest types), collisions are resolved by
+ * linear probing. Empty slots hold the "null" digest, the null digest
+ * itself is kept outside of the array.
+ *
+ * Tables can be saved to a file and loaded via a memory mapping, which
+ * takes constant time regardless of the size. A loaded table is read-only
+ * until it is modified for the first time, then it is copied into memory.
+ *
+ * The file format is the in-memory layout, so it depends on the byte order
+ * and the type of the slots:
+ *
+ *   magic "LSDT" (4 bytes), version (uint32, currently 1),
+ *   byte order mark (uint32, 0x01020304), slot size (uint32),
+ *   digest size (uint32), null digest present (uint32), number of entries
+ *   without the null digest (uint64), capacity (uint64), zero padding to
+ *   64 bytes, slot for the null digest padded to a multiple of 64 bytes,
+ *   capacity slots
+ */
+template<typename Digest, typename Slot>
+class DigestTable
+{
+  static_assert(std::is_trivially_copyable<Slot>::value, "Slots must be trivially copyable.");
+  public:
+    /** \brief constructor - creates an empty table */
+    DigestTable()
+    : m_Slots(), m_Mapping(), m_MappedSlots(nullptr), m_Capacity(0),
+      m_Count(0), m_HasNull(false), m_NullSlot()
+    {
+    }
+
+
+    DigestTable(const DigestTable& other) = delete;
+    DigestTable& operator=(const DigestTable& other) = delete;
+
+
+    /** \brief gets the number of digests in the table
+     *
+     * \return Returns the number of digests.
+     */
+    std::size_t size() const
+    {
+      return m_Count + (m_HasNull ? 1 : 0);
+    }
+
+
+    /** \brief checks whether the table is empty
+     *
+     * \return Returns true, if the table contains no digests.
+     */
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+
+    /** \brief gets the number of slots
+     *
+     * \return Returns the number of slots, always zero or a power of two.
+     */
+    std::size_t capacity() const
+    {
+      return m_Capacity;
+    }
+
+
+    /** \brief checks whether a digest is in the table
+     *
+     * \param digest  the digest
+     * \return Returns true, if the digest is in the table.
+     */
+    bool contains(const Digest& digest) const
+    {
+      return findSlot(digest) != nullptr;
+    }
+
+
+    /** \brief removes all digests and releases the memory */
+    void clear()
+    {
+      m_Slots.clear();
+      m_Slots.shrink_to_fit();
+      m_Mapping.close();
+      m_MappedSlots = nullptr;
+      m_Capacity = 0;
+      m_Count = 0;
+      m_HasNull = false;
+    }
+
+
+    /** \brief reserves space for the given number of digests
+     *
+     * \param count  expected number of digests
+     */
+    void reserve(const std::size_t count)
+    {
+      makeWritable();
+      std::size_t needed = minimumCapacity;
+      while (needed / 4 * 3 < count)
+      {
+        needed *= 2;
+      }
+      if (needed > m_Capacity)
+        rehash(needed);
+    }
+
+
+    /** \brief removes a digest from the table
+     *
+     * \param digest  the digest
+     * \return Returns true, if the digest was removed.
+     *         Returns false, if the digest was not in the table.
+     */
+    bool erase(const Digest& digest)
+    {
+      if (digest.isNull())
+      {
+        const bool had = m_HasNull;
+        m_HasNull = false;
+        return had;
+      }
+      if (findSlot(digest) == nullptr)
+        return false;
+      makeWritable();
+      const std::size_t mask = m_Capacity - 1;
+      std::size_t hole = homeIndex(digest);
+      while (!(m_Slots[hole].digest == digest))
+      {
+        hole = (hole + 1) & mask;
+      }
+      // Move following entries back into the hole, as long as this does
+      // not move them in front of their home slot. No tombstones needed.
+      std::size_t next = hole;
+      // The limit only matters for a corrupt table without an empty slot.
+      for (std::size_t probes = 1; probes < m_Capacity; ++probes)
+      {
+        next = (next + 1) & mask;
+        if (m_Slots[next].digest.isNull())
+          break;
+        const std::size_t home = homeIndex(m_Slots[next].digest);
+        const bool movable = (hole <= next) ? ((home <= hole) || (home > next))
+                                            : ((home <= hole) && (home > next));
+        if (movable)
+        {
+          m_Slots[hole] = m_Slots[next];
+          hole = next;
+        }
+      }
+      m_Slots[hole] = Slot();
+      --m_Count;
+      return true;
+    }
+
+
+    /** \brief calls a function for every slot that contains a digest
+     *
+     * \param function  function that gets a const reference to the slot
+     */
+    template<typename Function>
+    void forEachSlot(Function function) const
+    {
+      if (m_HasNull)
+        function(m_NullSlot);
+      const Slot* slots = data();
+      for (std::size_t i = 0; i < m_Capacity; ++i)
+      {
+        if (!slots[i].digest.isNull())
+          function(slots[i]);
+      }
+    }
+
+
+    /** \brief saves the table to a file
+     *
+     * \param fileName  name of the file
+     * \return Returns true, if the table was saved.
+     *         Returns false otherwise.
+     */
+    bool save(const std::string& fileName) const
+    {
+      uint8_t header[headerSize] = { 0 };
+      memcpy(header, fileMagic, 4);
+      writeHeaderValue<uint32_t>(header + 4, fileVersion);
+      writeHeaderValue<uint32_t>(header + 8, byteOrderMark);
+      writeHeaderValue<uint32_t>(header + 12, sizeof(Slot));
+      writeHeaderValue<uint32_t>(header + 16, sizeof(Digest));
+      writeHeaderValue<uint32_t>(header + 20, m_HasNull ? 1 : 0);
+      writeHeaderValue<uint64_t>(header + 24, m_Count);
+      writeHeaderValue<uint64_t>(header + 32, m_Capacity);
+      std::vector<uint8_t> nullSlot(nullSlotSize(), 0);
+      memcpy(nullSlot.data(), &m_NullSlot, sizeof(Slot));
+
+      const std::string tempFileName = fileName + ".tmp";
+      std::ofstream stream(tempFileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      if (!stream.is_open())
+        return false;
+      stream.write(reinterpret_cast<const char*>(header), headerSize);
+      stream.write(reinterpret_cast<const char*>(nullSlot.data()), nullSlot.size());
+      stream.write(reinterpret_cast<const char*>(data()), m_Capacity * sizeof(Slot));
+      stream.close();
+      if (!stream.good())
+      {
+        libstriezel::filesystem::file::remove(tempFileName);
+        return false;
+      }
+      if (!libstriezel::filesystem::file::rename(tempFileName, fileName))
+      {
+        libstriezel::filesystem::file::remove(tempFileName);
+        return false;
+      }
+      return true;
+    }
+
+
+    /** \brief loads a table that was saved with save()
+     *
+     * \param fileName  name of the file
+     * \return Returns true, if the table was loaded.
+     *         Returns false, if the file could not be mapped or has an
+     *         invalid or incompatible format. The table is empty then.
+     * \remarks The file is mapped into memory and must not be changed as
+     *          long as the table uses it. The slots are not checked, but
+     *          lookups in a corrupt table still finish.
+     */
+    bool load(const std::string& fileName)
+    {
+      clear();
+      if (!m_Mapping.open(fileName) || (m_Mapping.size() < headerSize + nullSlotSize()))
+      {
+        m_Mapping.close();
+        return false;
+      }
+      const uint8_t* header = m_Mapping.data();
+      const uint64_t capacity = readHeaderValue<uint64_t>(header + 32);
+      const uint64_t count = readHeaderValue<uint64_t>(header + 24);
+      const uint32_t hasNull = readHeaderValue<uint32_t>(header + 20);
+      const bool valid = (memcmp(header, fileMagic, 4) == 0)
+          && (readHeaderValue<uint32_t>(header + 4) == fileVersion)
+          && (readHeaderValue<uint32_t>(header + 8) == byteOrderMark)
+          && (readHeaderValue<uint32_t>(header + 12) == sizeof(Slot))
+          && (readHeaderValue<uint32_t>(header + 16) == sizeof(Digest))
+          && (hasNull <= 1)
+          && ((capacity & (capacity - 1)) == 0)
+          && (count <= capacity / 4 * 3)
+          && (capacity <= (m_Mapping.size() - headerSize - nullSlotSize()) / sizeof(Slot))
+          && (m_Mapping.size() == headerSize + nullSlotSize() + capacity * sizeof(Slot));
+      if (!valid)
+      {
+        m_Mapping.close();
+        return false;
+      }
+      memcpy(&m_NullSlot, header + headerSize, sizeof(Slot));
+      m_HasNull = hasNull != 0;
+      m_Capacity = static_cast<std::size_t>(capacity);
+      m_Count = static_cast<std::size_t>(count);
+      m_MappedSlots = (m_Capacity > 0)
+          ? reinterpret_cast<const Slot*>(header + headerSize + nullSlotSize()) : nullptr;
+      return true;
+    }
+
+
+    /** \brief checks whether the table still uses a file mapping
+     *
+     * \return Returns true, if the table is a read-only view of a file.
+     */
+    bool isMapped() const
+    {
+      return m_MappedSlots != nullptr;
+    }
+  protected:
+    /* finds the slot of a digest, returns nullptr if it is not present */
+    const Slot* findSlot(const Digest& digest) const
+    {
+      if (digest.isNull())
+        return m_HasNull ? &m_NullSlot : nullptr;
+      if (m_Capacity == 0)
+        return nullptr;
+      const Slot* slots = data();
+      const std::size_t mask = m_Capacity - 1;
+      std::size_t index = homeIndex(digest);
+      // A loaded file is not checked for empty slots, so the number of
+      // probes is limited to make lookups in a corrupt table finish.
+      for (std::size_t probes = 0; probes < m_Capacity; ++probes)
+      {
+        if (slots[index].digest.isNull())
+          return nullptr;
+        if (slots[index].digest == digest)
+          return &slots[index];
+        index = (index + 1) & mask;
+      }
+      return nullptr;
+    }
+
+
+    /* finds the slot of a digest for modification, inserting an empty
+       slot with that digest if it is not present
+
+       parameters:
+           digest   - the digest
+           inserted - receives whether a new slot was used
+    */
+    Slot& findOrInsertSlot(const Digest& digest, bool& inserted)
+    {
+      makeWritable();
+      if (digest.isNull())
+      {
+        inserted = !m_HasNull;
+        if (inserted)
+          m_NullSlot = Slot();
+        m_HasNull = true;
+        return m_NullSlot;
+      }
+      if ((m_Count + 1) > m_Capacity / 4 * 3)
+        rehash((m_Capacity == 0) ? minimumCapacity : 2 * m_Capacity);
+      const std::size_t mask = m_Capacity - 1;
+      std::size_t index = homeIndex(digest);
+      std::size_t probes = 0;
+      while (!m_Slots[index].digest.isNull())
+      {
+        if (m_Slots[index].digest == digest)
+        {
+          inserted = false;
+          return m_Slots[index];
+        }
+        index = (index + 1) & mask;
+        // Only a corrupt loaded table has no empty slot, rehashing into
+        // twice the capacity makes room.
+        if (++probes == m_Capacity)
+        {
+          rehash(2 * m_Capacity);
+          return findOrInsertSlot(digest, inserted);
+        }
+      }
+      m_Slots[index] = Slot();
+      m_Slots[index].digest = digest;
+      ++m_Count;
+      inserted = true;
+      return m_Slots[index];
+    }
+  private:
+    static constexpr std::size_t minimumCapacity = 16;
+    static constexpr std::size_t headerSize = 64;
+    static constexpr const char* fileMagic = "LSDT";
+    static constexpr uint32_t fileVersion = 1;
+    static constexpr uint32_t byteOrderMark = 0x01020304;
+
+    /* gets the size of the null slot within the file */
+    static constexpr std::size_t nullSlotSize()
+    {
+      return (sizeof(Slot) + headerSize - 1) / headerSize * headerSize;
+    }
+
+    template<typename T>
+    static void writeHeaderValue(uint8_t* position, const T value)
+    {
+      memcpy(position, &value, sizeof(T));
+    }
+
+    template<typename T>
+    static T readHeaderValue(const uint8_t* position)
+    {
+      T value;
+      memcpy(&value, position, sizeof(T));
+      return value;
+    }
+
+    /* gets the preferred slot of a digest */
+    std::size_t homeIndex(const Digest& digest) const
+    {
+      return std::hash<Digest>()(digest) & (m_Capacity - 1);
+    }
+
+    /* gets the slot array, either in memory or mapped */
+    const Slot* data() const
+    {
+      return (m_MappedSlots != nullptr) ? m_MappedSlots : m_Slots.data();
+    }
+
+    /* copies the slots of a mapped file into memory */
+    void makeWritable()
+    {
+      if (m_MappedSlots == nullptr)
+        return;
+      m_Slots.assign(m_MappedSlots, m_MappedSlots + m_Capacity);
+      m_MappedSlots = nullptr;
+      m_Mapping.close();
+    }
+
+    /* moves all digests into a new slot array with the given capacity */
+    void rehash(const std::size_t newCapacity)
+    {
+      std::vector<Slot> old(newCapacity);
+      old.swap(m_Slots);
+      m_Capacity = newCapacity;
+      const std::size_t mask = m_Capacity - 1;
+      for (const Slot& slot : old)
+      {
+        if (slot.digest.isNull())
+          continue;
+        std::size_t index = homeIndex(slot.digest);
+        while (!m_Slots[index].digest.isNull())
+        {
+          index = (index + 1) & mask;
+        }
+        m_Slots[index] = slot;
+      }
+    }
+
+    std::vector<Slot> m_Slots;  /**< slots, if the table is in memory */
+    MappedFile m_Mapping;       /**< mapping of a loaded file */
+    const Slot* m_MappedSlots;  /**< slots within the mapping, if any */
+    std::size_t m_Capacity;     /**< number of slots, zero or a power of two */
+    std::size_t m_Count;        /**< number of used slots */
+    bool m_HasNull;             /**< whether the null digest is present */
+    Slot m_NullSlot;            /**< slot of the null digest */
+}; //class
+
+
+/** \brief set of message digests
+ *
+ * \remarks See DigestTable for details of the layout.
+ */
+template<typename Digest>
+class DigestSet: public DigestTable<Digest, DigestSetSlot<Digest> >
+{
+  public:
+    /** \brief adds a digest to the set
+     *
+     * \param digest  the digest
+     * \return Returns true, if the digest was added.
+     *         Returns false, if the digest was already in the set.
+     */
+    bool insert(const Digest& digest)
+    {
+      bool inserted = false;
+      this->findOrInsertSlot(digest, inserted);
+      return inserted;
+    }
+
+
+    /** \brief calls a function for every digest of the set
+     *
+     * \param function  function that gets a const reference to the digest
+     */
+    template<typename Function>
+    void forEach(Function function) const
+    {
+      this->forEachSlot([&function](const DigestSetSlot<Digest>& slot) { function(slot.digest); });
+    }
+}; //class
+
+
+/** \brief map from message digests to values
+ *
+ * \remarks See DigestTable for details of the layout. Values have to be
+ *          trivially copyable, because they are stored in the file as is.
+ */
+template<typename Digest, typename Value>
+class DigestMap: public DigestTable<Digest, DigestMapSlot<Digest, Value> >
+{
+  public:
+    /** \brief adds a digest and its value to the map
+     *
+     * \param digest  the digest
+     * \param value   the value
+     * \return Returns true, if the digest was added.
+     *         Returns false, if the digest was already in the map. Its
+     *         value is not changed then.
+     */
+    bool insert(const Digest& digest, const Value& value)
+    {
+      bool inserted = false;
+      DigestMapSlot<Digest, Value>& slot = this->findOrInsertSlot(digest, inserted);
+      if (inserted)
+        slot.value = value;
+      return inserted;
+    }
+
+
+    /** \brief sets the value of a digest, adding the digest if necessary
+     *
+     * \param digest  the digest
+     * \param value   the value
+     * \return Returns true, if the digest was added.
+     *         Returns false, if the value of an existing digest was changed.
+     */
+    bool insertOrAssign(const Digest& digest, const Value& value)
+    {
+      bool inserted = false;
+      this->findOrInsertSlot(digest, inserted).value = value;
+      return inserted;
+    }
+
+
+    /** \brief gets the value of a digest
+     *
+     * \param digest  the digest
+     * \return Returns a pointer to the value of the digest.
+     *         Returns nullptr, if the digest is not in the map.
+     * \remarks The pointer is invalidated by any change of the map.
+     */
+    const Value* find(const Digest& digest) const
+    {
+      const DigestMapSlot<Digest, Value>* slot = this->findSlot(digest);
+      return (slot != nullptr) ? &slot->value : nullptr;
+    }
+
+
+    /** \brief calls a function for every entry of the map
+     *
+     * \param function  function that gets const references to the digest
+     *                  and to its value
+     */
+    template<typename Function>
+    void forEach(Function function) const
+    {
+      this->forEachSlot([&function](const DigestMapSlot<Digest, Value>& slot) { function(slot.digest, slot.value); });
+    }
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_DIGESTSET_HPP
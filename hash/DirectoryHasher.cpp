@@ -0,0 +1,489 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "DirectoryHasher.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <sys/stat.h>
+#include "../common/DirectoryFileList.hpp"
+#if defined(__linux__) || defined(linux)
+#include "../procfs/processors.hpp"
+#endif
+
+namespace libstriezel::hash
+{
+
+/* A batch of small files is handed to the workers as soon as it reaches one
+   of these limits. */
+const std::size_t maximumBatchFiles = 64;
+const uint64_t maximumBatchBytes = 1024 * 1024;
+
+/* a file that waits for hashing */
+struct PendingFile
+{
+  std::string fileName; /**< file name, relative to the hashed directory */
+  uint64_t size;        /**< size of the file in bytes */
+};
+
+/* unit of work for a worker: a single file or a batch of small files */
+typedef std::vector<PendingFile> HashTask;
+
+/* double-ended queue of tasks: the owning worker takes tasks from the back,
+   other workers steal from the front */
+class TaskQueue
+{
+  public:
+    void push(HashTask&& task)
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Tasks.push_back(std::move(task));
+    }
+
+    bool popBack(HashTask& task)
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      if (m_Tasks.empty())
+        return false;
+      task = std::move(m_Tasks.back());
+      m_Tasks.pop_back();
+      return true;
+    }
+
+    bool popFront(HashTask& task)
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      if (m_Tasks.empty())
+        return false;
+      task = std::move(m_Tasks.front());
+      m_Tasks.pop_front();
+      return true;
+    }
+
+    /* removes all tasks and returns their number */
+    std::size_t clear()
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      const std::size_t count = m_Tasks.size();
+      m_Tasks.clear();
+      return count;
+    }
+  private:
+    std::mutex m_Mutex;
+    std::deque<HashTask> m_Tasks;
+}; //class
+
+/* shared state of the walking thread and the workers
+
+   Workers with an index below regularWorkers own a queue for small and
+   medium-sized files, the remaining workers are dedicated to large files.
+   Regular workers only take large files once the walk is done (or if there
+   are no dedicated workers), dedicated workers steal from the regular
+   queues whenever no large file is waiting.
+*/
+class HashScheduler
+{
+  public:
+    HashScheduler(const std::string& root, const unsigned int algorithms, const unsigned int regularWorkers, const unsigned int largeWorkers)
+    : m_Root(root), m_Algorithms(algorithms),
+      m_Queues(), m_LargeQueue(),
+      m_RegularWorkers(regularWorkers), m_LargeWorkers(largeWorkers),
+      m_NextQueue(0),
+      m_WorkMutex(), m_WorkAvailable(),
+      m_QueuedRegular(0), m_QueuedLarge(0), m_WalkDone(false), m_Abort(false),
+      m_ResultMutex(), m_ResultAvailable(), m_Results()
+    {
+      for (unsigned int i = 0; i < m_RegularWorkers; ++i)
+      {
+        m_Queues.push_back(std::make_unique<TaskQueue>());
+      }
+    }
+
+    /* adds a task, called by the walking thread only */
+    void submit(HashTask&& task, const bool large)
+    {
+      if (large)
+      {
+        {
+          std::lock_guard<std::mutex> lock(m_WorkMutex);
+          ++m_QueuedLarge;
+        }
+        m_LargeQueue.push(std::move(task));
+        // Not every worker may take large files, so wake all of them.
+        m_WorkAvailable.notify_all();
+        return;
+      }
+      // The counter is raised first, so it never drops below zero when a
+      // worker takes the task right away.
+      {
+        std::lock_guard<std::mutex> lock(m_WorkMutex);
+        ++m_QueuedRegular;
+      }
+      m_Queues[m_NextQueue]->push(std::move(task));
+      m_NextQueue = (m_NextQueue + 1) % m_RegularWorkers;
+      m_WorkAvailable.notify_one();
+    }
+
+    /* checks whether no task is waiting, i.e. workers may be idle */
+    bool idle() const
+    {
+      return (m_QueuedRegular.load() == 0) && (m_QueuedLarge.load() == 0);
+    }
+
+    /* signals that no more tasks will be submitted, workers exit as soon
+       as all queues are empty
+
+       parameters:
+           discard - whether the tasks that are still queued shall be dropped;
+                     workers then exit without finishing their current task
+    */
+    void finishWalk(const bool discard)
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_WorkMutex);
+        m_WalkDone = true;
+        if (discard)
+        {
+          m_Abort = true;
+          // Workers may still decrement the counters for tasks they have
+          // already taken, so only the dropped tasks are subtracted.
+          for (auto & queue : m_Queues)
+          {
+            m_QueuedRegular -= queue->clear();
+          }
+          m_QueuedLarge -= m_LargeQueue.clear();
+        }
+      }
+      m_WorkAvailable.notify_all();
+    }
+
+    /* main function of the worker threads */
+    void work(const unsigned int index)
+    {
+      HashTask task;
+      while (true)
+      {
+        if (takeTask(index, task))
+        {
+          for (const PendingFile& file : task)
+          {
+            if (m_Abort.load())
+              break;
+            hashFile(file);
+          }
+          continue;
+        }
+        std::unique_lock<std::mutex> lock(m_WorkMutex);
+        m_WorkAvailable.wait(lock, [this, index]() { return m_WalkDone || hasWorkFor(index); });
+        if (m_Abort.load() || (m_WalkDone && (m_QueuedRegular.load() == 0) && (m_QueuedLarge.load() == 0)))
+          return;
+      }
+    }
+
+    /* gets the next finished file, called by the walking thread only
+
+       parameters:
+           result - receives the digests of the file
+           wait   - whether to wait until a result is available
+    */
+    bool nextResult(FileDigest& result, const bool wait)
+    {
+      std::unique_lock<std::mutex> lock(m_ResultMutex);
+      if (wait)
+        m_ResultAvailable.wait(lock, [this]() { return !m_Results.empty(); });
+      if (m_Results.empty())
+        return false;
+      result = std::move(m_Results.front());
+      m_Results.pop_front();
+      return true;
+    }
+  private:
+    /* checks whether the worker with the given index could take a task */
+    bool hasWorkFor(const unsigned int index) const
+    {
+      const bool mayTakeLarge = (index >= m_RegularWorkers) || m_WalkDone || (m_LargeWorkers == 0);
+      return (m_QueuedRegular.load() > 0) || (mayTakeLarge && (m_QueuedLarge.load() > 0));
+    }
+
+    /* takes a task from the own queue or steals one from another queue */
+    bool takeTask(const unsigned int index, HashTask& task)
+    {
+      if (m_Abort.load())
+        return false;
+      const bool dedicated = index >= m_RegularWorkers;
+      if (dedicated && m_LargeQueue.popFront(task))
+      {
+        --m_QueuedLarge;
+        return true;
+      }
+      if (!dedicated && m_Queues[index]->popBack(task))
+      {
+        --m_QueuedRegular;
+        return true;
+      }
+      for (unsigned int i = 1; i <= m_RegularWorkers; ++i)
+      {
+        if (m_Queues[(index + i) % m_RegularWorkers]->popFront(task))
+        {
+          --m_QueuedRegular;
+          return true;
+        }
+      }
+      bool mayTakeLarge = false;
+      {
+        std::lock_guard<std::mutex> lock(m_WorkMutex);
+        mayTakeLarge = m_WalkDone || (m_LargeWorkers == 0);
+      }
+      if (!dedicated && mayTakeLarge && m_LargeQueue.popFront(task))
+      {
+        --m_QueuedLarge;
+        return true;
+      }
+      return false;
+    }
+
+    /* hashes a single file and publishes the result */
+    void hashFile(const PendingFile& file)
+    {
+      FileDigest result;
+      result.fileName = file.fileName;
+      result.size = file.size;
+      result.digests = computeFromFile(m_Root + file.fileName, m_Algorithms, 1);
+      result.success = !((((m_Algorithms & daSHA1) != 0) && result.digests.sha1.isNull())
+          || (((m_Algorithms & daSHA224) != 0) && result.digests.sha224.isNull())
+          || (((m_Algorithms & daSHA256) != 0) && result.digests.sha256.isNull())
+          || (((m_Algorithms & daSHA384) != 0) && result.digests.sha384.isNull())
+          || (((m_Algorithms & daSHA512) != 0) && result.digests.sha512.isNull()));
+      {
+        std::lock_guard<std::mutex> lock(m_ResultMutex);
+        m_Results.push_back(std::move(result));
+      }
+      m_ResultAvailable.notify_one();
+    }
+
+    const std::string m_Root;
+    const unsigned int m_Algorithms;
+    std::vector<std::unique_ptr<TaskQueue> > m_Queues;
+    TaskQueue m_LargeQueue;
+    const unsigned int m_RegularWorkers;
+    const unsigned int m_LargeWorkers;
+    unsigned int m_NextQueue;
+    std::mutex m_WorkMutex;
+    std::condition_variable m_WorkAvailable;
+    std::atomic<std::size_t> m_QueuedRegular;
+    std::atomic<std::size_t> m_QueuedLarge;
+    bool m_WalkDone;
+    std::atomic<bool> m_Abort;
+    std::mutex m_ResultMutex;
+    std::condition_variable m_ResultAvailable;
+    std::deque<FileDigest> m_Results;
+}; //class
+
+/* worker threads of a scheduler, they are always joined - even if the
+   result callback throws an exception */
+class WorkerPool
+{
+  public:
+    WorkerPool(HashScheduler& scheduler, const unsigned int threads)
+    : m_Scheduler(scheduler), m_Threads()
+    {
+      for (unsigned int i = 0; i < threads; ++i)
+      {
+        m_Threads.emplace_back(&HashScheduler::work, &m_Scheduler, i);
+      }
+    }
+
+    ~WorkerPool()
+    {
+      m_Scheduler.finishWalk(true);
+      for (std::thread& thread : m_Threads)
+      {
+        thread.join();
+      }
+    }
+
+    WorkerPool(const WorkerPool& other) = delete;
+    WorkerPool& operator=(const WorkerPool& other) = delete;
+  private:
+    HashScheduler& m_Scheduler;
+    std::vector<std::thread> m_Threads;
+}; //class
+
+/* kinds of directory entries */
+enum EntryType { etDirectory, etRegularFile, etOther };
+
+/* determines the type of a directory entry
+
+   parameters:
+       path - path of the entry
+       size - receives the file size for regular files
+*/
+EntryType getEntryType(const std::string& path, uint64_t& size)
+{
+  struct stat buffer;
+  #if !defined(_WIN32)
+  // Symbolic links to directories are not followed to avoid cycles.
+  if (lstat(path.c_str(), &buffer) != 0)
+    return etOther;
+  if (S_ISDIR(buffer.st_mode))
+    return etDirectory;
+  if (S_ISLNK(buffer.st_mode) && (stat(path.c_str(), &buffer) != 0))
+    return etOther;
+  #else
+  if (stat(path.c_str(), &buffer) != 0)
+    return etOther;
+  if ((buffer.st_mode & S_IFMT) == S_IFDIR)
+    return etDirectory;
+  #endif
+  if ((buffer.st_mode & S_IFMT) != S_IFREG)
+    return etOther;
+  size = static_cast<uint64_t>(buffer.st_size);
+  return etRegularFile;
+}
+
+/* determines the number of worker threads if none is given */
+unsigned int defaultThreadCount()
+{
+  #if defined(__linux__) || defined(linux)
+  const int processors = libstriezel::procfs::getProcessorCount();
+  if (processors > 0)
+    return static_cast<unsigned int>(processors);
+  #endif
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+DirectoryHasher::DirectoryHasher(const unsigned int algorithms, const unsigned int threads)
+: m_Algorithms(algorithms),
+  m_Threads((threads != 0) ? threads : defaultThreadCount()),
+  m_SmallFileLimit(defaultSmallFileLimit),
+  m_LargeFileLimit(defaultLargeFileLimit)
+{
+}
+
+unsigned int DirectoryHasher::threadCount() const
+{
+  return m_Threads;
+}
+
+void DirectoryHasher::setFileSizeLimits(const uint64_t smallFileLimit, const uint64_t largeFileLimit)
+{
+  m_SmallFileLimit = smallFileLimit;
+  m_LargeFileLimit = std::max(smallFileLimit, largeFileLimit);
+}
+
+bool DirectoryHasher::hashDirectory(const std::string& directory, const ResultCallback& callback) const
+{
+  std::string root = directory.empty() ? "." : directory;
+  if (root.substr(root.size() - 1) != DirectorySeparator)
+    root += DirectorySeparator;
+
+  // A quarter of the workers (but at least one) is reserved for large files.
+  const unsigned int largeWorkers = (m_Threads >= 4) ? m_Threads / 4 : ((m_Threads >= 2) ? 1 : 0);
+  HashScheduler scheduler(root, m_Algorithms, m_Threads - largeWorkers, largeWorkers);
+  WorkerPool pool(scheduler, m_Threads);
+
+  bool allRead = true;
+  std::size_t submitted = 0;
+  std::size_t delivered = 0;
+  FileDigest result;
+  HashTask batch;
+  uint64_t batchBytes = 0;
+  // directories that still have to be walked, relative to root
+  std::vector<std::string> directories(1, "");
+  while (!directories.empty())
+  {
+    const std::string prefix = directories.back();
+    directories.pop_back();
+    std::vector<FileEntry> entries;
+    if (!getDirectoryFileList(root + prefix, entries, prefix, false))
+      allRead = false;
+    for (const FileEntry& entry : entries)
+    {
+      if ((entry.FileName == prefix + ".") || (entry.FileName == prefix + ".."))
+        continue;
+      uint64_t size = 0;
+      switch (getEntryType(root + entry.FileName, size))
+      {
+        case etDirectory:
+             directories.push_back(entry.FileName + DirectorySeparator);
+             break;
+        case etRegularFile:
+             ++submitted;
+             if (size >= m_LargeFileLimit)
+               scheduler.submit(HashTask(1, PendingFile{ entry.FileName, size }), true);
+             else if (size >= m_SmallFileLimit)
+               scheduler.submit(HashTask(1, PendingFile{ entry.FileName, size }), false);
+             else
+             {
+               batch.push_back(PendingFile{ entry.FileName, size });
+               batchBytes += size;
+               if ((batch.size() >= maximumBatchFiles) || (batchBytes >= maximumBatchBytes))
+               {
+                 scheduler.submit(std::move(batch), false);
+                 batch = HashTask();
+                 batchBytes = 0;
+               }
+             }
+             break;
+        case etOther:
+             break;
+      }//swi
+      while (scheduler.nextResult(result, false))
+      {
+        callback(result);
+        ++delivered;
+      }
+    }
+    // Do not let the workers wait for a full batch.
+    if (!batch.empty() && scheduler.idle())
+    {
+      scheduler.submit(std::move(batch), false);
+      batch = HashTask();
+      batchBytes = 0;
+    }
+  }
+  if (!batch.empty())
+    scheduler.submit(std::move(batch), false);
+  scheduler.finishWalk(false);
+
+  while (delivered < submitted)
+  {
+    scheduler.nextResult(result, true);
+    callback(result);
+    ++delivered;
+  }
+  return allRead;
+}
+
+bool DirectoryHasher::hashDirectory(const std::string& directory, std::vector<FileDigest>& results) const
+{
+  results.clear();
+  const bool allRead = hashDirectory(directory,
+      [&results](const FileDigest& digest) { results.push_back(digest); });
+  std::sort(results.begin(), results.end(),
+      [](const FileDigest& a, const FileDigest& b) { return a.fileName < b.fileName; });
+  return allRead;
+}
+
+} //namespace
@@ -0,0 +1,128 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_DIRECTORYHASHER_HPP
+#define LIBSTRIEZEL_HASH_DIRECTORYHASHER_HPP
+
+#include <functional>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "MultiDigest.hpp"
+
+namespace libstriezel::hash
+{
+
+/// message digests of a single file within a directory tree
+struct FileDigest
+{
+  std::string fileName; /**< file name, relative to the hashed directory */
+  uint64_t size;        /**< size of the file in bytes, as seen while walking */
+  bool success;         /**< whether the file could be hashed */
+  MultiDigest digests;  /**< the requested message digests */
+};
+
+
+/** \brief computes message digests of all files in a directory tree
+ *
+ * The calling thread walks the directory tree while a pool of worker
+ * threads hashes the files. Every worker has its own queue, idle workers
+ * steal work from the queues of other workers. Small files are grouped into
+ * batches to keep the scheduling overhead low, large files go to a separate
+ * queue that is served by dedicated workers, so that they do not hold up
+ * the many small files.
+ *
+ * Only regular files are hashed. Symbolic links to files are followed,
+ * symbolic links to directories are not.
+ */
+class DirectoryHasher
+{
+  public:
+    /// files smaller than this are hashed in batches by default
+    static constexpr uint64_t defaultSmallFileLimit = 64 * 1024;
+
+    /// files of at least this size go to the dedicated workers by default
+    static constexpr uint64_t defaultLargeFileLimit = 64 * 1024 * 1024;
+
+
+    /// function that receives the digests of a file
+    typedef std::function<void(const FileDigest&)> ResultCallback;
+
+
+    /** \brief constructor
+     *
+     * \param algorithms  the requested algorithms, a combination of the
+     *                    DigestAlgorithm flags
+     * \param threads     number of worker threads, zero means one thread per
+     *                    processor
+     */
+    explicit DirectoryHasher(const unsigned int algorithms, const unsigned int threads = 0);
+
+
+    /** \brief gets the number of worker threads
+     *
+     * \return Returns the number of worker threads used for hashing.
+     */
+    unsigned int threadCount() const;
+
+
+    /** \brief sets the size limits that decide how files are scheduled
+     *
+     * \param smallFileLimit  files smaller than this are hashed in batches
+     * \param largeFileLimit  files of at least this size are hashed by the
+     *                        dedicated workers for large files
+     */
+    void setFileSizeLimits(const uint64_t smallFileLimit, const uint64_t largeFileLimit);
+
+
+    /** \brief hashes all files in a directory tree
+     *
+     * \param directory  the directory
+     * \param callback   function that is called for every file as soon as
+     *                   its digests are available
+     * \return Returns true, if all directories could be read.
+     *         Returns false, if at least one directory could not be read.
+     *         Files that could not be hashed are passed to the callback
+     *         with success set to false and do not affect the return value.
+     * \remarks The callback is only called from the calling thread, so it
+     *          does not need any synchronization. Files are reported in the
+     *          order in which they are finished, not in directory order.
+     */
+    bool hashDirectory(const std::string& directory, const ResultCallback& callback) const;
+
+
+    /** \brief hashes all files in a directory tree
+     *
+     * \param directory  the directory
+     * \param results    receives the digests of all files, sorted by name
+     * \return Returns true, if all directories could be read.
+     *         Returns false, if at least one directory could not be read.
+     */
+    bool hashDirectory(const std::string& directory, std::vector<FileDigest>& results) const;
+  private:
+    unsigned int m_Algorithms; /**< requested algorithms */
+    unsigned int m_Threads; /**< number of worker threads */
+    uint64_t m_SmallFileLimit; /**< files below this size are batched */
+    uint64_t m_LargeFileLimit; /**< files of this size or more are large */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_DIRECTORYHASHER_HPP
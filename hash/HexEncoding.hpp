@@ -0,0 +1,413 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_HEXENCODING_HPP
+#define LIBSTRIEZEL_HASH_HEXENCODING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+#include "cpu_features.hpp"
+#if defined(LIBSTRIEZEL_HASH_X86)
+#include <immintrin.h>
+#endif
+
+/* This file contains the conversion between message digests and their
+   hexadecimal representation. Only lower case digits are produced and
+   accepted, like the MessageDigest classes always did. The functions are
+   defined in the header, so that every user of the MessageDigest classes
+   gets them without additional source files. */
+
+namespace libstriezel::hash
+{
+
+/// implementations of the hexadecimal conversion
+enum class HexImplementation
+{
+  Scalar, /**< portable C++ implementation */
+  SSSE3   /**< 16 bytes at once, using Supplemental SSE3 */
+};
+
+
+/** \brief checks whether a hexadecimal implementation can be used on this machine
+ *
+ * \param impl  the implementation
+ * \return Returns true, if the implementation is supported.
+ */
+inline bool isSupported(const HexImplementation impl)
+{
+  switch (impl)
+  {
+    case HexImplementation::Scalar:
+         return true;
+    case HexImplementation::SSSE3:
+         #if defined(LIBSTRIEZEL_HASH_X86)
+         return cpuFeatures().ssse3;
+         #else
+         return false;
+         #endif
+  }//swi
+  return false;
+}
+
+
+/* returns the variable that holds the active hexadecimal implementation */
+inline std::atomic<HexImplementation>& activeHexImplementation()
+{
+  static std::atomic<HexImplementation> impl(isSupported(HexImplementation::SSSE3)
+      ? HexImplementation::SSSE3 : HexImplementation::Scalar);
+  return impl;
+}
+
+
+/** \brief gets the hexadecimal implementation that is currently used
+ *
+ * \return Returns the implementation used by the hex conversion functions.
+ */
+inline HexImplementation getHexImplementation()
+{
+  return activeHexImplementation().load(std::memory_order_relaxed);
+}
+
+
+/** \brief sets the implementation of the hexadecimal conversion
+ *
+ * \param impl  the implementation that shall be used
+ * \return Returns true, if the implementation was changed.
+ *         Returns false, if the implementation is not supported.
+ */
+inline bool setHexImplementation(const HexImplementation impl)
+{
+  if (!isSupported(impl))
+    return false;
+  activeHexImplementation().store(impl, std::memory_order_relaxed);
+  return true;
+}
+
+
+/* gets the value of a lower case hexadecimal digit, or -1 for other characters */
+inline int hexDigitValue(const char c)
+{
+  if ((c >= '0') && (c <= '9'))
+    return c - '0';
+  if ((c >= 'a') && (c <= 'f'))
+    return c - 'a' + 10;
+  return -1;
+}
+
+
+#if defined(LIBSTRIEZEL_HASH_X86)
+/* encodes 16 bytes into 32 hexadecimal digits */
+__attribute__((target("ssse3")))
+inline void encodeHex16SSSE3(const uint8_t* data, char* hex)
+{
+  const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                       '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+  const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+  const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  const __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask));
+  const __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, nibbleMask));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(hex), _mm_unpacklo_epi8(high, low));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + 16), _mm_unpackhi_epi8(high, low));
+}
+
+/* converts 16 characters to their digit values, returns the mask of the
+   characters that are valid lower case hexadecimal digits (one bit per
+   character) */
+__attribute__((target("ssse3")))
+inline int hexValues16SSSE3(const char* hex, __m128i& values)
+{
+  const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex));
+  // Characters of 0x80 and above are negative and fail both ranges.
+  const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chars));
+  const __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('a' - 1)),
+                                         _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), chars));
+  values = _mm_or_si128(_mm_and_si128(isDigit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+                        _mm_and_si128(isLetter, _mm_sub_epi8(chars, _mm_set1_epi8('a' - 10))));
+  return _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter));
+}
+
+/* decodes 32 hexadecimal digits into 16 bytes, returns false if there are
+   invalid characters */
+__attribute__((target("ssse3")))
+inline bool decodeHex16SSSE3(const char* hex, uint8_t* data)
+{
+  __m128i first;
+  __m128i second;
+  const int valid = hexValues16SSSE3(hex, first) & hexValues16SSSE3(hex + 16, second);
+  // high nibble * 16 + low nibble for every pair of digits
+  const __m128i weights = _mm_set1_epi16(0x0110);
+  const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights),
+                                         _mm_maddubs_epi16(second, weights));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(data), bytes);
+  return valid == 0xFFFF;
+}
+#endif // LIBSTRIEZEL_HASH_X86
+
+
+/** \brief encodes bytes as lower case hexadecimal digits
+ *
+ * \param data    the bytes
+ * \param length  number of bytes in data
+ * \param hex     buffer that receives 2 * length characters, no terminating
+ *                null character is written
+ */
+inline void encodeHex(const uint8_t* data, std::size_t length, char* hex)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  if (getHexImplementation() == HexImplementation::SSSE3)
+  {
+    while (length >= 16)
+    {
+      encodeHex16SSSE3(data, hex);
+      data += 16;
+      hex += 32;
+      length -= 16;
+    }
+  }
+  #endif
+  const char cHexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    hex[2 * i] = cHexDigits[data[i] >> 4];
+    hex[2 * i + 1] = cHexDigits[data[i] & 0x0F];
+  }
+}
+
+
+/** \brief decodes lower case hexadecimal digits into bytes
+ *
+ * \param hex     the hexadecimal digits, 2 * length characters
+ * \param length  number of bytes that shall be decoded
+ * \param data    buffer that receives length bytes
+ * \return Returns true, if all characters are lower case hexadecimal digits.
+ *         Returns false otherwise, the content of data is undefined then.
+ */
+inline bool decodeHex(const char* hex, std::size_t length, uint8_t* data)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  if (getHexImplementation() == HexImplementation::SSSE3)
+  {
+    while (length >= 16)
+    {
+      if (!decodeHex16SSSE3(hex, data))
+        return false;
+      data += 16;
+      hex += 32;
+      length -= 16;
+    }
+  }
+  #endif
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    const int high = hexDigitValue(hex[2 * i]);
+    const int low = hexDigitValue(hex[2 * i + 1]);
+    if ((high < 0) || (low < 0))
+      return false;
+    data[i] = static_cast<uint8_t>((high << 4) | low);
+  }
+  return true;
+}
+
+
+/** \brief checks whether all characters are lower case hexadecimal digits
+ *
+ * \param hex     the characters
+ * \param length  number of characters
+ * \return Returns true, if all characters are lower case hexadecimal digits.
+ */
+inline bool isValidHex(const char* hex, std::size_t length)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  if (getHexImplementation() == HexImplementation::SSSE3)
+  {
+    __m128i values;
+    while (length >= 16)
+    {
+      if (hexValues16SSSE3(hex, values) != 0xFFFF)
+        return false;
+      hex += 16;
+      length -= 16;
+    }
+  }
+  #endif
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    if (hexDigitValue(hex[i]) < 0)
+      return false;
+  }
+  return true;
+}
+
+
+/* writes words as bytes in big endian order */
+template<typename Word>
+inline void storeBigEndian(const Word* words, const std::size_t count, uint8_t* bytes)
+{
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    for (std::size_t j = 0; j < sizeof(Word); ++j)
+    {
+      bytes[i * sizeof(Word) + j] = static_cast<uint8_t>(words[i] >> (8 * (sizeof(Word) - 1 - j)));
+    }
+  }
+}
+
+
+/* reads words from bytes in big endian order */
+template<typename Word>
+inline void loadBigEndian(const uint8_t* bytes, const std::size_t count, Word* words)
+{
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    Word word = 0;
+    for (std::size_t j = 0; j < sizeof(Word); ++j)
+    {
+      word = (word << 8) | bytes[i * sizeof(Word) + j];
+    }
+    words[i] = word;
+  }
+}
+
+
+/** \brief encodes the words of a message digest as hexadecimal digits
+ *
+ * \param words  the words of the digest
+ * \param count  number of words, the digest must not be larger than 64 bytes
+ * \param hex    buffer that receives 2 * sizeof(Word) * count characters,
+ *               no terminating null character is written
+ * \remarks Every word is written in big endian order, i.e. the most
+ *          significant digit comes first.
+ */
+template<typename Word>
+inline void encodeWords(const Word* words, const std::size_t count, char* hex)
+{
+  uint8_t bytes[64];
+  storeBigEndian(words, count, bytes);
+  encodeHex(bytes, count * sizeof(Word), hex);
+}
+
+
+/** \brief decodes hexadecimal digits into the words of a message digest
+ *
+ * \param hex    the hexadecimal digits, 2 * sizeof(Word) * count characters
+ * \param count  number of words, the digest must not be larger than 64 bytes
+ * \param words  receives the words of the digest
+ * \return Returns true, if all characters are lower case hexadecimal digits.
+ *         Returns false otherwise, the words are unchanged then.
+ */
+template<typename Word>
+inline bool decodeWords(const char* hex, const std::size_t count, Word* words)
+{
+  uint8_t bytes[64];
+  if (!decodeHex(hex, count * sizeof(Word), bytes))
+    return false;
+  loadBigEndian(bytes, count, words);
+  return true;
+}
+
+
+/** \brief encodes several message digests as hexadecimal digits
+ *
+ * \param digests  the digests, the type needs a member array hash
+ * \param count    number of digests
+ * \param hex      buffer that receives the hexadecimal representations of
+ *                 all digests without any separators or null characters
+ * \remarks The digests are converted to bytes in chunks first, so the
+ *          vectorized encoding runs over whole chunks instead of single
+ *          digests that may not be a multiple of 16 bytes long.
+ */
+template<typename Digest>
+inline void encodeDigests(const Digest* digests, std::size_t count, char* hex)
+{
+  typedef std::remove_extent_t<decltype(Digest::hash)> Word;
+  constexpr std::size_t words = std::extent_v<decltype(Digest::hash)>;
+  constexpr std::size_t digestBytes = words * sizeof(Word);
+  uint8_t bytes[64 * 64];
+  constexpr std::size_t chunkDigests = sizeof(bytes) / digestBytes;
+  while (count > 0)
+  {
+    const std::size_t n = (count < chunkDigests) ? count : chunkDigests;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      storeBigEndian(digests[i].hash, words, bytes + i * digestBytes);
+    }
+    encodeHex(bytes, n * digestBytes, hex);
+    digests += n;
+    hex += 2 * n * digestBytes;
+    count -= n;
+  }
+}
+
+
+/** \brief decodes several message digests from hexadecimal digits
+ *
+ * \param hex      the hexadecimal representations of all digests without
+ *                 any separators
+ * \param count    number of digests
+ * \param digests  receives the digests, the type needs a member array hash
+ *                 and a member function setToNull()
+ * \return Returns true, if all digests are valid.
+ *         Returns false, if at least one digest has invalid characters.
+ *         Such digests are set to the "null" digest.
+ */
+template<typename Digest>
+inline bool decodeDigests(const char* hex, std::size_t count, Digest* digests)
+{
+  typedef std::remove_extent_t<decltype(Digest::hash)> Word;
+  constexpr std::size_t words = std::extent_v<decltype(Digest::hash)>;
+  constexpr std::size_t digestBytes = words * sizeof(Word);
+  uint8_t bytes[64 * 64];
+  constexpr std::size_t chunkDigests = sizeof(bytes) / digestBytes;
+  bool allValid = true;
+  while (count > 0)
+  {
+    const std::size_t n = (count < chunkDigests) ? count : chunkDigests;
+    if (decodeHex(hex, n * digestBytes, bytes))
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        loadBigEndian(bytes + i * digestBytes, words, digests[i].hash);
+      }
+    }
+    else
+    {
+      // find the invalid digests of the chunk
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (!decodeWords(hex + 2 * i * digestBytes, words, digests[i].hash))
+        {
+          digests[i].setToNull();
+          allValid = false;
+        }
+      }
+    }
+    digests += n;
+    hex += 2 * n * digestBytes;
+    count -= n;
+  }
+  return allValid;
+}
+
+} // namespace
+
+#endif // LIBSTRIEZEL_HASH_HEXENCODING_HPP
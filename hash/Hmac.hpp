@@ -0,0 +1,310 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_HMAC_HPP
+#define LIBSTRIEZEL_HASH_HMAC_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include "HexEncoding.hpp"
+#include "sha1/Hasher.hpp"
+#include "sha224/Hasher.hpp"
+#include "sha256/Hasher.hpp"
+#include "sha384/Hasher.hpp"
+#include "sha512/Hasher.hpp"
+
+namespace libstriezel::hash
+{
+
+/** \brief HMAC (RFC 2104) on top of one of the incremental hashers
+ *
+ * The key only affects the first block of the inner and of the outer hash,
+ * so both are compressed once when the key is set. Every message starts
+ * from copies of these keyed hashers, which saves two compressions per
+ * message compared to hashing the padded key again each time.
+ *
+ * compute() does not change the object, so one Hmac object can be shared
+ * by several threads that authenticate messages with the same key. The
+ * incremental interface update() / finalize() is not thread-safe.
+ */
+template<typename Hasher, std::size_t BlockSize>
+class Hmac
+{
+  public:
+    /// type of the authentication code, i.e. the message digest type
+    typedef decltype(std::declval<Hasher&>().finalize()) MessageDigest;
+
+    /// size of the blocks of the hash function in bytes
+    static constexpr std::size_t blockSize = BlockSize;
+
+    /// size of the authentication code in bytes
+    static constexpr std::size_t digestSize = sizeof(MessageDigest::hash);
+
+
+    /** \brief constructor
+     *
+     * \param key        pointer to the key
+     * \param keyLength  length of the key in bytes, keys that are longer
+     *                   than one block are hashed first
+     */
+    Hmac(const void* key, const std::size_t keyLength)
+    : m_Inner(), m_Outer(), m_Current()
+    {
+      uint8_t pad[BlockSize] = { 0 };
+      if (keyLength > BlockSize)
+      {
+        Hasher keyHasher;
+        keyHasher.update(key, keyLength);
+        toBytes(keyHasher.finalize(), pad);
+      }
+      else if (keyLength > 0)
+      {
+        memcpy(pad, key, keyLength);
+      }
+      for (uint8_t& byte : pad)
+      {
+        byte ^= 0x36;
+      }
+      m_Inner.update(pad, BlockSize);
+      for (uint8_t& byte : pad)
+      {
+        byte ^= 0x36 ^ 0x5c;
+      }
+      m_Outer.update(pad, BlockSize);
+      std::fill(pad, pad + BlockSize, 0);
+      m_Current = m_Inner;
+    }
+
+
+    /** \brief computes the authentication code of a message
+     *
+     * \param data    pointer to the message
+     * \param length  length of the message in bytes
+     * \return Returns the authentication code.
+     */
+    MessageDigest compute(const void* data, const std::size_t length) const
+    {
+      Hasher inner(m_Inner);
+      inner.update(data, length);
+      return finish(inner);
+    }
+
+
+    /** \brief passes the next piece of the message
+     *
+     * \param data    pointer to the data
+     * \param length  length of the data in bytes
+     */
+    void update(const void* data, const std::size_t length)
+    {
+      m_Current.update(data, length);
+    }
+
+
+    /** \brief gets the authentication code of the data passed to update()
+     *
+     * \return Returns the authentication code.
+     * \remarks The object is reset afterwards, so it can be used for the
+     *          next message with the same key.
+     */
+    MessageDigest finalize()
+    {
+      const MessageDigest result = finish(m_Current);
+      m_Current = m_Inner;
+      return result;
+    }
+
+
+    /** \brief discards the data that was passed to update() */
+    void reset()
+    {
+      m_Current = m_Inner;
+    }
+
+
+    /** \brief writes a message digest as byte sequence
+     *
+     * \param digest  the message digest
+     * \param bytes   buffer for digestSize bytes
+     */
+    static void toBytes(const MessageDigest& digest, uint8_t* bytes)
+    {
+      storeBigEndian(digest.hash, std::extent_v<decltype(MessageDigest::hash)>, bytes);
+    }
+  private:
+    /* computes the outer hash for the given inner hasher */
+    MessageDigest finish(Hasher& inner) const
+    {
+      uint8_t innerDigest[digestSize];
+      toBytes(inner.finalize(), innerDigest);
+      Hasher outer(m_Outer);
+      outer.update(innerDigest, digestSize);
+      return outer.finalize();
+    }
+
+    Hasher m_Inner;    /**< inner hasher after the padded key */
+    Hasher m_Outer;    /**< outer hasher after the padded key */
+    Hasher m_Current;  /**< inner hasher for update() / finalize() */
+}; //class
+
+
+typedef Hmac<SHA1::Hasher, 64> HmacSHA1;
+typedef Hmac<SHA224::Hasher, 64> HmacSHA224;
+typedef Hmac<SHA256::Hasher, 64> HmacSHA256;
+typedef Hmac<SHA384::Hasher, 128> HmacSHA384;
+typedef Hmac<SHA512::Hasher, 128> HmacSHA512;
+
+
+/** \brief derives a key from a password with PBKDF2 (RFC 8018)
+ *
+ * \param password        pointer to the password
+ * \param passwordLength  length of the password in bytes
+ * \param salt            pointer to the salt
+ * \param saltLength      length of the salt in bytes
+ * \param iterations      number of iterations, at least one
+ * \param output          buffer that receives the derived key
+ * \param outputLength    length of the derived key in bytes
+ * \return Returns true, if the key was derived.
+ *         Returns false, if the number of iterations is zero.
+ * \remarks The password is used as HMAC key, so its padded blocks are
+ *          only compressed once for all iterations.
+ */
+template<typename HmacType>
+bool pbkdf2(const void* password, const std::size_t passwordLength,
+            const void* salt, const std::size_t saltLength,
+            const uint32_t iterations, uint8_t* output, const std::size_t outputLength)
+{
+  if (iterations == 0)
+    return false;
+  constexpr std::size_t digestSize = HmacType::digestSize;
+  HmacType hmac(password, passwordLength);
+  uint8_t u[digestSize];
+  uint8_t t[digestSize];
+  uint32_t blockIndex = 1;
+  for (std::size_t offset = 0; offset < outputLength; offset += digestSize, ++blockIndex)
+  {
+    const uint8_t index[4] = {
+      static_cast<uint8_t>(blockIndex >> 24), static_cast<uint8_t>(blockIndex >> 16),
+      static_cast<uint8_t>(blockIndex >> 8), static_cast<uint8_t>(blockIndex)
+    };
+    hmac.update(salt, saltLength);
+    hmac.update(index, 4);
+    HmacType::toBytes(hmac.finalize(), u);
+    memcpy(t, u, digestSize);
+    for (uint32_t i = 1; i < iterations; ++i)
+    {
+      HmacType::toBytes(hmac.compute(u, digestSize), u);
+      for (std::size_t j = 0; j < digestSize; ++j)
+      {
+        t[j] ^= u[j];
+      }
+    }
+    memcpy(output + offset, t, std::min(digestSize, outputLength - offset));
+  }
+  return true;
+}
+
+
+/** \brief HKDF extract step (RFC 5869)
+ *
+ * \param salt          pointer to the salt, may be null if saltLength is 0
+ * \param saltLength    length of the salt in bytes, no salt means a salt
+ *                      of digestSize zero bytes
+ * \param ikm           pointer to the input keying material
+ * \param ikmLength     length of the input keying material in bytes
+ * \return Returns the pseudorandom key.
+ */
+template<typename HmacType>
+typename HmacType::MessageDigest hkdfExtract(const void* salt, const std::size_t saltLength,
+                                             const void* ikm, const std::size_t ikmLength)
+{
+  const uint8_t zeroSalt[HmacType::digestSize] = { 0 };
+  if (saltLength == 0)
+    return HmacType(zeroSalt, HmacType::digestSize).compute(ikm, ikmLength);
+  return HmacType(salt, saltLength).compute(ikm, ikmLength);
+}
+
+
+/** \brief HKDF expand step (RFC 5869)
+ *
+ * \param prk           pointer to the pseudorandom key, e.g. from hkdfExtract()
+ * \param prkLength     length of the pseudorandom key in bytes
+ * \param info          pointer to the context information
+ * \param infoLength    length of the context information in bytes
+ * \param output        buffer that receives the output keying material
+ * \param outputLength  length of the output keying material in bytes
+ * \return Returns true, if the output was computed.
+ *         Returns false, if outputLength is larger than 255 * digestSize.
+ */
+template<typename HmacType>
+bool hkdfExpand(const void* prk, const std::size_t prkLength,
+                const void* info, const std::size_t infoLength,
+                uint8_t* output, const std::size_t outputLength)
+{
+  constexpr std::size_t digestSize = HmacType::digestSize;
+  if (outputLength > 255 * digestSize)
+    return false;
+  HmacType hmac(prk, prkLength);
+  uint8_t t[digestSize];
+  for (std::size_t offset = 0, counter = 1; offset < outputLength; offset += digestSize, ++counter)
+  {
+    if (offset > 0)
+      hmac.update(t, digestSize);
+    hmac.update(info, infoLength);
+    const uint8_t c = static_cast<uint8_t>(counter);
+    hmac.update(&c, 1);
+    HmacType::toBytes(hmac.finalize(), t);
+    memcpy(output + offset, t, std::min(digestSize, outputLength - offset));
+  }
+  return true;
+}
+
+
+/** \brief derives keying material with HKDF (RFC 5869)
+ *
+ * \param salt          pointer to the salt
+ * \param saltLength    length of the salt in bytes
+ * \param ikm           pointer to the input keying material
+ * \param ikmLength     length of the input keying material in bytes
+ * \param info          pointer to the context information
+ * \param infoLength    length of the context information in bytes
+ * \param output        buffer that receives the output keying material
+ * \param outputLength  length of the output keying material in bytes
+ * \return Returns true, if the output was computed.
+ *         Returns false, if outputLength is larger than 255 * digestSize.
+ */
+template<typename HmacType>
+bool hkdf(const void* salt, const std::size_t saltLength,
+          const void* ikm, const std::size_t ikmLength,
+          const void* info, const std::size_t infoLength,
+          uint8_t* output, const std::size_t outputLength)
+{
+  uint8_t prk[HmacType::digestSize];
+  HmacType::toBytes(hkdfExtract<HmacType>(salt, saltLength, ikm, ikmLength), prk);
+  return hkdfExpand<HmacType>(prk, HmacType::digestSize, info, infoLength, output, outputLength);
+}
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_HMAC_HPP
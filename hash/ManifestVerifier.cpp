@@ -0,0 +1,324 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "ManifestVerifier.hpp"
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include "sha1/FileSourceUtility.hpp"
+#include "sha224/FileSourceUtility.hpp"
+#include "sha256/FileSourceUtility.hpp"
+#include "sha384/FileSourceUtility.hpp"
+#include "sha512/FileSourceUtility.hpp"
+
+namespace libstriezel::hash
+{
+
+/* checks whether a string is a valid hexadecimal digest of the given type */
+template<typename Digest>
+bool isValidDigest(const std::string_view hexDigest)
+{
+  Digest digest;
+  return digest.fromHexString(hexDigest);
+}
+
+/* compares a computed digest with the expected hexadecimal digest, a "null"
+   digest means that the file could not be read */
+template<typename Digest>
+VerifyStatus compareDigest(const Digest& computed, const std::string_view hexDigest)
+{
+  if (computed.isNull())
+    return VerifyStatus::ReadError;
+  Digest expected;
+  expected.fromHexString(hexDigest);
+  return (computed == expected) ? VerifyStatus::Match : VerifyStatus::Mismatch;
+}
+
+/* determines the algorithm from the length of a hexadecimal digest and
+   checks whether the digest is valid
+
+   parameters:
+       hexDigest - the digest
+       algorithm - receives the algorithm
+*/
+bool detectAlgorithm(const std::string_view hexDigest, DigestAlgorithm& algorithm)
+{
+  switch (hexDigest.size())
+  {
+    case 40:
+         algorithm = daSHA1;
+         return isValidDigest<SHA1::MessageDigest>(hexDigest);
+    case 56:
+         algorithm = daSHA224;
+         return isValidDigest<SHA224::MessageDigest>(hexDigest);
+    case 64:
+         algorithm = daSHA256;
+         return isValidDigest<SHA256::MessageDigest>(hexDigest);
+    case 96:
+         algorithm = daSHA384;
+         return isValidDigest<SHA384::MessageDigest>(hexDigest);
+    case 128:
+         algorithm = daSHA512;
+         return isValidDigest<SHA512::MessageDigest>(hexDigest);
+    default:
+         return false;
+  }//swi
+}
+
+/* gets the tag of the BSD format for an algorithm */
+std::string_view algorithmTag(const DigestAlgorithm algorithm)
+{
+  switch (algorithm)
+  {
+    case daSHA1:
+         return "SHA1";
+    case daSHA224:
+         return "SHA224";
+    case daSHA256:
+         return "SHA256";
+    case daSHA384:
+         return "SHA384";
+    case daSHA512:
+         return "SHA512";
+    default:
+         return "";
+  }//swi
+}
+
+/* replaces the escape sequences of an escaped file name
+
+   parameters:
+       escaped - the escaped file name
+       result  - receives the file name without escape sequences
+*/
+bool unescapeFileName(const std::string_view escaped, std::string& result)
+{
+  result.clear();
+  result.reserve(escaped.size());
+  for (std::size_t i = 0; i < escaped.size(); ++i)
+  {
+    if (escaped[i] != '\\')
+    {
+      result.push_back(escaped[i]);
+      continue;
+    }
+    if (i + 1 == escaped.size())
+      return false;
+    ++i;
+    if (escaped[i] == '\\')
+      result.push_back('\\');
+    else if (escaped[i] == 'n')
+      result.push_back('\n');
+    else if (escaped[i] == 'r')
+      result.push_back('\r');
+    else
+      return false;
+  }
+  return true;
+}
+
+Manifest::Manifest()
+: m_Mapping(),
+  m_Buffer(),
+  m_UnescapedNames(),
+  m_Entries(),
+  m_InvalidLines(0)
+{
+}
+
+bool Manifest::load(const std::string& fileName)
+{
+  m_Mapping.close();
+  m_Buffer.clear();
+  if (m_Mapping.open(fileName))
+  {
+    parse(std::string_view(reinterpret_cast<const char*>(m_Mapping.data()), m_Mapping.size()));
+    return true;
+  }
+  // pipes and other files that cannot be mapped
+  std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+  if (!stream.is_open())
+  {
+    parse(std::string_view());
+    return false;
+  }
+  m_Buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  if (stream.bad())
+  {
+    m_Buffer.clear();
+    parse(std::string_view());
+    return false;
+  }
+  parse(m_Buffer);
+  return true;
+}
+
+void Manifest::loadFromString(const std::string& content)
+{
+  m_Mapping.close();
+  m_Buffer = content;
+  parse(m_Buffer);
+}
+
+const std::vector<ManifestEntry>& Manifest::entries() const
+{
+  return m_Entries;
+}
+
+std::size_t Manifest::invalidLines() const
+{
+  return m_InvalidLines;
+}
+
+void Manifest::parse(std::string_view data)
+{
+  m_UnescapedNames.clear();
+  m_Entries.clear();
+  m_InvalidLines = 0;
+  std::size_t lineNumber = 0;
+  while (!data.empty())
+  {
+    ++lineNumber;
+    const char* end = static_cast<const char*>(memchr(data.data(), '\n', data.size()));
+    const std::size_t length = (end != nullptr) ? static_cast<std::size_t>(end - data.data()) : data.size();
+    if (!parseLine(data.substr(0, length), lineNumber))
+      ++m_InvalidLines;
+    data.remove_prefix((end != nullptr) ? length + 1 : length);
+  }
+}
+
+bool Manifest::parseLine(std::string_view line, const std::size_t lineNumber)
+{
+  if (!line.empty() && (line.back() == '\r'))
+    line.remove_suffix(1);
+  if (line.empty())
+    return true;
+  const bool escaped = line.front() == '\\';
+  if (escaped)
+    line.remove_prefix(1);
+
+  ManifestEntry entry;
+  entry.line = lineNumber;
+  const std::size_t tagEnd = line.find(" (");
+  const std::size_t nameEnd = line.rfind(") = ");
+  if ((line.compare(0, 3, "SHA") == 0) && (tagEnd != std::string_view::npos)
+      && (nameEnd != std::string_view::npos) && (nameEnd > tagEnd))
+  {
+    // BSD format: SHA256 (file name) = digest
+    entry.digest = line.substr(nameEnd + 4);
+    entry.fileName = line.substr(tagEnd + 2, nameEnd - tagEnd - 2);
+    if (!detectAlgorithm(entry.digest, entry.algorithm)
+        || (line.substr(0, tagEnd) != algorithmTag(entry.algorithm)))
+      return false;
+  }
+  else
+  {
+    // default format: digest, space, space or asterisk, file name
+    const std::size_t space = line.find(' ');
+    if ((space == std::string_view::npos) || (space + 2 >= line.size())
+        || ((line[space + 1] != ' ') && (line[space + 1] != '*')))
+      return false;
+    entry.digest = line.substr(0, space);
+    entry.fileName = line.substr(space + 2);
+    if (!detectAlgorithm(entry.digest, entry.algorithm))
+      return false;
+  }
+  if (entry.fileName.empty())
+    return false;
+  if (escaped)
+  {
+    std::string name;
+    if (!unescapeFileName(entry.fileName, name))
+      return false;
+    m_UnescapedNames.push_back(std::move(name));
+    entry.fileName = m_UnescapedNames.back();
+  }
+  m_Entries.push_back(entry);
+  return true;
+}
+
+/* hashes a file and compares the digest with the manifest entry */
+VerifyStatus verifyEntry(const ManifestEntry& entry, const std::string& baseDirectory)
+{
+  std::string fileName(entry.fileName);
+  if (!baseDirectory.empty() && (fileName[0] != '/'))
+    fileName = baseDirectory + "/" + fileName;
+  switch (entry.algorithm)
+  {
+    case daSHA1:
+         return compareDigest(SHA1::computeFromFile(fileName), entry.digest);
+    case daSHA224:
+         return compareDigest(SHA224::computeFromFile(fileName), entry.digest);
+    case daSHA256:
+         return compareDigest(SHA256::computeFromFile(fileName), entry.digest);
+    case daSHA384:
+         return compareDigest(SHA384::computeFromFile(fileName), entry.digest);
+    case daSHA512:
+         return compareDigest(SHA512::computeFromFile(fileName), entry.digest);
+    default:
+         return VerifyStatus::ReadError;
+  }//swi
+}
+
+bool verifyManifest(const Manifest& manifest, const VerifyOptions& options, std::vector<VerifyStatus>& results)
+{
+  const std::vector<ManifestEntry>& entries = manifest.entries();
+  results.assign(entries.size(), VerifyStatus::Skipped);
+  if (entries.empty())
+    return true;
+
+  unsigned int threads = (options.maxConcurrentFiles != 0) ? options.maxConcurrentFiles : std::thread::hardware_concurrency();
+  if (threads == 0)
+    threads = 1;
+  if (threads > entries.size())
+    threads = static_cast<unsigned int>(entries.size());
+
+  // Every worker reads one file at a time, so the number of workers limits
+  // the number of files that are read concurrently.
+  std::atomic<std::size_t> nextEntry(0);
+  std::atomic<bool> failed(false);
+  const auto work = [&]()
+  {
+    while (!(options.failFast && failed.load(std::memory_order_relaxed)))
+    {
+      const std::size_t index = nextEntry.fetch_add(1, std::memory_order_relaxed);
+      if (index >= entries.size())
+        return;
+      results[index] = verifyEntry(entries[index], options.baseDirectory);
+      if (results[index] != VerifyStatus::Match)
+        failed.store(true, std::memory_order_relaxed);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (unsigned int t = 1; t < threads; ++t)
+  {
+    workers.emplace_back(work);
+  }
+  work();
+  for (std::thread& worker : workers)
+  {
+    worker.join();
+  }
+  return !failed.load();
+}
+
+} //namespace
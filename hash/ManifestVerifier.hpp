@@ -0,0 +1,156 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_MANIFESTVERIFIER_HPP
+#define LIBSTRIEZEL_HASH_MANIFESTVERIFIER_HPP
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "MappedFile.hpp"
+#include "MultiDigest.hpp"
+
+namespace libstriezel::hash
+{
+
+/// a single line of a checksum manifest
+struct ManifestEntry
+{
+  DigestAlgorithm algorithm; /**< algorithm, derived from the digest length */
+  std::string_view digest;   /**< expected digest as hexadecimal string */
+  std::string_view fileName; /**< name of the file */
+  std::size_t line;          /**< line number within the manifest, starting at one */
+};
+
+
+/** \brief checksum manifest as created by sha256sum, sha512sum and related
+ *         programs
+ *
+ * Both the default format ("digest  file name", or "digest *file name" for
+ * binary mode) and the BSD format ("SHA256 (file name) = digest") are
+ * supported. Lines that start with a backslash have escaped file names.
+ * The algorithm of each line is determined by the length of the digest, so
+ * manifests of sha1sum, sha224sum and sha384sum work, too.
+ *
+ * The manifest data is kept in memory (memory-mapped, if possible) and the
+ * entries point directly into it, so parsing does not copy the lines.
+ */
+class Manifest
+{
+  public:
+    /** \brief constructor - creates an empty manifest */
+    Manifest();
+
+
+    Manifest(const Manifest& other) = delete;
+    Manifest& operator=(const Manifest& other) = delete;
+
+
+    /** \brief loads and parses a manifest file
+     *
+     * \param fileName  name of the manifest file
+     * \return Returns true, if the file could be read.
+     *         Returns false otherwise.
+     * \remarks Lines that cannot be parsed are counted, but do not cause
+     *          failure, see invalidLines().
+     */
+    bool load(const std::string& fileName);
+
+
+    /** \brief parses a manifest that is already in memory
+     *
+     * \param content  the content of the manifest, it is copied
+     */
+    void loadFromString(const std::string& content);
+
+
+    /** \brief gets the entries of the manifest
+     *
+     * \return Returns the entries in the order of the manifest.
+     */
+    const std::vector<ManifestEntry>& entries() const;
+
+
+    /** \brief gets the number of lines that could not be parsed
+     *
+     * \return Returns the number of non-empty lines that are no valid
+     *         manifest entries.
+     */
+    std::size_t invalidLines() const;
+  private:
+    /** \brief splits the data into lines and parses them */
+    void parse(std::string_view data);
+
+
+    /** \brief parses a single line and adds it to the entries, if it is valid */
+    bool parseLine(std::string_view line, const std::size_t lineNumber);
+
+
+    MappedFile m_Mapping; /**< mapping of the manifest file */
+    std::string m_Buffer; /**< manifest data, if it is not mapped */
+    std::deque<std::string> m_UnescapedNames; /**< storage for escaped file names */
+    std::vector<ManifestEntry> m_Entries; /**< parsed entries */
+    std::size_t m_InvalidLines; /**< number of lines that are not valid */
+}; //class
+
+
+/// result of the verification of a single file
+enum class VerifyStatus
+{
+  Match,     /**< the digest of the file matches the manifest */
+  Mismatch,  /**< the digest of the file differs from the manifest */
+  ReadError, /**< the file could not be read */
+  Skipped    /**< the file was not checked due to an earlier failure */
+};
+
+
+/// options for the verification of a manifest
+struct VerifyOptions
+{
+  unsigned int maxConcurrentFiles = 0; /**< maximum number of files that are
+                                            read at the same time, zero means
+                                            one per processor */
+  bool failFast = false;               /**< whether to stop at the first file
+                                            that does not match */
+  std::string baseDirectory;           /**< directory that relative file names
+                                            refer to, empty means the current
+                                            working directory */
+};
+
+
+/** \brief checks the files of a manifest
+ *
+ * \param manifest  the manifest
+ * \param options   options for the verification
+ * \param results   receives the status of every entry, in the order of the
+ *                  entries of the manifest
+ * \return Returns true, if all files match the manifest.
+ *         Returns false otherwise.
+ * \remarks The files are hashed in parallel. With failFast, the first file
+ *          that does not match or cannot be read stops the verification and
+ *          the files that were not checked yet get the status Skipped.
+ */
+bool verifyManifest(const Manifest& manifest, const VerifyOptions& options, std::vector<VerifyStatus>& results);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_MANIFESTVERIFIER_HPP
@@ -0,0 +1,112 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "MappedFile.hpp"
+#include <limits>
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace libstriezel::hash
+{
+
+MappedFile::MappedFile()
+: m_Mapping(nullptr), m_Size(0), m_Open(false)
+{
+}
+
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+bool MappedFile::open(const std::string& fileName)
+{
+  if (m_Open)
+    return false;
+  #if !defined(_WIN32)
+  const int fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1)
+    return false;
+  struct stat buffer;
+  if ((fstat(fd, &buffer) != 0) || !S_ISREG(buffer.st_mode)
+      || (static_cast<uint64_t>(buffer.st_size) > std::numeric_limits<std::size_t>::max()))
+  {
+    ::close(fd);
+    return false;
+  }
+  m_Size = static_cast<std::size_t>(buffer.st_size);
+  if (m_Size == 0)
+  {
+    // mmap() does not allow empty mappings
+    ::close(fd);
+    m_Mapping = nullptr;
+    m_Open = true;
+    return true;
+  }
+  void* mapping = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid after the file descriptor is closed.
+  ::close(fd);
+  if (mapping == MAP_FAILED)
+  {
+    m_Size = 0;
+    return false;
+  }
+  // The hint is only an optimization, so failure can be ignored.
+  madvise(mapping, m_Size, MADV_SEQUENTIAL);
+  m_Mapping = mapping;
+  m_Open = true;
+  return true;
+  #else
+  (void) fileName;
+  return false;
+  #endif
+}
+
+void MappedFile::close()
+{
+  #if !defined(_WIN32)
+  if (m_Mapping != nullptr)
+    munmap(m_Mapping, m_Size);
+  #endif
+  m_Mapping = nullptr;
+  m_Size = 0;
+  m_Open = false;
+}
+
+bool MappedFile::isOpen() const
+{
+  return m_Open;
+}
+
+const uint8_t* MappedFile::data() const
+{
+  return static_cast<const uint8_t*>(m_Mapping);
+}
+
+std::size_t MappedFile::size() const
+{
+  return m_Size;
+}
+
+} //namespace
@@ -0,0 +1,97 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_MAPPEDFILE_HPP
+#define LIBSTRIEZEL_HASH_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+
+namespace libstriezel::hash
+{
+
+/** \brief read-only memory mapping of a whole file
+ *
+ * \remarks Only regular files can be mapped. The mapping uses the hint for
+ *          sequential access, because the hash functions read the data
+ *          exactly once from start to end. If the file is truncated by
+ *          another process while it is mapped, accessing the data may cause
+ *          a SIGBUS signal.
+ */
+class MappedFile
+{
+  public:
+    /** \brief constructor */
+    MappedFile();
+
+
+    /** \brief destructor - unmaps the file, if it is still mapped */
+    ~MappedFile();
+
+
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile& operator=(const MappedFile& other) = delete;
+
+
+    /** \brief maps the given file into memory
+     *
+     * \param fileName  name (absolute or relative path) of the file
+     * \return Returns true, if the file was mapped successfully.
+     *         Returns false, if the file could not be opened, is not a
+     *         regular file, is too large for the address space or if memory
+     *         mapping is not supported on this platform.
+     */
+    bool open(const std::string& fileName);
+
+
+    /** \brief unmaps the file */
+    void close();
+
+
+    /** \brief checks whether a file is currently mapped
+     *
+     * \return Returns true, if a file is mapped.
+     */
+    bool isOpen() const;
+
+
+    /** \brief gets a pointer to the file content
+     *
+     * \return Returns a pointer to the mapped data.
+     *         Returns nullptr, if no file is mapped or the file is empty.
+     */
+    const uint8_t* data() const;
+
+
+    /** \brief gets the size of the mapped file
+     *
+     * \return Returns the file size in bytes.
+     */
+    std::size_t size() const;
+  private:
+    void* m_Mapping;     /**< start address of the mapping */
+    std::size_t m_Size;  /**< size of the file in bytes */
+    bool m_Open;         /**< whether a file is mapped */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_MAPPEDFILE_HPP
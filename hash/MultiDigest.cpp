@@ -0,0 +1,157 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "MultiDigest.hpp"
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "MappedFile.hpp"
+#include "ReadAheadReader.hpp"
+#include "sha1/Hasher.hpp"
+#include "sha224/Hasher.hpp"
+#include "sha256/Hasher.hpp"
+#include "sha384/Hasher.hpp"
+#include "sha512/Hasher.hpp"
+
+namespace libstriezel::hash
+{
+
+/* Below this size the start of threads costs more than it saves. */
+const std::size_t minimumParallelLength = 256 * 1024;
+
+/* hashes the data with the hasher of type H and stores the digest
+
+   parameters:
+       data   - pointer to the message data
+       length - length of the message in bytes
+       digest - the variable that receives the message digest
+*/
+template<typename H, typename D>
+void hashInto(const void* data, const std::size_t length, D& digest)
+{
+  H hasher;
+  hasher.update(data, length);
+  digest = hasher.finalize();
+}
+
+/* returns the tasks that compute the requested digests of the data */
+std::vector<std::function<void()> > createTasks(const void* data, const std::size_t length, const unsigned int algorithms, MultiDigest& result)
+{
+  std::vector<std::function<void()> > tasks;
+  // longest running algorithms first, SHA-1 and SHA-256 may use SHA-NI
+  if ((algorithms & daSHA512) != 0)
+    tasks.push_back([&result, data, length]() { hashInto<SHA512::Hasher>(data, length, result.sha512); });
+  if ((algorithms & daSHA384) != 0)
+    tasks.push_back([&result, data, length]() { hashInto<SHA384::Hasher>(data, length, result.sha384); });
+  if ((algorithms & daSHA256) != 0)
+    tasks.push_back([&result, data, length]() { hashInto<SHA256::Hasher>(data, length, result.sha256); });
+  if ((algorithms & daSHA224) != 0)
+    tasks.push_back([&result, data, length]() { hashInto<SHA224::Hasher>(data, length, result.sha224); });
+  if ((algorithms & daSHA1) != 0)
+    tasks.push_back([&result, data, length]() { hashInto<SHA1::Hasher>(data, length, result.sha1); });
+  return tasks;
+}
+
+MultiDigest computeFromBuffer(const void* data, const std::size_t length, const unsigned int algorithms, const unsigned int maxThreads)
+{
+  MultiDigest result;
+  const std::vector<std::function<void()> > tasks = createTasks(data, length, algorithms, result);
+  unsigned int threads = (maxThreads != 0) ? maxThreads : std::thread::hardware_concurrency();
+  if (length < minimumParallelLength)
+    threads = 1;
+  // Tasks are distributed round-robin, task i runs on thread i % threads.
+  std::vector<std::thread> workers;
+  for (unsigned int t = 1; (t < threads) && (t < tasks.size()); ++t)
+  {
+    workers.emplace_back([&tasks, t, threads]()
+    {
+      for (std::size_t i = t; i < tasks.size(); i += threads)
+      {
+        tasks[i]();
+      }
+    });
+  }
+  const std::size_t step = workers.empty() ? 1 : threads;
+  for (std::size_t i = 0; i < tasks.size(); i += step)
+  {
+    tasks[i]();
+  }
+  for (std::thread& worker : workers)
+  {
+    worker.join();
+  }
+  return result;
+}
+
+MultiDigest computeFromFile(const std::string& fileName, const unsigned int algorithms, const unsigned int maxThreads)
+{
+  MappedFile mapped;
+  if (mapped.open(fileName))
+  {
+    return computeFromBuffer(mapped.data(), mapped.size(), algorithms, maxThreads);
+  }
+
+  ReadAheadReader reader;
+  if (!reader.open(fileName))
+  {
+    std::cout << "Could not open file \""<<fileName<<"\" for reading!\n";
+    return MultiDigest();
+  }
+  SHA1::Hasher sha1;
+  SHA224::Hasher sha224;
+  SHA256::Hasher sha256;
+  SHA384::Hasher sha384;
+  SHA512::Hasher sha512;
+  const uint8_t* data = nullptr;
+  std::size_t length = 0;
+  while (reader.next(data, length))
+  {
+    if ((algorithms & daSHA1) != 0)
+      sha1.update(data, length);
+    if ((algorithms & daSHA224) != 0)
+      sha224.update(data, length);
+    if ((algorithms & daSHA256) != 0)
+      sha256.update(data, length);
+    if ((algorithms & daSHA384) != 0)
+      sha384.update(data, length);
+    if ((algorithms & daSHA512) != 0)
+      sha512.update(data, length);
+  }
+  if (reader.failed())
+  {
+    std::cout << "Could not read file \""<<fileName<<"\"!\n";
+    return MultiDigest();
+  }
+  MultiDigest result;
+  if ((algorithms & daSHA1) != 0)
+    result.sha1 = sha1.finalize();
+  if ((algorithms & daSHA224) != 0)
+    result.sha224 = sha224.finalize();
+  if ((algorithms & daSHA256) != 0)
+    result.sha256 = sha256.finalize();
+  if ((algorithms & daSHA384) != 0)
+    result.sha384 = sha384.finalize();
+  if ((algorithms & daSHA512) != 0)
+    result.sha512 = sha512.finalize();
+  return result;
+}
+
+} //namespace
@@ -0,0 +1,93 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_MULTIDIGEST_HPP
+#define LIBSTRIEZEL_HASH_MULTIDIGEST_HPP
+
+#include <cstddef>
+#include <string>
+#include "sha1/sha1.hpp"
+#include "sha224/sha224.hpp"
+#include "sha256/sha256.hpp"
+#include "sha384/sha384.hpp"
+#include "sha512/sha512.hpp"
+
+namespace libstriezel::hash
+{
+
+/// flags for the algorithms of a multi-digest computation
+enum DigestAlgorithm : unsigned int
+{
+  daSHA1   = 1 << 0, /**< SHA-1 */
+  daSHA224 = 1 << 1, /**< SHA-224 */
+  daSHA256 = 1 << 2, /**< SHA-256 */
+  daSHA384 = 1 << 3, /**< SHA-384 */
+  daSHA512 = 1 << 4, /**< SHA-512 */
+  daAll    = daSHA1 | daSHA224 | daSHA256 | daSHA384 | daSHA512 /**< all of the above */
+};
+
+
+/// message digests of several algorithms for the same data
+struct MultiDigest
+{
+  SHA1::MessageDigest sha1;     /**< SHA-1 message digest */
+  SHA224::MessageDigest sha224; /**< SHA-224 message digest */
+  SHA256::MessageDigest sha256; /**< SHA-256 message digest */
+  SHA384::MessageDigest sha384; /**< SHA-384 message digest */
+  SHA512::MessageDigest sha512; /**< SHA-512 message digest */
+};
+
+
+/** \brief computes the message digests of several algorithms for a buffer
+ *
+ * \param data        pointer to the message data
+ * \param length      length of the message in bytes
+ * \param algorithms  the requested algorithms, a combination of the
+ *                    DigestAlgorithm flags
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns the message digests. Digests of algorithms that were not
+ *         requested are "null" message digests (i.e. all bits set to zero).
+ * \remarks Large buffers are hashed with one thread per algorithm, as long
+ *          as maxThreads allows it.
+ */
+MultiDigest computeFromBuffer(const void* data, const std::size_t length, const unsigned int algorithms, const unsigned int maxThreads = 0);
+
+
+/** \brief computes the message digests of several algorithms for a file,
+ *         reading the file only once
+ *
+ * \param fileName    name of the file
+ * \param algorithms  the requested algorithms, a combination of the
+ *                    DigestAlgorithm flags
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns the message digests on success. Digests of algorithms
+ *         that were not requested are "null" message digests.
+ *         Returns "null" message digests for all algorithms, if an error
+ *         occurred.
+ * \remarks Regular files are memory-mapped and hashed like a buffer. Other
+ *          files are read once and every buffer is passed to all algorithms.
+ */
+MultiDigest computeFromFile(const std::string& fileName, const unsigned int algorithms, const unsigned int maxThreads = 0);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_MULTIDIGEST_HPP
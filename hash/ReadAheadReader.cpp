@@ -0,0 +1,293 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "ReadAheadReader.hpp"
+#include <algorithm>
+#if !defined(_WIN32)
+  #include <cerrno>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace libstriezel::hash
+{
+
+/* rounds the read size up to a multiple of the alignment, if needed */
+std::size_t effectiveReadSize(const std::size_t readSize, const CacheMode cacheMode)
+{
+  const std::size_t size = std::max<std::size_t>(readSize, 1);
+  if (cacheMode == CacheMode::Normal)
+    return size;
+  const std::size_t alignment = ReadAheadReader::bufferAlignment;
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+ReadAheadReader::ReadAheadReader(const std::size_t readSize, const unsigned int queueDepth, const CacheMode cacheMode)
+: m_ReadSize(effectiveReadSize(readSize, cacheMode)),
+  m_Buffers(std::max(queueDepth, 2u)),
+  m_Lengths(m_Buffers.size(), 0),
+  m_Head(0),
+  m_Filled(0),
+  m_Holding(false),
+  m_Done(false),
+  m_Failed(false),
+  m_Stop(false),
+  m_CacheMode(cacheMode),
+  m_Stream(),
+  m_Input(nullptr),
+  m_Descriptor(-1),
+  m_OwnsDescriptor(false),
+  m_Direct(false),
+  m_Offset(0),
+  m_Dropped(0),
+  m_Mutex(),
+  m_DataAvailable(),
+  m_SpaceAvailable(),
+  m_Thread()
+{
+}
+
+ReadAheadReader::~ReadAheadReader()
+{
+  stop();
+}
+
+bool ReadAheadReader::open(const std::string& fileName)
+{
+  if ((m_Input != nullptr) || (m_Descriptor >= 0) || m_Thread.joinable())
+    return false;
+  #if !defined(_WIN32)
+  if (m_CacheMode == CacheMode::Bypass)
+  {
+    #if defined(O_DIRECT)
+    // Not every file system supports O_DIRECT, e.g. tmpfs does not.
+    m_Descriptor = ::open(fileName.c_str(), O_RDONLY | O_DIRECT);
+    m_Direct = (m_Descriptor >= 0);
+    #endif
+    if (m_Descriptor < 0)
+      m_Descriptor = ::open(fileName.c_str(), O_RDONLY);
+    if (m_Descriptor < 0)
+      return false;
+    m_OwnsDescriptor = true;
+    #if defined(F_NOCACHE)
+    fcntl(m_Descriptor, F_NOCACHE, 1);
+    #endif
+    #if defined(POSIX_FADV_SEQUENTIAL)
+    if (!m_Direct)
+      posix_fadvise(m_Descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+    #endif
+    m_Offset = 0;
+    m_Dropped = 0;
+  }
+  #endif
+  if (m_Descriptor < 0)
+  {
+    m_Stream.open(fileName, std::ios_base::in | std::ios_base::binary);
+    if (!m_Stream.good())
+      return false;
+    m_Input = &m_Stream;
+  }
+  start();
+  return true;
+}
+
+bool ReadAheadReader::open(const int descriptor)
+{
+  #if !defined(_WIN32)
+  if ((descriptor < 0) || (m_Input != nullptr) || (m_Descriptor >= 0) || m_Thread.joinable())
+    return false;
+  m_Descriptor = descriptor;
+  m_OwnsDescriptor = false;
+  m_Direct = false;
+  m_Offset = 0;
+  m_Dropped = 0;
+  start();
+  return true;
+  #else
+  (void) descriptor;
+  return false;
+  #endif
+}
+
+bool ReadAheadReader::open(std::istream& stream)
+{
+  if (!stream.good() || (m_Input != nullptr) || (m_Descriptor >= 0) || m_Thread.joinable())
+    return false;
+  m_Input = &stream;
+  start();
+  return true;
+}
+
+void ReadAheadReader::start()
+{
+  for (auto& buffer : m_Buffers)
+  {
+    // extra space to align the start of the buffer
+    buffer.resize(m_ReadSize + bufferAlignment);
+  }
+  m_Thread = std::thread(&ReadAheadReader::readLoop, this);
+}
+
+void ReadAheadReader::readLoop()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while (true)
+  {
+    m_SpaceAvailable.wait(lock, [this] { return m_Stop || (m_Filled < m_Buffers.size()); });
+    if (m_Stop)
+      break;
+    const std::size_t slot = (m_Head + m_Filled) % m_Buffers.size();
+    // The consumer never touches a buffer that is not filled yet, so the
+    // read itself does not need the lock.
+    lock.unlock();
+    bool endOfFile = false;
+    bool failed = false;
+    const std::size_t bytesRead = readBlock(bufferData(slot), endOfFile, failed);
+    lock.lock();
+    m_Lengths[slot] = bytesRead;
+    if (bytesRead > 0)
+      ++m_Filled;
+    m_Failed = failed;
+    m_Done = endOfFile || failed;
+    m_DataAvailable.notify_one();
+    if (m_Done)
+      break;
+  } //while
+  if (m_Stream.is_open())
+    m_Stream.close();
+  #if !defined(_WIN32)
+  if (m_OwnsDescriptor)
+    ::close(m_Descriptor);
+  #endif
+}
+
+std::size_t ReadAheadReader::readBlock(uint8_t* buffer, bool& endOfFile, bool& failed)
+{
+  if (m_Descriptor >= 0)
+    return readDescriptor(buffer, endOfFile, failed);
+  m_Input->read(reinterpret_cast<char*>(buffer), m_ReadSize);
+  endOfFile = m_Input->eof();
+  failed = m_Input->bad() || (!endOfFile && m_Input->fail());
+  return static_cast<std::size_t>(m_Input->gcount());
+}
+
+std::size_t ReadAheadReader::readDescriptor(uint8_t* buffer, bool& endOfFile, bool& failed)
+{
+  std::size_t total = 0;
+  #if !defined(_WIN32)
+  // Reads may be interrupted or return less data than requested, so keep
+  // on reading until the buffer is full or the end of the file is reached.
+  while (total < m_ReadSize)
+  {
+    const ssize_t bytesRead = ::read(m_Descriptor, buffer + total, m_ReadSize - total);
+    if (bytesRead > 0)
+    {
+      total += static_cast<std::size_t>(bytesRead);
+      continue;
+    }
+    if (bytesRead == 0)
+    {
+      endOfFile = true;
+      break;
+    }
+    if (errno == EINTR)
+      continue;
+    #if defined(O_DIRECT)
+    // After a short read the file offset is no longer aligned, and some
+    // file systems only reject O_DIRECT on the first read. Continue with
+    // buffered reads in both cases.
+    if ((errno == EINVAL) && m_Direct)
+    {
+      const int flags = fcntl(m_Descriptor, F_GETFL);
+      if ((flags != -1) && (fcntl(m_Descriptor, F_SETFL, flags & ~O_DIRECT) != -1))
+      {
+        m_Direct = false;
+        continue;
+      }
+    }
+    #endif
+    failed = true;
+    break;
+  } //while
+  m_Offset += total;
+  #if defined(POSIX_FADV_DONTNEED)
+  if ((m_CacheMode == CacheMode::Bypass) && !m_Direct && (m_Offset > m_Dropped))
+  {
+    // The data has been copied to the buffer, so the pages are not needed
+    // anymore. A partial page at the end is dropped by the next call.
+    posix_fadvise(m_Descriptor, static_cast<off_t>(m_Dropped), static_cast<off_t>(m_Offset - m_Dropped), POSIX_FADV_DONTNEED);
+    m_Dropped = m_Offset / bufferAlignment * bufferAlignment;
+  }
+  #endif
+  #else
+  (void) buffer;
+  (void) endOfFile;
+  failed = true;
+  #endif
+  return total;
+}
+
+uint8_t* ReadAheadReader::bufferData(const std::size_t slot)
+{
+  uint8_t* data = m_Buffers[slot].data();
+  const std::size_t misalignment = reinterpret_cast<uintptr_t>(data) % bufferAlignment;
+  return (misalignment == 0) ? data : data + (bufferAlignment - misalignment);
+}
+
+bool ReadAheadReader::next(const uint8_t*& data, std::size_t& length)
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  if (m_Holding)
+  {
+    // release the buffer of the previous call
+    m_Head = (m_Head + 1) % m_Buffers.size();
+    --m_Filled;
+    m_Holding = false;
+    m_SpaceAvailable.notify_one();
+  }
+  if (!m_Thread.joinable())
+    return false;
+  m_DataAvailable.wait(lock, [this] { return m_Done || (m_Filled > 0); });
+  if (m_Failed || (m_Filled == 0))
+    return false;
+  data = bufferData(m_Head);
+  length = m_Lengths[m_Head];
+  m_Holding = true;
+  return true;
+}
+
+bool ReadAheadReader::failed() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Failed;
+}
+
+void ReadAheadReader::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stop = true;
+  }
+  m_SpaceAvailable.notify_one();
+  if (m_Thread.joinable())
+    m_Thread.join();
+}
+
+} //namespace
@@ -0,0 +1,198 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_READAHEADREADER_HPP
+#define LIBSTRIEZEL_HASH_READAHEADREADER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libstriezel::hash
+{
+
+/// how a reader uses the page cache of the operating system
+enum class CacheMode
+{
+  Normal, /**< buffered reads, the data stays in the page cache */
+  Bypass  /**< reads around the page cache with O_DIRECT, if the file system
+               supports it, or drops the pages behind the read position from
+               the cache otherwise */
+};
+
+
+/** \brief reads a file in a separate thread, so that reading and hashing
+ *         overlap
+ *
+ * The reader thread fills a ring of buffers while the consumer processes
+ * the data of the buffers that are already filled.
+ */
+class ReadAheadReader
+{
+  public:
+    /// default size of a single read in bytes
+    static constexpr std::size_t defaultReadSize = 1024 * 1024;
+
+    /// default number of buffers
+    static constexpr unsigned int defaultQueueDepth = 4;
+
+    /// alignment of the buffers, and of the read size when the cache is
+    /// bypassed, in bytes
+    static constexpr std::size_t bufferAlignment = 4096;
+
+
+    /** \brief constructor
+     *
+     * \param readSize    size of a single read and of each buffer in bytes
+     * \param queueDepth  number of buffers, at least two buffers are used
+     * \param cacheMode   whether the data shall stay in the page cache
+     * \remarks When the cache is bypassed, the read size is rounded up to a
+     *          multiple of bufferAlignment. Bypassing the cache keeps bulk
+     *          scans from evicting the data of other processes, the reader
+     *          thread makes up for the missing read-ahead of the kernel.
+     */
+    ReadAheadReader(const std::size_t readSize = defaultReadSize, const unsigned int queueDepth = defaultQueueDepth,
+                    const CacheMode cacheMode = CacheMode::Normal);
+
+
+    /** \brief destructor - stops the reader thread */
+    ~ReadAheadReader();
+
+
+    ReadAheadReader(const ReadAheadReader& other) = delete;
+    ReadAheadReader& operator=(const ReadAheadReader& other) = delete;
+
+
+    /** \brief opens the given file and starts reading from it
+     *
+     * \param fileName  name (absolute or relative path) of the file
+     * \return Returns true, if the file was opened.
+     *         Returns false, if the file could not be opened or if a file
+     *         was already opened before.
+     */
+    bool open(const std::string& fileName);
+
+
+    /** \brief starts reading from an open file descriptor, e.g. a pipe
+     *
+     * \param descriptor  the file descriptor, it is not closed by the reader
+     * \return Returns true, if reading was started.
+     *         Returns false, if the descriptor is invalid, if reading was
+     *         already started before or if file descriptors are not
+     *         supported on this platform.
+     * \remarks Interrupted and short reads are retried, so each piece of
+     *          data except for the last one has the full read size. The
+     *          destructor waits for a pending read, so the writing end of a
+     *          pipe should be closed before the reader is destroyed.
+     */
+    bool open(const int descriptor);
+
+
+    /** \brief starts reading from a stream, e.g. std::cin
+     *
+     * \param stream  the stream, it has to exist as long as the reader
+     * \return Returns true, if reading was started.
+     *         Returns false, if the stream is not good or if reading was
+     *         already started before.
+     */
+    bool open(std::istream& stream);
+
+
+    /** \brief gets the next piece of the file
+     *
+     * \param data    will be set to the start of the data
+     * \param length  will be set to the length of the data in bytes
+     * \return Returns true, if there was more data.
+     *         Returns false, if the end of the file was reached or if an
+     *         error occurred. Use failed() to distinguish those cases.
+     * \remarks The data stays valid until the next call of next().
+     */
+    bool next(const uint8_t*& data, std::size_t& length);
+
+
+    /** \brief checks whether a read error occurred
+     *
+     * \return Returns true, if reading from the file failed.
+     */
+    bool failed() const;
+  private:
+    /** \brief function of the reader thread */
+    void readLoop();
+
+    /** \brief allocates the buffers and starts the reader thread */
+    void start();
+
+    /** \brief reads the next piece of the file into a buffer
+     *
+     * \param buffer     the buffer, at least m_ReadSize bytes
+     * \param endOfFile  will be set to true, if the end of file was reached
+     * \param failed     will be set to true, if an error occurred
+     * \return Returns the number of bytes that were read.
+     */
+    std::size_t readBlock(uint8_t* buffer, bool& endOfFile, bool& failed);
+
+    /** \brief reads from the file descriptor, used when bypassing the cache
+     *
+     * \param buffer     the buffer, at least m_ReadSize bytes
+     * \param endOfFile  will be set to true, if the end of file was reached
+     * \param failed     will be set to true, if an error occurred
+     * \return Returns the number of bytes that were read.
+     */
+    std::size_t readDescriptor(uint8_t* buffer, bool& endOfFile, bool& failed);
+
+    /** \brief gets the aligned start of a buffer */
+    uint8_t* bufferData(const std::size_t slot);
+
+    /** \brief stops the reader thread and waits for it */
+    void stop();
+
+    std::size_t m_ReadSize;                    /**< size of a single read */
+    std::vector<std::vector<uint8_t> > m_Buffers; /**< ring of buffers */
+    std::vector<std::size_t> m_Lengths;        /**< data length per buffer */
+    std::size_t m_Head;       /**< index of the next buffer for the consumer */
+    std::size_t m_Filled;     /**< number of filled buffers, starting at m_Head */
+    bool m_Holding;           /**< whether the consumer uses the head buffer */
+    bool m_Done;              /**< whether the reader has finished */
+    bool m_Failed;            /**< whether a read error occurred */
+    bool m_Stop;              /**< whether the reader shall stop early */
+    CacheMode m_CacheMode;    /**< whether the page cache shall be used */
+    std::ifstream m_Stream;   /**< the file stream, if the cache is used */
+    std::istream* m_Input;    /**< the stream that is read, or nullptr */
+    int m_Descriptor;         /**< the file descriptor that is read, or -1 */
+    bool m_OwnsDescriptor;    /**< whether the descriptor has to be closed */
+    bool m_Direct;            /**< whether the descriptor uses O_DIRECT */
+    uint64_t m_Offset;        /**< number of bytes read from the descriptor */
+    uint64_t m_Dropped;       /**< pages before this offset were dropped from
+                                   the cache */
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_DataAvailable;  /**< signals new data */
+    std::condition_variable m_SpaceAvailable; /**< signals free buffers */
+    std::thread m_Thread;     /**< the reader thread */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_HASH_READAHEADREADER_HPP
@@ -0,0 +1,200 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "BufferSourceUtility.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "compression.hpp"
+#include "Hasher.hpp"
+#include "../HexEncoding.hpp"
+
+namespace BLAKE3
+{
+
+/* number of chunks in the subtree that is hashed by a thread at once */
+const std::size_t chunksPerSubtree = 64;
+
+/* number of chunks or parent nodes that are passed to hashMany() at once */
+const std::size_t inputsPerBatch = 16;
+
+MessageDigest computeFromBuffer(const uint8_t* data, const uint64_t data_length_in_bits)
+{
+  Hasher hasher;
+  //only full bytes are used, the length is rounded up like in SHA256
+  hasher.update(data, static_cast<std::size_t>((data_length_in_bits / 8) + ((data_length_in_bits % 8) > 0)));
+  return hasher.finalize();
+}
+
+/* computes the chaining value of a chunk that is not the root
+
+   parameters:
+       data    - pointer to the chunk data
+       length  - length of the chunk in bytes, at most one chunk
+       counter - index of the chunk
+       cv      - receives the chaining value
+*/
+void chunkChainingValue(const uint8_t* data, const std::size_t length, const uint64_t counter, uint32_t cv[8])
+{
+  memcpy(cv, initialValue, 32);
+  const std::size_t blocks = (length == 0) ? 1 : (length + blockLength - 1) / blockLength;
+  for (std::size_t i = 0; i < blocks; ++i)
+  {
+    uint8_t block[64] = { 0 };
+    const std::size_t count = std::min(blockLength, length - i * blockLength);
+    memcpy(block, data + i * blockLength, count);
+    const uint8_t flags = ((i == 0) ? flagChunkStart : 0) | ((i + 1 == blocks) ? flagChunkEnd : 0);
+    compressInPlace(cv, block, static_cast<uint8_t>(count), counter, flags);
+  }
+}
+
+/* merges the chaining values of one level of the tree pairwise, until only
+   one is left
+
+   parameters:
+       cvs   - the chaining values as little endian bytes, 32 per value,
+               receives the result in the first 32 bytes
+       count - number of chaining values, at least one
+       root  - whether the last parent is the root of the whole tree
+*/
+void mergeChainingValues(uint8_t* cvs, std::size_t count, const bool root)
+{
+  // An odd chaining value at the end of a level is moved up unchanged, which
+  // yields the left-complete tree of BLAKE3.
+  while (count > 2)
+  {
+    const std::size_t pairs = count / 2;
+    for (std::size_t first = 0; first < pairs; first += inputsPerBatch)
+    {
+      const std::size_t n = std::min(inputsPerBatch, pairs - first);
+      const uint8_t* inputs[inputsPerBatch];
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        inputs[i] = cvs + 64 * (first + i);
+      }
+      uint32_t out[8 * inputsPerBatch];
+      hashMany(inputs, n, 1, initialValue, 0, false, flagParent, 0, 0, out);
+      // pair i is stored at position i, which has already been read
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        storeChainingValue(out + 8 * i, cvs + 32 * (first + i));
+      }
+    }
+    if ((count % 2) != 0)
+      memmove(cvs + 32 * pairs, cvs + 32 * (count - 1), 32);
+    count = pairs + (count % 2);
+  }
+  if (count == 2)
+  {
+    uint32_t cv[8];
+    memcpy(cv, initialValue, sizeof(cv));
+    compressInPlace(cv, cvs, blockLength, 0, flagParent | (root ? flagRoot : 0));
+    storeChainingValue(cv, cvs);
+  }
+}
+
+/* computes the chaining value of a subtree that is not the root
+
+   parameters:
+       data       - pointer to the data of the subtree
+       length     - length of the data in bytes, at most chunksPerSubtree
+                    chunks
+       firstChunk - index of the first chunk
+       cv         - receives the chaining value as little endian bytes
+*/
+void subtreeChainingValue(const uint8_t* data, const std::size_t length, const uint64_t firstChunk, uint8_t cv[32])
+{
+  uint8_t cvs[32 * chunksPerSubtree];
+  const std::size_t fullChunks = length / chunkLength;
+  for (std::size_t first = 0; first < fullChunks; first += inputsPerBatch)
+  {
+    const std::size_t n = std::min(inputsPerBatch, fullChunks - first);
+    const uint8_t* inputs[inputsPerBatch];
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      inputs[i] = data + chunkLength * (first + i);
+    }
+    uint32_t out[8 * inputsPerBatch];
+    hashMany(inputs, n, chunkLength / blockLength, initialValue, firstChunk + first, true,
+             0, flagChunkStart, flagChunkEnd, out);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      storeChainingValue(out + 8 * i, cvs + 32 * (first + i));
+    }
+  }
+  std::size_t count = fullChunks;
+  if ((length % chunkLength) != 0)
+  {
+    uint32_t last[8];
+    chunkChainingValue(data + fullChunks * chunkLength, length % chunkLength, firstChunk + fullChunks, last);
+    storeChainingValue(last, cvs + 32 * count);
+    ++count;
+  }
+  mergeChainingValues(cvs, count, false);
+  memcpy(cv, cvs, 32);
+}
+
+MessageDigest computeFromBufferParallel(const uint8_t* data, const std::size_t length, const unsigned int maxThreads)
+{
+  const std::size_t subtreeLength = chunksPerSubtree * chunkLength;
+  unsigned int threads = (maxThreads != 0) ? maxThreads : std::thread::hardware_concurrency();
+  if ((threads <= 1) || (length <= subtreeLength))
+  {
+    Hasher hasher;
+    hasher.update(data, length);
+    return hasher.finalize();
+  }
+
+  // Subtrees of 2^k chunks are complete subtrees of the whole tree, so they
+  // can be hashed independently. Only their parents are left afterwards.
+  const std::size_t count = (length + subtreeLength - 1) / subtreeLength;
+  std::vector<uint8_t> cvs(32 * count);
+  std::atomic<std::size_t> nextSubtree(0);
+  const auto work = [&]()
+  {
+    std::size_t i;
+    while ((i = nextSubtree.fetch_add(1, std::memory_order_relaxed)) < count)
+    {
+      const std::size_t offset = i * subtreeLength;
+      subtreeChainingValue(data + offset, std::min(subtreeLength, length - offset),
+                           static_cast<uint64_t>(i) * chunksPerSubtree, cvs.data() + 32 * i);
+    }
+  };
+  threads = static_cast<unsigned int>(std::min<std::size_t>(threads, count));
+  std::vector<std::thread> workers;
+  for (unsigned int t = 1; t < threads; ++t)
+  {
+    workers.emplace_back(work);
+  }
+  work();
+  for (std::thread& worker : workers)
+  {
+    worker.join();
+  }
+
+  mergeChainingValues(cvs.data(), count, true);
+  MessageDigest result;
+  libstriezel::hash::loadBigEndian(cvs.data(), 8, result.hash);
+  return result;
+}
+
+} //namespace
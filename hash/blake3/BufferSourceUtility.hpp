@@ -0,0 +1,58 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_BLAKE3_BUFFERSOURCEUTILITY_HPP
+#define LIBSTRIEZEL_BLAKE3_BUFFERSOURCEUTILITY_HPP
+
+#include <cstddef>
+#include "blake3.hpp"
+
+namespace BLAKE3
+{
+
+/** \brief computes and returns the message digest of data in the given buffer of the given length
+ *
+ * \param data                  pointer to the message data buffer
+ * \param data_length_in_bits   length of data in bits. Value is rounded up to
+ *                              the next integral multiple of eight, i.e. only
+ *                              full bytes are allowed.
+ * \return Returns the BLAKE3 message digest on success.
+ *         Returns the "null" message digest (i.e. all bits set to zero),
+ *         if an error occurred.
+ */
+MessageDigest computeFromBuffer(const uint8_t* data, const uint64_t data_length_in_bits);
+
+
+/** \brief computes the message digest of a buffer with several threads
+ *
+ * \param data        pointer to the message data
+ * \param length      length of the data in bytes
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns the BLAKE3 message digest. It is the same as the one of
+ *         computeFromBuffer(), because the tree is part of the algorithm.
+ * \remarks Every thread hashes whole subtrees of 64 KiB, so small buffers
+ *          are hashed by the calling thread only.
+ */
+MessageDigest computeFromBufferParallel(const uint8_t* data, const std::size_t length, const unsigned int maxThreads = 0);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_BLAKE3_BUFFERSOURCEUTILITY_HPP
@@ -0,0 +1,60 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "FileSourceUtility.hpp"
+#include <iostream>
+#include "BufferSourceUtility.hpp"
+#include "Hasher.hpp"
+#include "../MappedFile.hpp"
+#include "../ReadAheadReader.hpp"
+
+namespace BLAKE3
+{
+
+MessageDigest computeFromFile(const std::string& fileName, const unsigned int maxThreads)
+{
+  libstriezel::hash::MappedFile mapped;
+  if (mapped.open(fileName))
+  {
+    return computeFromBufferParallel(mapped.data(), mapped.size(), maxThreads);
+  }
+
+  libstriezel::hash::ReadAheadReader reader;
+  if (!reader.open(fileName))
+  {
+    std::cout << "Could not open file \""<<fileName<<"\" for BLAKE3 hashing!\n";
+    return MessageDigest();
+  }
+  Hasher hasher;
+  const uint8_t* data = nullptr;
+  std::size_t length = 0;
+  while (reader.next(data, length))
+  {
+    hasher.update(data, length);
+  }
+  if (reader.failed())
+  {
+    std::cout << "Error while reading file \""<<fileName<<"\"!\n";
+    return MessageDigest();
+  }
+  return hasher.finalize();
+}
+
+} //namespace
@@ -0,0 +1,45 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_BLAKE3_FILESOURCEUTILITY_HPP
+#define LIBSTRIEZEL_BLAKE3_FILESOURCEUTILITY_HPP
+
+#include <string>
+#include "blake3.hpp"
+
+namespace BLAKE3
+{
+
+/** \brief computes and returns the message digest of the given file's contents
+ *
+ * \param fileName    name of the file
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns the BLAKE3 message digest on success.
+ *         Returns the "null" message digest (i.e. all bits set to zero),
+ *         if an error occurred.
+ * \remarks Only regular files that can be memory-mapped are hashed in
+ *          parallel, other files are read and hashed sequentially.
+ */
+MessageDigest computeFromFile(const std::string& fileName, const unsigned int maxThreads = 0);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_BLAKE3_FILESOURCEUTILITY_HPP
@@ -0,0 +1,179 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "Hasher.hpp"
+#include <algorithm>
+#include <cstring>
+#include "compression.hpp"
+#include "../HexEncoding.hpp"
+
+namespace BLAKE3
+{
+
+/* number of chunks that update() passes to hashMany() at once */
+const std::size_t chunksPerBatch = 16;
+
+/* computes the chaining value of a parent node */
+void parentChainingValue(const uint32_t left[8], const uint32_t right[8], const uint8_t flags, uint32_t out[8])
+{
+  uint8_t block[64];
+  storeChainingValue(left, block);
+  storeChainingValue(right, block + 32);
+  memcpy(out, initialValue, 32);
+  compressInPlace(out, block, 64, 0, flagParent | flags);
+}
+
+Hasher::Hasher()
+: m_ChunkCv(), m_ChunkCounter(0), m_Block(), m_BlockLength(0), m_BlocksDone(0),
+  m_Stack(), m_StackSize(0), m_Length(0)
+{
+  reset();
+}
+
+void Hasher::reset()
+{
+  memcpy(m_ChunkCv, initialValue, sizeof(m_ChunkCv));
+  m_ChunkCounter = 0;
+  m_BlockLength = 0;
+  m_BlocksDone = 0;
+  m_StackSize = 0;
+  m_Length = 0;
+}
+
+void Hasher::compressBufferedBlock()
+{
+  const uint8_t flags = (m_BlocksDone == 0) ? flagChunkStart : 0;
+  compressInPlace(m_ChunkCv, m_Block, blockLength, m_ChunkCounter, flags);
+  ++m_BlocksDone;
+  m_BlockLength = 0;
+}
+
+void Hasher::addChunkChainingValue(const uint32_t cv[8], uint64_t totalChunks)
+{
+  // Every trailing zero bit of the chunk count completes another subtree.
+  uint32_t merged[8];
+  memcpy(merged, cv, sizeof(merged));
+  while ((totalChunks & 1) == 0)
+  {
+    --m_StackSize;
+    parentChainingValue(m_Stack[m_StackSize], merged, 0, merged);
+    totalChunks >>= 1;
+  }
+  memcpy(m_Stack[m_StackSize], merged, sizeof(merged));
+  ++m_StackSize;
+}
+
+void Hasher::finishChunk()
+{
+  // the last block is only compressed now, because of the end flag
+  const uint8_t flags = flagChunkEnd | ((m_BlocksDone == 0) ? flagChunkStart : 0);
+  compressInPlace(m_ChunkCv, m_Block, static_cast<uint8_t>(m_BlockLength), m_ChunkCounter, flags);
+  addChunkChainingValue(m_ChunkCv, m_ChunkCounter + 1);
+  ++m_ChunkCounter;
+  memcpy(m_ChunkCv, initialValue, sizeof(m_ChunkCv));
+  m_BlockLength = 0;
+  m_BlocksDone = 0;
+}
+
+void Hasher::update(const void* data, const std::size_t length)
+{
+  if (length == 0)
+    return;
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  std::size_t remaining = length;
+  m_Length += length;
+  while (remaining > 0)
+  {
+    // A full chunk may be the root, so it is only finished when more data
+    // follows.
+    if (m_BlocksDone * blockLength + m_BlockLength == chunkLength)
+      finishChunk();
+
+    if ((m_BlocksDone == 0) && (m_BlockLength == 0) && (remaining > chunkLength))
+    {
+      // whole chunks, except the last one, go to the SIMD implementation
+      const std::size_t chunks = std::min((remaining - 1) / chunkLength, chunksPerBatch);
+      const uint8_t* inputs[chunksPerBatch];
+      for (std::size_t i = 0; i < chunks; ++i)
+      {
+        inputs[i] = bytes + i * chunkLength;
+      }
+      uint32_t cvs[8 * chunksPerBatch];
+      hashMany(inputs, chunks, chunkLength / blockLength, initialValue, m_ChunkCounter, true,
+               0, flagChunkStart, flagChunkEnd, cvs);
+      for (std::size_t i = 0; i < chunks; ++i)
+      {
+        addChunkChainingValue(cvs + 8 * i, m_ChunkCounter + 1);
+        ++m_ChunkCounter;
+      }
+      bytes += chunks * chunkLength;
+      remaining -= chunks * chunkLength;
+      continue;
+    }
+
+    if (m_BlockLength == blockLength)
+      compressBufferedBlock();
+    const std::size_t count = std::min(remaining, blockLength - m_BlockLength);
+    memcpy(m_Block + m_BlockLength, bytes, count);
+    m_BlockLength += count;
+    bytes += count;
+    remaining -= count;
+  }
+}
+
+uint64_t Hasher::length() const
+{
+  return m_Length;
+}
+
+MessageDigest Hasher::finalize()
+{
+  // output node of the current chunk
+  memset(m_Block + m_BlockLength, 0, blockLength - m_BlockLength);
+  uint32_t cv[8];
+  memcpy(cv, m_ChunkCv, sizeof(cv));
+  uint8_t block[64];
+  memcpy(block, m_Block, sizeof(block));
+  uint8_t blockLen = static_cast<uint8_t>(m_BlockLength);
+  uint64_t counter = m_ChunkCounter;
+  uint8_t flags = flagChunkEnd | ((m_BlocksDone == 0) ? flagChunkStart : 0);
+
+  // merge with the subtrees on the stack from right to left
+  for (unsigned int i = m_StackSize; i > 0; --i)
+  {
+    compressInPlace(cv, block, blockLen, counter, flags);
+    storeChainingValue(m_Stack[i - 1], block);
+    storeChainingValue(cv, block + 32);
+    memcpy(cv, initialValue, sizeof(cv));
+    blockLen = blockLength;
+    counter = 0;
+    flags = flagParent;
+  }
+  compressInPlace(cv, block, blockLen, counter, flags | flagRoot);
+
+  uint8_t bytes[32];
+  storeChainingValue(cv, bytes);
+  MessageDigest result;
+  libstriezel::hash::loadBigEndian(bytes, 8, result.hash);
+  reset();
+  return result;
+}
+
+} //namespace
@@ -0,0 +1,98 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_BLAKE3_HASHER_HPP
+#define LIBSTRIEZEL_BLAKE3_HASHER_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "blake3.hpp"
+
+namespace BLAKE3
+{
+
+/** \brief incremental computation of BLAKE3 message digests
+ *
+ * Data can be passed in pieces of arbitrary size via update(). When a piece
+ * contains several complete chunks, they are compressed in parallel with
+ * the SIMD implementation of hashMany().
+ */
+class Hasher
+{
+  public:
+    /** \brief constructor */
+    Hasher();
+
+
+    /** \brief resets the hasher to the state before any data was passed */
+    void reset();
+
+
+    /** \brief passes the next piece of the message to the hasher
+     *
+     * \param data    pointer to the data
+     * \param length  length of the data in bytes
+     */
+    void update(const void* data, const std::size_t length);
+
+
+    /** \brief gets the number of bytes that have been passed to the hasher
+     *
+     * \return Returns the number of bytes passed since the last reset.
+     */
+    uint64_t length() const;
+
+
+    /** \brief computes the message digest
+     *
+     * \return Returns the BLAKE3 message digest of all data that was passed
+     *         to update() since the last reset.
+     * \remarks The hasher is reset afterwards, so it can be used for the
+     *          next message.
+     */
+    MessageDigest finalize();
+  private:
+    /* compresses the buffered block of the current chunk */
+    void compressBufferedBlock();
+
+    /* finishes the current chunk and starts the next one */
+    void finishChunk();
+
+    /* adds the chaining value of a finished chunk to the tree
+
+       parameters:
+           cv          - chaining value of the chunk
+           totalChunks - number of chunks including this one
+    */
+    void addChunkChainingValue(const uint32_t cv[8], uint64_t totalChunks);
+
+    uint32_t m_ChunkCv[8];      /**< chaining value within the current chunk */
+    uint64_t m_ChunkCounter;    /**< index of the current chunk */
+    uint8_t m_Block[64];        /**< buffered block of the current chunk */
+    std::size_t m_BlockLength;  /**< number of bytes in m_Block */
+    unsigned int m_BlocksDone;  /**< compressed blocks of the current chunk */
+    uint32_t m_Stack[54][8];    /**< chaining values of complete subtrees */
+    unsigned int m_StackSize;   /**< number of entries in m_Stack */
+    uint64_t m_Length;          /**< total message length in bytes */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_BLAKE3_HASHER_HPP
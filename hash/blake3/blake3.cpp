@@ -0,0 +1,107 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "blake3.hpp"
+#include "../HexEncoding.hpp"
+
+namespace BLAKE3
+{
+
+// MessageDigest functions
+
+MessageDigest::MessageDigest()
+{
+  setToNull();
+}
+
+std::string MessageDigest::toHexString() const
+{
+  std::string result(hexLength, '0');
+  toHexChars(&result[0]);
+  return result;
+}
+
+void MessageDigest::toHexChars(char* buffer) const
+{
+  libstriezel::hash::encodeWords(hash, 8, buffer);
+}
+
+bool MessageDigest::fromHexString(const std::string_view digestHexString)
+{
+  if (digestHexString.length() != hexLength)
+    return false;
+  return libstriezel::hash::decodeWords(digestHexString.data(), 8, hash);
+}
+
+bool MessageDigest::isNull() const
+{
+  return ((hash[0]==0) and (hash[1]==0) and (hash[2]==0) and (hash[3]==0)
+      and (hash[4]==0) and (hash[5]==0) and (hash[6]==0) and (hash[7]==0));
+}
+
+void MessageDigest::setToNull()
+{
+  hash[0]= hash[1]= hash[2]= hash[3]= hash[4]= hash[5]= hash[6]= hash[7]= 0;
+}
+
+bool MessageDigest::operator==(const MessageDigest& other) const
+{
+  return ((hash[0]==other.hash[0]) and (hash[1]==other.hash[1])
+    and (hash[2]==other.hash[2]) and (hash[3]==other.hash[3])
+    and (hash[4]==other.hash[4]) and (hash[5]==other.hash[5])
+    and (hash[6]==other.hash[6]) and (hash[7]==other.hash[7]));
+}
+
+bool MessageDigest::operator!=(const MessageDigest& other) const
+{
+  return ((hash[0]!=other.hash[0]) or (hash[1]!=other.hash[1])
+    or (hash[2]!=other.hash[2]) or (hash[3]!=other.hash[3])
+    or (hash[4]!=other.hash[4]) or (hash[5]!=other.hash[5])
+    or (hash[6]!=other.hash[6]) or (hash[7]!=other.hash[7]));
+}
+
+bool MessageDigest::operator<(const MessageDigest& other) const
+{
+  unsigned int i;
+  for (i=0; i<7; ++i)
+  {
+    if (hash[i]<other.hash[i]) return true;
+    if (hash[i]>other.hash[i]) return false;
+  }//for
+  return (hash[7]<other.hash[7]);
+}
+
+bool isValidHash(const std::string_view hash)
+{
+  return (hash.length() == MessageDigest::hexLength)
+      && libstriezel::hash::isValidHex(hash.data(), hash.length());
+}
+
+void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer)
+{
+  libstriezel::hash::encodeDigests(digests, count, buffer);
+}
+
+bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests)
+{
+  return libstriezel::hash::decodeDigests(buffer, count, digests);
+}
+
+} //namespace
@@ -0,0 +1,134 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_BLAKE3_HPP
+#define LIBSTRIEZEL_BLAKE3_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+
+namespace BLAKE3
+{
+  ///the MessageDigest structure for BLAKE3 (default output length)
+  struct MessageDigest
+  {
+    /* the 32 output bytes, read as big endian words like the SHA digests,
+       so that the hexadecimal representation is the usual one */
+    uint32_t hash[8];
+
+    /* number of characters of the hexadecimal representation */
+    static constexpr std::size_t hexLength = 64;
+
+    /* default constructor */
+    MessageDigest();
+
+    /* returns the message digest's representation as hexadecimal string */
+    std::string toHexString() const;
+
+    /* writes the message digest's representation as hexadecimal string to
+       the given buffer
+
+       parameters:
+           buffer - buffer for exactly hexLength characters, no terminating
+                    null character is written
+    */
+    void toHexChars(char* buffer) const;
+
+    /* set the message digest according to the given hexadecimal string and
+       returns true in case of success, or false if the string does not re-
+       present a valid hexadecimal digest
+
+       parameters:
+           digestHexString - the string containing the message digest as hex
+                             digits (must be all lower case)
+    */
+    bool fromHexString(const std::string_view digestHexString);
+
+    /* returns true, if all hash bits are set to zero */
+    bool isNull() const;
+
+    /* sets all bits of the hash to zero */
+    void setToNull();
+
+    /* equality operator */
+    bool operator==(const MessageDigest& other) const;
+
+    /* inequality operator */
+    bool operator!=(const MessageDigest& other) const;
+
+    /* comparison operator */
+    bool operator<(const MessageDigest& other) const;
+  };
+
+
+  /** \brief checks whether a string represents a valid BLAKE3 hash
+   *
+   * \param hash  a potential BLAKE3 hash string
+   * \return Returns true, if @hash contains a valid BLAKE3 hash.
+   *         Returns false otherwise.
+   * \remarks This function only considers lower case letters to be valid.
+   */
+  bool isValidHash(const std::string_view hash);
+
+
+  /** \brief writes the hexadecimal representations of several digests
+   *
+   * \param digests  pointer to the digests
+   * \param count    number of digests
+   * \param buffer   buffer for count * MessageDigest::hexLength characters,
+   *                 the representations are written without separators
+   */
+  void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer);
+
+
+  /** \brief reads several digests from their hexadecimal representations
+   *
+   * \param buffer   count * MessageDigest::hexLength characters, the
+   *                 representations without separators
+   * \param count    number of digests
+   * \param digests  receives the digests
+   * \return Returns true, if all representations were valid.
+   *         Returns false otherwise. Invalid digests are set to "null".
+   */
+  bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests);
+}//BLAKE3 namespace
+
+
+namespace std
+{
+  /** \brief hash function for BLAKE3 message digests
+   *
+   * The bits of a message digest are already evenly distributed, so the
+   * first 64 bits of the digest are used as hash value.
+   */
+  template<>
+  struct hash<BLAKE3::MessageDigest>
+  {
+    std::size_t operator()(const BLAKE3::MessageDigest& digest) const noexcept
+    {
+      return static_cast<std::size_t>((static_cast<uint64_t>(digest.hash[0]) << 32) | digest.hash[1]);
+    }
+  };
+} //namespace
+
+#endif // LIBSTRIEZEL_BLAKE3_HPP
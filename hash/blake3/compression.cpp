@@ -0,0 +1,341 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "compression.hpp"
+#include <atomic>
+#include <cstring>
+#include "../cpu_features.hpp"
+
+namespace BLAKE3
+{
+
+/* message word order of each of the seven rounds */
+const uint8_t messageSchedule[7][16] = {
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+  {  2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8 },
+  {  3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1 },
+  { 10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6 },
+  { 12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4 },
+  {  9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7 },
+  { 11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13 }
+};
+
+/* The rounds are also used by the SIMD kernels, so they must be inlined into
+   the functions with the target attributes. */
+#if defined(__GNUC__) || defined(__clang__)
+  #define BLAKE3_INLINE __attribute__((always_inline)) inline
+#else
+  #define BLAKE3_INLINE inline
+#endif
+
+#define BLAKE3_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+/* the quarter round function G, T is either a word or a vector of words */
+template<typename T>
+BLAKE3_INLINE void g(T& a, T& b, T& c, T& d, const T& mx, const T& my)
+{
+  a = a + b + mx;
+  d = BLAKE3_ROTR(d ^ a, 16);
+  c = c + d;
+  b = BLAKE3_ROTR(b ^ c, 12);
+  a = a + b + my;
+  d = BLAKE3_ROTR(d ^ a, 8);
+  c = c + d;
+  b = BLAKE3_ROTR(b ^ c, 7);
+}
+
+#undef BLAKE3_ROTR
+
+/* the seven rounds of the compression function
+
+   parameters:
+       v - the state, 16 words or vectors
+       m - the message block, 16 words or vectors
+*/
+template<typename T>
+BLAKE3_INLINE void rounds(T v[16], const T m[16])
+{
+  for (unsigned int r = 0; r < 7; ++r)
+  {
+    const uint8_t* s = messageSchedule[r];
+    // columns
+    g(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+    g(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+    g(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+    g(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+    // diagonals
+    g(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+    g(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    g(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+    g(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+  }
+}
+
+#undef BLAKE3_INLINE
+
+/* reads a little endian word */
+inline uint32_t loadWord(const uint8_t* p)
+{
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+       | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void storeChainingValue(const uint32_t cv[8], uint8_t bytes[32])
+{
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    bytes[4 * i] = static_cast<uint8_t>(cv[i]);
+    bytes[4 * i + 1] = static_cast<uint8_t>(cv[i] >> 8);
+    bytes[4 * i + 2] = static_cast<uint8_t>(cv[i] >> 16);
+    bytes[4 * i + 3] = static_cast<uint8_t>(cv[i] >> 24);
+  }
+}
+
+void compressInPlace(uint32_t cv[8], const uint8_t block[64], const uint8_t blockLen, const uint64_t counter, const uint8_t flags)
+{
+  uint32_t m[16];
+  for (unsigned int i = 0; i < 16; ++i)
+  {
+    m[i] = loadWord(block + 4 * i);
+  }
+  uint32_t v[16] = {
+    cv[0], cv[1], cv[2], cv[3], cv[4], cv[5], cv[6], cv[7],
+    initialValue[0], initialValue[1], initialValue[2], initialValue[3],
+    static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32),
+    blockLen, flags
+  };
+  rounds(v, m);
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    cv[i] = v[i] ^ v[i + 8];
+  }
+}
+
+/* computes the chaining value of one input with the scalar implementation */
+void hashOne(const uint8_t* input, std::size_t blocks, const uint32_t key[8], const uint64_t counter,
+             const uint8_t flags, const uint8_t flagsStart, const uint8_t flagsEnd, uint32_t out[8])
+{
+  uint32_t cv[8];
+  memcpy(cv, key, sizeof(cv));
+  uint8_t blockFlags = flags | flagsStart;
+  while (blocks > 0)
+  {
+    if (blocks == 1)
+      blockFlags |= flagsEnd;
+    compressInPlace(cv, input, blockLength, counter, blockFlags);
+    input += blockLength;
+    --blocks;
+    blockFlags = flags;
+  }
+  memcpy(out, cv, sizeof(cv));
+}
+
+#if defined(LIBSTRIEZEL_HASH_X86)
+typedef uint32_t Vector4 __attribute__((vector_size(16)));
+typedef uint32_t Vector8 __attribute__((vector_size(32)));
+typedef uint32_t Vector16 __attribute__((vector_size(64)));
+
+/* hashes L inputs in parallel, where each element of the vector type V
+   belongs to another input
+
+   parameters: see hashMany(), but exactly L inputs
+*/
+template <typename V, unsigned int L>
+__attribute__((always_inline)) inline void hashLanes(const uint8_t* const* inputs, const std::size_t blocks,
+    const uint32_t key[8], const uint64_t counter, const bool incrementCounter,
+    const uint8_t flags, const uint8_t flagsStart, const uint8_t flagsEnd, uint32_t* out)
+{
+  const V zero = { 0 };
+  V h[8];
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    h[i] = zero + key[i];
+  }
+  V counterLow = zero;
+  V counterHigh = zero;
+  for (unsigned int l = 0; l < L; ++l)
+  {
+    const uint64_t c = counter + (incrementCounter ? l : 0);
+    counterLow[l] = static_cast<uint32_t>(c);
+    counterHigh[l] = static_cast<uint32_t>(c >> 32);
+  }
+
+  uint8_t blockFlags = flags | flagsStart;
+  for (std::size_t b = 0; b < blocks; ++b)
+  {
+    if (b + 1 == blocks)
+      blockFlags |= flagsEnd;
+    // transpose the blocks, so that m[t] holds word t of every input
+    V m[16];
+    for (unsigned int t = 0; t < 16; ++t)
+    {
+      for (unsigned int l = 0; l < L; ++l)
+      {
+        uint32_t word;
+        memcpy(&word, inputs[l] + blockLength * b + 4 * t, 4);
+        m[t][l] = word;
+      }
+    }
+    V v[16] = {
+      h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7],
+      zero + initialValue[0], zero + initialValue[1], zero + initialValue[2], zero + initialValue[3],
+      counterLow, counterHigh, zero + static_cast<uint32_t>(blockLength), zero + blockFlags
+    };
+    rounds(v, m);
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      h[i] = v[i] ^ v[i + 8];
+    }
+    blockFlags = flags;
+  }
+
+  for (unsigned int l = 0; l < L; ++l)
+  {
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      out[8 * l + i] = h[i][l];
+    }
+  }
+}
+
+__attribute__((target("sse4.1")))
+void hashLanesSSE41(const uint8_t* const* inputs, const std::size_t blocks, const uint32_t key[8], const uint64_t counter,
+                    const bool incrementCounter, const uint8_t flags, const uint8_t flagsStart, const uint8_t flagsEnd, uint32_t* out)
+{
+  hashLanes<Vector4, 4>(inputs, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+}
+
+__attribute__((target("avx2")))
+void hashLanesAVX2(const uint8_t* const* inputs, const std::size_t blocks, const uint32_t key[8], const uint64_t counter,
+                   const bool incrementCounter, const uint8_t flags, const uint8_t flagsStart, const uint8_t flagsEnd, uint32_t* out)
+{
+  hashLanes<Vector8, 8>(inputs, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw")))
+void hashLanesAVX512(const uint8_t* const* inputs, const std::size_t blocks, const uint32_t key[8], const uint64_t counter,
+                     const bool incrementCounter, const uint8_t flags, const uint8_t flagsStart, const uint8_t flagsEnd, uint32_t* out)
+{
+  hashLanes<Vector16, 16>(inputs, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+}
+#endif // LIBSTRIEZEL_HASH_X86
+
+bool isSupported(const Implementation impl)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  const libstriezel::hash::CpuFeatures& features = libstriezel::hash::cpuFeatures();
+  #endif
+  switch (impl)
+  {
+    case Implementation::Scalar:
+         return true;
+    #if defined(LIBSTRIEZEL_HASH_X86)
+    case Implementation::SSE41:
+         return features.sse41;
+    case Implementation::AVX2:
+         return features.avx2;
+    case Implementation::AVX512:
+         return features.avx512;
+    #else
+    case Implementation::SSE41:
+    case Implementation::AVX2:
+    case Implementation::AVX512:
+         return false;
+    #endif
+  }//swi
+  return false;
+}
+
+/* returns the fastest implementation that is supported */
+Implementation detectBestImplementation()
+{
+  if (isSupported(Implementation::AVX512))
+    return Implementation::AVX512;
+  if (isSupported(Implementation::AVX2))
+    return Implementation::AVX2;
+  if (isSupported(Implementation::SSE41))
+    return Implementation::SSE41;
+  return Implementation::Scalar;
+}
+
+/* returns the variable that holds the active implementation */
+std::atomic<Implementation>& activeImplementation()
+{
+  static std::atomic<Implementation> impl(detectBestImplementation());
+  return impl;
+}
+
+Implementation getImplementation()
+{
+  return activeImplementation().load(std::memory_order_relaxed);
+}
+
+bool setImplementation(const Implementation impl)
+{
+  if (!isSupported(impl))
+    return false;
+  activeImplementation().store(impl, std::memory_order_relaxed);
+  return true;
+}
+
+void hashMany(const uint8_t* const* inputs, std::size_t count, const std::size_t blocks,
+              const uint32_t key[8], uint64_t counter, const bool incrementCounter,
+              const uint8_t flags, const uint8_t flagsStart, const uint8_t flagsEnd, uint32_t* out)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  // Use the widest kernel first, the remaining inputs go to narrower ones.
+  const Implementation impl = getImplementation();
+  if (impl == Implementation::AVX512)
+  {
+    for (; count >= 16; count -= 16, inputs += 16, out += 8 * 16)
+    {
+      hashLanesAVX512(inputs, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+      if (incrementCounter)
+        counter += 16;
+    }
+  }
+  if ((impl == Implementation::AVX512) || (impl == Implementation::AVX2))
+  {
+    for (; count >= 8; count -= 8, inputs += 8, out += 8 * 8)
+    {
+      hashLanesAVX2(inputs, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+      if (incrementCounter)
+        counter += 8;
+    }
+  }
+  if (impl != Implementation::Scalar)
+  {
+    for (; count >= 4; count -= 4, inputs += 4, out += 8 * 4)
+    {
+      hashLanesSSE41(inputs, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+      if (incrementCounter)
+        counter += 4;
+    }
+  }
+  #endif
+  for (; count > 0; --count, ++inputs, out += 8)
+  {
+    hashOne(*inputs, blocks, key, counter, flags, flagsStart, flagsEnd, out);
+    if (incrementCounter)
+      ++counter;
+  }
+}
+
+} //namespace
@@ -0,0 +1,128 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_BLAKE3_COMPRESSION_HPP
+#define LIBSTRIEZEL_BLAKE3_COMPRESSION_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace BLAKE3
+{
+
+/// size of a message block in bytes
+const std::size_t blockLength = 64;
+
+/// size of a chunk (leaf of the hash tree) in bytes
+const std::size_t chunkLength = 1024;
+
+/// domain separation flags
+enum Flags: uint8_t
+{
+  flagChunkStart = 1, /**< first block of a chunk */
+  flagChunkEnd = 2,   /**< last block of a chunk */
+  flagParent = 4,     /**< parent node of the tree */
+  flagRoot = 8        /**< root node of the tree */
+};
+
+/// initial value, also the key words of the plain hash mode
+const uint32_t initialValue[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+  0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+
+/// implementations of hashMany()
+enum class Implementation
+{
+  Scalar, /**< portable C++ implementation, one input at a time */
+  SSE41,  /**< four inputs in parallel, using SSE 4.1 */
+  AVX2,   /**< eight inputs in parallel, using AVX2 */
+  AVX512  /**< sixteen inputs in parallel, using AVX-512 */
+};
+
+
+/** \brief checks whether an implementation can be used on this machine
+ *
+ * \param impl  the implementation
+ * \return Returns true, if the implementation is supported.
+ */
+bool isSupported(const Implementation impl);
+
+
+/** \brief gets the implementation that is currently used
+ *
+ * \return Returns the implementation used by hashMany().
+ * \remarks By default, the fastest supported implementation is used.
+ */
+Implementation getImplementation();
+
+
+/** \brief sets the implementation of hashMany()
+ *
+ * \param impl  the implementation that shall be used
+ * \return Returns true, if the implementation was changed.
+ *         Returns false, if the implementation is not supported.
+ */
+bool setImplementation(const Implementation impl);
+
+
+/** \brief applies the compression function to a single block
+ *
+ * \param cv           the chaining value that shall be updated
+ * \param block        the block, 64 bytes, padded with zeros if necessary
+ * \param blockLen     number of message bytes in the block
+ * \param counter      chunk counter (zero for parent nodes)
+ * \param flags        domain separation flags
+ */
+void compressInPlace(uint32_t cv[8], const uint8_t block[64], const uint8_t blockLen, const uint64_t counter, const uint8_t flags);
+
+
+/** \brief writes a chaining value as little endian bytes
+ *
+ * \param cv     the chaining value
+ * \param bytes  receives the 32 bytes, e.g. one half of a parent block
+ */
+void storeChainingValue(const uint32_t cv[8], uint8_t bytes[32]);
+
+
+/** \brief computes the chaining values of several inputs of the same length
+ *
+ * \param inputs            pointers to the inputs
+ * \param count             number of inputs
+ * \param blocks            number of complete blocks of every input
+ * \param key               the key words
+ * \param counter           counter of the first input
+ * \param incrementCounter  whether the counter is increased by one for
+ *                          every input (chunks) or not (parent nodes)
+ * \param flags             flags for all blocks
+ * \param flagsStart        additional flags for the first block
+ * \param flagsEnd          additional flags for the last block
+ * \param out               receives eight words per input
+ * \remarks Several inputs are compressed in parallel with SIMD instructions,
+ *          depending on the active implementation.
+ */
+void hashMany(const uint8_t* const* inputs, const std::size_t count, const std::size_t blocks,
+              const uint32_t key[8], const uint64_t counter, const bool incrementCounter,
+              const uint8_t flags, const uint8_t flagsStart, const uint8_t flagsEnd, uint32_t* out);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_BLAKE3_COMPRESSION_HPP
@@ -0,0 +1,110 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_HASH_CPU_FEATURES_HPP
+#define LIBSTRIEZEL_HASH_CPU_FEATURES_HPP
+
+#include <stdint.h>
+
+/* This file contains the runtime detection of processor features that are
+   used by the accelerated hash implementations. Code that uses x86 intrinsics
+   is only compiled when LIBSTRIEZEL_HASH_X86 is defined. Such code is
+   compiled via function-level target attributes, so no special compiler
+   flags are required for the translation units that contain it. */
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #define LIBSTRIEZEL_HASH_X86
+  #include <cpuid.h>
+#endif
+
+namespace libstriezel::hash
+{
+
+/// structure that holds the supported instruction set extensions
+struct CpuFeatures
+{
+  bool ssse3;    /**< Supplemental SSE3 */
+  bool sse41;    /**< SSE 4.1 */
+  bool sse42;    /**< SSE 4.2 */
+  bool pclmul;   /**< carry-less multiplication */
+  bool avx2;     /**< AVX2 (includes OS support for YMM registers) */
+  bool bmi2;     /**< bit manipulation instructions 2 */
+  bool avx512;   /**< AVX-512 F + VL + BW (includes OS support for ZMM registers) */
+  bool sha;      /**< SHA extensions */
+};
+
+
+/** \brief detects the instruction set extensions of the current processor
+ *
+ * \return Returns the detected features. All features are false on
+ *         platforms other than x86 / x86_64.
+ */
+inline CpuFeatures detectCpuFeatures()
+{
+  CpuFeatures f = { false, false, false, false, false, false, false, false };
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+    return f;
+  f.ssse3 = (ecx & (1u << 9)) != 0;
+  f.sse41 = (ecx & (1u << 19)) != 0;
+  f.sse42 = (ecx & (1u << 20)) != 0;
+  f.pclmul = (ecx & (1u << 1)) != 0;
+  const bool osxsave = (ecx & (1u << 27)) != 0;
+  const bool avx = (ecx & (1u << 28)) != 0;
+  // XCR0 tells whether the operating system saves the wide registers
+  uint32_t xcr0 = 0;
+  if (osxsave)
+  {
+    uint32_t xcr0_high = 0;
+    __asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0_high) : "c" (0));
+  }
+  const bool ymmEnabled = (xcr0 & 0x06) == 0x06;
+  const bool zmmEnabled = (xcr0 & 0xe6) == 0xe6;
+
+  if (__get_cpuid_max(0, nullptr) >= 7)
+  {
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    f.avx2 = avx && ymmEnabled && ((ebx & (1u << 5)) != 0);
+    f.bmi2 = (ebx & (1u << 8)) != 0;
+    f.sha = (ebx & (1u << 29)) != 0;
+    const bool avx512f = (ebx & (1u << 16)) != 0;
+    const bool avx512bw = (ebx & (1u << 30)) != 0;
+    const bool avx512vl = (ebx & (1u << 31)) != 0;
+    f.avx512 = f.avx2 && zmmEnabled && avx512f && avx512bw && avx512vl;
+  }
+  #endif
+  return f;
+}
+
+
+/** \brief gets the instruction set extensions of the current processor
+ *
+ * \return Returns the detected features. Detection happens only once.
+ */
+inline const CpuFeatures& cpuFeatures()
+{
+  static const CpuFeatures features = detectCpuFeatures();
+  return features;
+}
+
+} // namespace
+
+#endif // LIBSTRIEZEL_HASH_CPU_FEATURES_HPP
@@ -0,0 +1,61 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "FileSourceUtility.hpp"
+#include <iostream>
+#include "crc32c.hpp"
+#include "../MappedFile.hpp"
+#include "../ReadAheadReader.hpp"
+
+namespace CRC32C
+{
+
+bool computeFromFile(const std::string& fileName, uint32_t& crc)
+{
+  libstriezel::hash::MappedFile mapped;
+  if (mapped.open(fileName))
+  {
+    crc = computeFromBuffer(mapped.data(), mapped.size());
+    return true;
+  }
+
+  libstriezel::hash::ReadAheadReader reader;
+  if (!reader.open(fileName))
+  {
+    std::cout << "Could not open file \""<<fileName<<"\" for CRC-32C computation!\n";
+    return false;
+  }
+  uint32_t result = 0;
+  const uint8_t* data = nullptr;
+  std::size_t length = 0;
+  while (reader.next(data, length))
+  {
+    result = extend(result, data, length);
+  }
+  if (reader.failed())
+  {
+    std::cout << "Error while reading file \""<<fileName<<"\"!\n";
+    return false;
+  }
+  crc = result;
+  return true;
+}
+
+} //namespace
@@ -0,0 +1,43 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_CRC32C_FILESOURCEUTILITY_HPP
+#define LIBSTRIEZEL_CRC32C_FILESOURCEUTILITY_HPP
+
+#include <stdint.h>
+#include <string>
+
+namespace CRC32C
+{
+
+/** \brief computes the checksum of the given file's contents
+ *
+ * \param fileName  name of the file
+ * \param crc       receives the CRC-32C checksum of the file
+ * \return Returns true, if the checksum was computed.
+ *         Returns false, if an error occurred.
+ * \remarks Unlike the SHA functions there is no "null" value to signal an
+ *          error, because zero is a common checksum.
+ */
+bool computeFromFile(const std::string& fileName, uint32_t& crc);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_CRC32C_FILESOURCEUTILITY_HPP
@@ -0,0 +1,271 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "crc32c.hpp"
+#include <atomic>
+#include <cstring>
+#include "../cpu_features.hpp"
+#if defined(LIBSTRIEZEL_HASH_X86)
+#include <immintrin.h>
+#endif
+
+namespace CRC32C
+{
+
+/* reversed Castagnoli polynomial */
+const uint32_t polynomial = 0x82F63B78;
+
+/* lookup tables for slicing-by-8 */
+struct Tables
+{
+  uint32_t t[8][256];
+};
+
+constexpr Tables generateTables()
+{
+  Tables tables = { };
+  for (uint32_t n = 0; n < 256; ++n)
+  {
+    uint32_t crc = n;
+    for (unsigned int k = 0; k < 8; ++k)
+    {
+      crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+    }
+    tables.t[0][n] = crc;
+  }
+  for (uint32_t n = 0; n < 256; ++n)
+  {
+    uint32_t crc = tables.t[0][n];
+    for (unsigned int k = 1; k < 8; ++k)
+    {
+      crc = tables.t[0][crc & 0xFF] ^ (crc >> 8);
+      tables.t[k][n] = crc;
+    }
+  }
+  return tables;
+}
+
+inline constexpr Tables tables = generateTables();
+
+/* reads four bytes in little endian order */
+inline uint32_t loadLittleEndian32(const uint8_t* p)
+{
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+       | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+/* slicing-by-8 implementation, crc is the inverted checksum */
+uint32_t extendScalar(uint32_t crc, const uint8_t* data, std::size_t length)
+{
+  const auto& t = tables.t;
+  while (length >= 8)
+  {
+    crc ^= loadLittleEndian32(data);
+    const uint32_t high = loadLittleEndian32(data + 4);
+    crc = t[7][crc & 0xFF] ^ t[6][(crc >> 8) & 0xFF] ^ t[5][(crc >> 16) & 0xFF] ^ t[4][crc >> 24]
+        ^ t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+    data += 8;
+    length -= 8;
+  }
+  while (length > 0)
+  {
+    crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+    ++data;
+    --length;
+  }
+  return crc;
+}
+
+#if defined(LIBSTRIEZEL_HASH_X86)
+/* length of each of the three streams of the PCLMUL implementation */
+const std::size_t longStream = 8192;
+const std::size_t shortStream = 256;
+
+/* computes x^n modulo the polynomial in the reflected representation */
+constexpr uint32_t powerOfX(uint64_t n)
+{
+  uint32_t result = 0x80000000; // x^0
+  while (n > 0)
+  {
+    result = (result & 1) ? (result >> 1) ^ polynomial : result >> 1;
+    --n;
+  }
+  return result;
+}
+
+/* Multiplying the crc register by x^(8n - 33) with a carry-less
+   multiplication and reducing the 64 bit product with the crc32 instruction
+   appends n zero bytes to the register. */
+const uint32_t shiftLong1 = powerOfX(8 * longStream - 33);
+const uint32_t shiftLong2 = powerOfX(16 * longStream - 33);
+const uint32_t shiftShort1 = powerOfX(8 * shortStream - 33);
+const uint32_t shiftShort2 = powerOfX(16 * shortStream - 33);
+
+/* applies the crc32 instruction to eight bytes */
+__attribute__((target("sse4.2")))
+inline uint32_t crcWord(const uint32_t crc, const uint8_t* data)
+{
+  #if defined(__x86_64__)
+  uint64_t word;
+  memcpy(&word, data, 8);
+  return static_cast<uint32_t>(_mm_crc32_u64(crc, word));
+  #else
+  uint32_t low, high;
+  memcpy(&low, data, 4);
+  memcpy(&high, data + 4, 4);
+  return _mm_crc32_u32(_mm_crc32_u32(crc, low), high);
+  #endif
+}
+
+/* implementation with one stream of crc32 instructions */
+__attribute__((target("sse4.2")))
+uint32_t extendSSE42(uint32_t crc, const uint8_t* data, std::size_t length)
+{
+  while (length >= 8)
+  {
+    crc = crcWord(crc, data);
+    data += 8;
+    length -= 8;
+  }
+  while (length > 0)
+  {
+    crc = _mm_crc32_u8(crc, *data);
+    ++data;
+    --length;
+  }
+  return crc;
+}
+
+#if defined(__x86_64__)
+/* Each crc32 instruction has a latency of three cycles, but a new one can
+   start in every cycle. So three independent streams are computed at once
+   and merged afterwards. */
+__attribute__((target("sse4.2,pclmul")))
+inline uint32_t extendStreams(uint32_t crc, const uint8_t*& data, std::size_t& length,
+                              const std::size_t stream, const uint32_t shift1, const uint32_t shift2)
+{
+  const __m128i constants = _mm_set_epi64x(shift1, shift2);
+  while (length >= 3 * stream)
+  {
+    uint32_t crc1 = 0;
+    uint32_t crc2 = 0;
+    for (std::size_t i = 0; i < stream; i += 8)
+    {
+      crc = crcWord(crc, data + i);
+      crc1 = crcWord(crc1, data + stream + i);
+      crc2 = crcWord(crc2, data + 2 * stream + i);
+    }
+    const __m128i product0 = _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(crc)), constants, 0x00);
+    const __m128i product1 = _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(crc1)), constants, 0x10);
+    const uint64_t merged = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_xor_si128(product0, product1)));
+    crc = static_cast<uint32_t>(_mm_crc32_u64(0, merged)) ^ crc2;
+    data += 3 * stream;
+    length -= 3 * stream;
+  }
+  return crc;
+}
+
+__attribute__((target("sse4.2,pclmul")))
+uint32_t extendPCLMUL(uint32_t crc, const uint8_t* data, std::size_t length)
+{
+  crc = extendStreams(crc, data, length, longStream, shiftLong1, shiftLong2);
+  crc = extendStreams(crc, data, length, shortStream, shiftShort1, shiftShort2);
+  return extendSSE42(crc, data, length);
+}
+#endif // __x86_64__
+#endif // LIBSTRIEZEL_HASH_X86
+
+bool isSupported(const Implementation impl)
+{
+  switch (impl)
+  {
+    case Implementation::Scalar:
+         return true;
+    case Implementation::SSE42:
+         #if defined(LIBSTRIEZEL_HASH_X86)
+         return libstriezel::hash::cpuFeatures().sse42;
+         #else
+         return false;
+         #endif
+    case Implementation::PCLMUL:
+         #if defined(LIBSTRIEZEL_HASH_X86) && defined(__x86_64__)
+         return libstriezel::hash::cpuFeatures().sse42
+             && libstriezel::hash::cpuFeatures().pclmul;
+         #else
+         return false;
+         #endif
+  }//swi
+  return false;
+}
+
+/* returns the fastest implementation that is supported */
+Implementation detectBestImplementation()
+{
+  if (isSupported(Implementation::PCLMUL))
+    return Implementation::PCLMUL;
+  if (isSupported(Implementation::SSE42))
+    return Implementation::SSE42;
+  return Implementation::Scalar;
+}
+
+/* returns the variable that holds the active implementation */
+std::atomic<Implementation>& activeImplementation()
+{
+  static std::atomic<Implementation> impl(detectBestImplementation());
+  return impl;
+}
+
+Implementation getImplementation()
+{
+  return activeImplementation().load(std::memory_order_relaxed);
+}
+
+bool setImplementation(const Implementation impl)
+{
+  if (!isSupported(impl))
+    return false;
+  activeImplementation().store(impl, std::memory_order_relaxed);
+  return true;
+}
+
+uint32_t extend(const uint32_t crc, const void* data, const std::size_t length)
+{
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  switch (getImplementation())
+  {
+    #if defined(LIBSTRIEZEL_HASH_X86)
+    case Implementation::SSE42:
+         return ~extendSSE42(~crc, bytes, length);
+    #if defined(__x86_64__)
+    case Implementation::PCLMUL:
+         return ~extendPCLMUL(~crc, bytes, length);
+    #endif
+    #endif
+    default:
+         return ~extendScalar(~crc, bytes, length);
+  }//swi
+}
+
+uint32_t computeFromBuffer(const void* data, const std::size_t length)
+{
+  return extend(0, data, length);
+}
+
+} //namespace
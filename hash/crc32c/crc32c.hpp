@@ -0,0 +1,89 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_CRC32C_HPP
+#define LIBSTRIEZEL_CRC32C_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+/* CRC-32C (Castagnoli polynomial 0x1EDC6F41, reflected 0x82F63B78), as used
+   by iSCSI, ext4 and Btrfs. It is no cryptographic hash, but cheap enough to
+   sort out files that cannot be equal before hashing them with SHA-256. */
+
+namespace CRC32C
+{
+
+/// implementations of the checksum computation
+enum class Implementation
+{
+  Scalar, /**< portable C++ implementation (slicing-by-8) */
+  SSE42,  /**< crc32 instruction of SSE 4.2 */
+  PCLMUL  /**< three interleaved crc32 streams, merged via carry-less
+               multiplication */
+};
+
+
+/** \brief checks whether an implementation can be used on this machine
+ *
+ * \param impl  the implementation
+ * \return Returns true, if the implementation is supported.
+ */
+bool isSupported(const Implementation impl);
+
+
+/** \brief gets the implementation that is currently used
+ *
+ * \return Returns the implementation used by extend().
+ * \remarks By default, the fastest supported implementation is used.
+ */
+Implementation getImplementation();
+
+
+/** \brief sets the implementation of the checksum computation
+ *
+ * \param impl  the implementation that shall be used
+ * \return Returns true, if the implementation was changed.
+ *         Returns false, if the implementation is not supported.
+ */
+bool setImplementation(const Implementation impl);
+
+
+/** \brief continues a checksum computation with more data
+ *
+ * \param crc     checksum of the data so far, zero for the first piece
+ * \param data    pointer to the data
+ * \param length  length of the data in bytes
+ * \return Returns the checksum of the previous data followed by data.
+ */
+uint32_t extend(const uint32_t crc, const void* data, const std::size_t length);
+
+
+/** \brief computes the checksum of a buffer
+ *
+ * \param data    pointer to the data
+ * \param length  length of the data in bytes
+ * \return Returns the CRC-32C checksum of the data.
+ */
+uint32_t computeFromBuffer(const void* data, const std::size_t length);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_CRC32C_HPP
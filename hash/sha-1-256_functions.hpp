@@ -30,7 +30,7 @@
 namespace SHA1_256
 {
 
-inline uint32_t rotr(const uint8_t n, const uint32_t w)
+constexpr uint32_t rotr(const uint8_t n, const uint32_t w)
 {
   #ifdef SHA256_DEBUG
   //no values larger than 31 allowed here, because 32 is the word size
@@ -40,7 +40,7 @@ inline uint32_t rotr(const uint8_t n, const uint32_t w)
   return ((w >> n) | (w << (32-n)));
 }
 
-inline uint32_t rotl(const uint8_t n, const uint32_t w)
+constexpr uint32_t rotl(const uint8_t n, const uint32_t w)
 {
   #ifdef SHA256_DEBUG
   //no values larger than 31 allowed here, because 32 is the word size
@@ -50,17 +50,17 @@ inline uint32_t rotl(const uint8_t n, const uint32_t w)
   return ((w << n) | (w >> (32-n)));
 }
 
-inline uint32_t Ch(const uint32_t x, const uint32_t y, const uint32_t z)
+constexpr uint32_t Ch(const uint32_t x, const uint32_t y, const uint32_t z)
 {
   return ((x & y) ^ ((~x) & z));
 }
 
-inline uint32_t Maj(const uint32_t x, const uint32_t y, const uint32_t z)
+constexpr uint32_t Maj(const uint32_t x, const uint32_t y, const uint32_t z)
 {
   return ((x & y) ^ (x & z) ^ (y & z));
 }
 
-inline uint32_t Parity(const uint32_t x, const uint32_t y, const uint32_t z)
+constexpr uint32_t Parity(const uint32_t x, const uint32_t y, const uint32_t z)
 {
   return (x ^ y ^ z);
 }
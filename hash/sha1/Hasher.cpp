@@ -0,0 +1,111 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "Hasher.hpp"
+#include <algorithm>
+#include <cstring>
+#include "compression.hpp"
+
+namespace SHA1
+{
+
+Hasher::Hasher()
+: m_State(), m_Tail(), m_TailLength(0), m_Length(0)
+{
+  reset();
+}
+
+void Hasher::reset()
+{
+  m_State[0] = 0x67452301;
+  m_State[1] = 0xefcdab89;
+  m_State[2] = 0x98badcfe;
+  m_State[3] = 0x10325476;
+  m_State[4] = 0xc3d2e1f0;
+  m_TailLength = 0;
+  m_Length = 0;
+}
+
+void Hasher::update(const void* data, const std::size_t length)
+{
+  // data may be null for empty input, which memcpy() does not allow
+  if (length == 0)
+    return;
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  std::size_t remaining = length;
+  m_Length += length;
+  // complete a previously started block first
+  if (m_TailLength > 0)
+  {
+    const std::size_t count = std::min(remaining, 64 - m_TailLength);
+    memcpy(m_Tail + m_TailLength, bytes, count);
+    m_TailLength += count;
+    bytes += count;
+    remaining -= count;
+    if (m_TailLength < 64)
+      return;
+    compressBlocks(m_State, m_Tail, 1);
+    m_TailLength = 0;
+  }
+  // full blocks are processed in place
+  const std::size_t blocks = remaining / 64;
+  if (blocks > 0)
+  {
+    compressBlocks(m_State, bytes, blocks);
+    bytes += 64 * blocks;
+    remaining -= 64 * blocks;
+  }
+  if (remaining > 0)
+  {
+    memcpy(m_Tail, bytes, remaining);
+    m_TailLength = remaining;
+  }
+}
+
+uint64_t Hasher::length() const
+{
+  return m_Length;
+}
+
+MessageDigest Hasher::finalize()
+{
+  MessageDigest md;
+  const uint64_t bits = m_Length * 8;
+  //add 1-bit
+  m_Tail[m_TailLength++] = 0x80;
+  if (m_TailLength > 56)
+  {
+    memset(m_Tail + m_TailLength, 0, 64 - m_TailLength);
+    compressBlocks(m_State, m_Tail, 1);
+    m_TailLength = 0;
+  }
+  memset(m_Tail + m_TailLength, 0, 56 - m_TailLength);
+  //add data length in bits (big endian)
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    m_Tail[63 - i] = static_cast<uint8_t>(bits >> (8 * i));
+  }
+  compressBlocks(m_State, m_Tail, 1);
+  std::copy(m_State, m_State + 5, md.hash);
+  reset();
+  return md;
+}
+
+} //namespace
@@ -0,0 +1,80 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA1_HASHER_HPP
+#define LIBSTRIEZEL_SHA1_HASHER_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "sha1.hpp"
+
+namespace SHA1
+{
+
+/** \brief incremental computation of SHA-1 message digests
+ *
+ * Data can be passed in pieces of arbitrary size via update(). Complete
+ * blocks are compressed directly from the caller's memory, only an
+ * incomplete block at the end of the data is kept in an internal buffer.
+ */
+class Hasher
+{
+  public:
+    /** \brief constructor */
+    Hasher();
+
+
+    /** \brief resets the hasher to the state before any data was passed */
+    void reset();
+
+
+    /** \brief passes the next piece of the message to the hasher
+     *
+     * \param data    pointer to the data
+     * \param length  length of the data in bytes
+     */
+    void update(const void* data, const std::size_t length);
+
+
+    /** \brief gets the number of bytes that have been passed to the hasher
+     *
+     * \return Returns the number of bytes passed since the last reset.
+     */
+    uint64_t length() const;
+
+
+    /** \brief pads the message and computes the message digest
+     *
+     * \return Returns the SHA1 message digest of all data that was passed
+     *         to update() since the last reset.
+     * \remarks The hasher is reset afterwards, so it can be used for the
+     *          next message.
+     */
+    MessageDigest finalize();
+  private:
+    uint32_t m_State[5];       /**< intermediate hash value */
+    uint8_t m_Tail[64];        /**< data of the incomplete block */
+    std::size_t m_TailLength;  /**< number of bytes in m_Tail */
+    uint64_t m_Length;         /**< total message length in bytes */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA1_HASHER_HPP
@@ -0,0 +1,154 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA1_COMPILE_TIME_HPP
+#define LIBSTRIEZEL_SHA1_COMPILE_TIME_HPP
+
+#include <array>
+#include <cstddef>
+#include <stdint.h>
+#include <string_view>
+#include "functions.hpp"
+#include "sha1.hpp"
+
+/* This file contains a constexpr implementation of SHA-1. It allows to
+   compute digests of string literals and other constant data at compile
+   time, e.g.
+
+     constexpr SHA1::MessageDigest digest = SHA1::computeConstexpr("abc");
+
+   Like its SHA-256 counterpart in ../sha256/compile_time.hpp, it is meant
+   for short data only. */
+
+namespace SHA1
+{
+
+namespace compile_time
+{
+
+/* compression function for a single block of 64 bytes
+
+   parameters:
+       state - the intermediate hash value
+       block - pointer to the block in message byte order
+*/
+template<typename Byte>
+constexpr void compressBlock(uint32_t (&state)[5], const Byte* block)
+{
+  uint32_t w[80] = { 0 };
+  for (unsigned int t = 0; t < 16; ++t)
+  {
+    w[t] = (static_cast<uint32_t>(static_cast<uint8_t>(block[4 * t])) << 24)
+         | (static_cast<uint32_t>(static_cast<uint8_t>(block[4 * t + 1])) << 16)
+         | (static_cast<uint32_t>(static_cast<uint8_t>(block[4 * t + 2])) << 8)
+         | static_cast<uint32_t>(static_cast<uint8_t>(block[4 * t + 3]));
+  }
+  for (unsigned int t = 16; t < 80; ++t)
+  {
+    w[t] = SHA1_256::rotl(1, w[t-3] ^ w[t-8] ^ w[t-14] ^ w[t-16]);
+  }
+
+  uint32_t a = state[0];
+  uint32_t b = state[1];
+  uint32_t c = state[2];
+  uint32_t d = state[3];
+  uint32_t e = state[4];
+  for (unsigned int t = 0; t < 80; ++t)
+  {
+    const uint32_t temp1 = SHA1_256::rotl(5, a) + f_t(t, b, c, d) + e + sha1_k[t] + w[t];
+    e = d;
+    d = c;
+    c = SHA1_256::rotl(30, b);
+    b = a;
+    a = temp1;
+  }
+
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+}
+
+
+/* computes the final hash value of a message
+
+   parameters:
+       data   - pointer to the message
+       length - length of the message in bytes
+*/
+template<typename Byte>
+constexpr MessageDigest compute(const Byte* data, const std::size_t length)
+{
+  uint32_t state[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+  const std::size_t fullBlocks = length / 64;
+  for (std::size_t i = 0; i < fullBlocks; ++i)
+  {
+    compressBlock(state, data + 64 * i);
+  }
+
+  // last one or two blocks with padding and message length
+  uint8_t tail[128] = { 0 };
+  const std::size_t remainder = length % 64;
+  for (std::size_t i = 0; i < remainder; ++i)
+  {
+    tail[i] = static_cast<uint8_t>(data[64 * fullBlocks + i]);
+  }
+  tail[remainder] = 0x80;
+  const std::size_t tailLength = (remainder > 55) ? 128 : 64;
+  const uint64_t bits = static_cast<uint64_t>(length) * 8;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    tail[tailLength - 1 - i] = static_cast<uint8_t>(bits >> (8 * i));
+  }
+  compressBlock(state, tail);
+  if (tailLength == 128)
+    compressBlock(state, tail + 64);
+  return MessageDigest(state);
+}
+
+} //namespace compile_time
+
+
+/** \brief computes the SHA-1 message digest of a string at compile time
+ *
+ * \param message  the message, e.g. a string literal
+ * \return Returns the message digest of the message.
+ */
+constexpr MessageDigest computeConstexpr(const std::string_view message)
+{
+  return compile_time::compute(message.data(), message.size());
+}
+
+
+/** \brief computes the SHA-1 message digest of a byte array at compile time
+ *
+ * \param message  the message
+ * \return Returns the message digest of the message.
+ */
+template<std::size_t N>
+constexpr MessageDigest computeConstexpr(const std::array<uint8_t, N>& message)
+{
+  return compile_time::compute(message.data(), N);
+}
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA1_COMPILE_TIME_HPP
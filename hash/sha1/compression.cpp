@@ -0,0 +1,236 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2012, 2014, 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "compression.hpp"
+#include <atomic>
+#include <cstring>
+#include "functions.hpp"
+#include "../cpu_features.hpp"
+#if defined(LIBSTRIEZEL_HASH_X86)
+#include <immintrin.h>
+#endif
+
+namespace SHA1
+{
+
+/* scalar implementation
+
+   parameters:
+       state - the intermediate hash value
+       words - the message block as 16 words in host byte order
+*/
+void compressScalar(uint32_t state[5], const uint32_t words[16])
+{
+  uint32_t msg_schedule[80];
+  uint32_t a, b, c, d, e;
+  uint32_t temp1;
+  unsigned int t; //loop variable
+
+  // 1. prepare message schedule
+  for (t=0; t<16; ++t)
+  {
+    msg_schedule[t] = words[t];
+  }//for t
+  for (t=16; t<80; ++t)
+  {
+    msg_schedule[t] = SHA1_256::rotl(1, msg_schedule[t-3] ^ msg_schedule[t-8] ^ msg_schedule[t-14] ^ msg_schedule[t-16]);
+  }//for run
+
+  // 2. init. working vars
+  a = state[0];
+  b = state[1];
+  c = state[2];
+  d = state[3];
+  e = state[4];
+
+  // 3. for loop
+  for (t=0; t<80; ++t)
+  {
+    temp1 = SHA1_256::rotl(5, a) + f_t(t, b, c, d) + e + sha1_k[t] + msg_schedule[t];
+    e = d;
+    d = c;
+    c = SHA1_256::rotl(30, b);
+    b = a;
+    a = temp1;
+  }//for t
+
+  // 4. compute next intermediate hash value
+  state[0] = a + state[0];
+  state[1] = b + state[1];
+  state[2] = c + state[2];
+  state[3] = d + state[3];
+  state[4] = e + state[4];
+}
+
+#if defined(LIBSTRIEZEL_HASH_X86)
+/* implementation using the SHA extensions
+
+   parameters:
+       state      - the intermediate hash value
+       data       - pointer to the message blocks
+       blockCount - number of blocks in data
+       swapBytes  - whether the words in data are in message byte order (true)
+                    or have already been converted to host byte order (false)
+*/
+__attribute__((target("sha,sse4.1")))
+void compressSHANI(uint32_t state[5], const uint8_t* data, std::size_t blockCount, const bool swapBytes)
+{
+  // reverses the bytes of the words as well as the order of the words
+  const __m128i byteSwapMask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+  // The SHA instructions expect A in the highest lane and E separately.
+  __m128i abcd = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+  abcd = _mm_shuffle_epi32(abcd, 0x1B);
+  __m128i e0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+
+  while (blockCount > 0)
+  {
+    const __m128i abcdSave = abcd;
+    const __m128i eSave = e0;
+    __m128i previousAbcd = abcd;
+    __m128i w[4];
+    #if defined(__GNUC__)
+    #pragma GCC unroll 20
+    #endif
+    for (unsigned int g = 0; g < 20; ++g)
+    {
+      if (g < 4)
+      {
+        w[g] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * g));
+        w[g] = swapBytes ? _mm_shuffle_epi8(w[g], byteSwapMask)
+                         : _mm_shuffle_epi32(w[g], 0x1B);
+      }
+      else
+      {
+        // W[t] for the next four rounds from W[t-16] ... W[t-1]
+        w[g % 4] = _mm_sha1msg2_epu32(
+                     _mm_xor_si128(_mm_sha1msg1_epu32(w[g % 4], w[(g + 1) % 4]),
+                                   w[(g + 2) % 4]),
+                     w[(g + 3) % 4]);
+      }
+      // E for the next four rounds is derived from A four rounds ago.
+      const __m128i e = (g == 0) ? _mm_add_epi32(e0, w[0])
+                                 : _mm_sha1nexte_epu32(previousAbcd, w[g % 4]);
+      previousAbcd = abcd;
+      switch (g / 5)
+      {
+        case 0:
+             abcd = _mm_sha1rnds4_epu32(abcd, e, 0);
+             break;
+        case 1:
+             abcd = _mm_sha1rnds4_epu32(abcd, e, 1);
+             break;
+        case 2:
+             abcd = _mm_sha1rnds4_epu32(abcd, e, 2);
+             break;
+        default:
+             abcd = _mm_sha1rnds4_epu32(abcd, e, 3);
+             break;
+      }//swi
+    } //for g
+
+    e0 = _mm_sha1nexte_epu32(previousAbcd, eSave);
+    abcd = _mm_add_epi32(abcd, abcdSave);
+    data += 64;
+    --blockCount;
+  } //while
+
+  abcd = _mm_shuffle_epi32(abcd, 0x1B);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), abcd);
+  state[4] = static_cast<uint32_t>(_mm_extract_epi32(e0, 3));
+}
+#endif
+
+bool isSupported(const Implementation impl)
+{
+  switch (impl)
+  {
+    case Implementation::Scalar:
+         return true;
+    case Implementation::SHANI:
+         #if defined(LIBSTRIEZEL_HASH_X86)
+         return libstriezel::hash::cpuFeatures().sha
+             && libstriezel::hash::cpuFeatures().sse41;
+         #else
+         return false;
+         #endif
+  }//swi
+  return false;
+}
+
+/* returns the fastest implementation that is supported */
+Implementation detectBestImplementation()
+{
+  if (isSupported(Implementation::SHANI))
+    return Implementation::SHANI;
+  return Implementation::Scalar;
+}
+
+/* returns the variable that holds the active implementation */
+std::atomic<Implementation>& activeImplementation()
+{
+  static std::atomic<Implementation> impl(detectBestImplementation());
+  return impl;
+}
+
+Implementation getImplementation()
+{
+  return activeImplementation().load(std::memory_order_relaxed);
+}
+
+bool setImplementation(const Implementation impl)
+{
+  if (!isSupported(impl))
+    return false;
+  activeImplementation().store(impl, std::memory_order_relaxed);
+  return true;
+}
+
+void compressBlock(uint32_t state[5], const MessageBlock& block)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  if (getImplementation() == Implementation::SHANI)
+  {
+    compressSHANI(state, reinterpret_cast<const uint8_t*>(&block.words[0]), 1, false);
+    return;
+  }
+  #endif
+  compressScalar(state, block.words);
+}
+
+void compressBlocks(uint32_t state[5], const uint8_t* data, const std::size_t blockCount)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  if (getImplementation() == Implementation::SHANI)
+  {
+    compressSHANI(state, data, blockCount, true);
+    return;
+  }
+  #endif
+  MessageBlock block;
+  for (std::size_t i = 0; i < blockCount; ++i)
+  {
+    memcpy(&block.words[0], data + 64 * i, 64);
+    block.reverseBlock();
+    compressScalar(state, block.words);
+  }
+}
+
+} //namespace
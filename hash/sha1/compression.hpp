@@ -0,0 +1,83 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA1_COMPRESSION_HPP
+#define LIBSTRIEZEL_SHA1_COMPRESSION_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "sha1.hpp"
+
+namespace SHA1
+{
+
+/// implementations of the SHA-1 compression function
+enum class Implementation
+{
+  Scalar, /**< portable C++ implementation */
+  SHANI   /**< x86 SHA extensions */
+};
+
+
+/** \brief checks whether an implementation can be used on this machine
+ *
+ * \param impl  the implementation
+ * \return Returns true, if the implementation is supported.
+ */
+bool isSupported(const Implementation impl);
+
+
+/** \brief gets the implementation that is currently used
+ *
+ * \return Returns the implementation used by the compression functions.
+ * \remarks By default, the fastest supported implementation is used.
+ */
+Implementation getImplementation();
+
+
+/** \brief sets the implementation of the compression functions
+ *
+ * \param impl  the implementation that shall be used
+ * \return Returns true, if the implementation was changed.
+ *         Returns false, if the implementation is not supported.
+ */
+bool setImplementation(const Implementation impl);
+
+
+/** \brief applies the compression function to a single message block
+ *
+ * \param state  the intermediate hash value that shall be updated
+ * \param block  the message block, words are in host byte order
+ */
+void compressBlock(uint32_t state[5], const MessageBlock& block);
+
+
+/** \brief applies the compression function to consecutive message blocks
+ *
+ * \param state       the intermediate hash value that shall be updated
+ * \param data        pointer to the message data in message byte order,
+ *                    i.e. as read from a file (no alignment required)
+ * \param blockCount  number of 64 byte blocks in data
+ */
+void compressBlocks(uint32_t state[5], const uint8_t* data, const std::size_t blockCount);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA1_COMPRESSION_HPP
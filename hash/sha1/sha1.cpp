@@ -1,7 +1,7 @@
 /*
  -----------------------------------------------------------------------------
     This file is part of the striezel's common code library.
-    Copyright (C) 2012, 2014  Dirk Stolle
+    Copyright (C) 2012, 2014, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,11 +19,8 @@
 */
 
 #include "sha1.hpp"
-#include "../sha-1-256_functions.hpp"
-#include <iostream>
-#include <stdexcept>
-#include <cstring>
-#include <sys/types.h>
+#include "../HexEncoding.hpp"
+#include "compression.hpp"
 
 namespace SHA1
 {
@@ -37,61 +34,21 @@ MessageDigest::MessageDigest()
 
 std::string MessageDigest::toHexString() const
 {
-  const char cHexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
-  std::string result;
-  unsigned int i;
-  for (i=0; i<5; ++i)
-  {
-    result.push_back(cHexDigits[hash[i]>>28]);
-    result.push_back(cHexDigits[(hash[i]>>24)%16]);
-    result.push_back(cHexDigits[(hash[i]>>20)%16]);
-    result.push_back(cHexDigits[(hash[i]>>16)%16]);
-    result.push_back(cHexDigits[(hash[i]>>12)%16]);
-    result.push_back(cHexDigits[(hash[i]>>8)%16]);
-    result.push_back(cHexDigits[(hash[i]>>4)%16]);
-    result.push_back(cHexDigits[hash[i]%16]);
-  }//for
+  std::string result(hexLength, '0');
+  toHexChars(&result[0]);
   return result;
 }
 
-bool MessageDigest::fromHexString(const std::string& digestHexString)
+void MessageDigest::toHexChars(char* buffer) const
 {
-  if (digestHexString.length()!=40) return false;
-  unsigned int i, j;
-  for (i=0; i<5; ++i)
-  {
-    hash[i] = 0;
-    for (j=0; j<8; ++j)
-    {
-      switch (digestHexString.at(i*8+j))
-      {
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9':
-             hash[i] = hash[i] | ((digestHexString.at(i*8+j)-'0')<<(28-j*4));
-             break;
-        case 'a':
-        case 'b':
-        case 'c':
-        case 'd':
-        case 'e':
-        case 'f':
-             hash[i] = hash[i] | ((digestHexString.at(i*8+j)-'a'+10)<<(28-j*4));
-             break;
-        default:
-             //invalid character encountered
-             return false;
-      }//swi
-    }//for j
-  }//for i
-  return true;
+  libstriezel::hash::encodeWords(hash, 5, buffer);
+}
+
+bool MessageDigest::fromHexString(const std::string_view digestHexString)
+{
+  if (digestHexString.length() != hexLength)
+    return false;
+  return libstriezel::hash::decodeWords(digestHexString.data(), 5, hash);
 }
 
 bool MessageDigest::isNull() const
@@ -130,40 +87,27 @@ bool MessageDigest::operator<(const MessageDigest& other) const
   return (hash[4]<other.hash[4]);
 }
 
-//SHA-1 constants
-const uint32_t sha1_k[80] = {
-  0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999,
-  0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999,
-  0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1,
-  0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1,
-  0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1, 0x6ed9eba1,
-  0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc,
-  0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc,
-  0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0x8f1bbcdc, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6,
-  0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6,
-  0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6, 0xca62c1d6
-};
-
-uint32_t f_t(const uint8_t t, const uint32_t x, const uint32_t y, const uint32_t z)
+bool isValidHash(const std::string_view hash)
+{
+  return (hash.length() == MessageDigest::hexLength)
+      && libstriezel::hash::isValidHex(hash.data(), hash.length());
+}
+
+void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer)
+{
+  libstriezel::hash::encodeDigests(digests, count, buffer);
+}
+
+bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests)
 {
-  if (t<20) return SHA1_256::Ch(x,y,z);
-  if (t<40) return SHA1_256::Parity(x,y,z);
-  if (t<60) return SHA1_256::Maj(x,y,z);
-  if (t<80) return SHA1_256::Parity(x,y,z);
-  throw std::invalid_argument("f_t(): values of t have to be less than 80!");
+  return libstriezel::hash::decodeDigests(buffer, count, digests);
 }
 
 MessageDigest computeFromSource(MessageSource& source)
 {
   MessageBlock msgBlock;
-
-  uint32_t msg_schedule[80];
-  uint32_t a, b, c, d, e;
-  uint32_t temp1;
   MessageDigest H;
 
-  H.setToNull();
-
   //setup stuff should have been done before this, so go on with hash initialization
 
   //set initial value
@@ -173,44 +117,9 @@ MessageDigest computeFromSource(MessageSource& source)
   H.hash[3] = 0x10325476;
   H.hash[4] = 0xc3d2e1f0;
 
-  unsigned int t; //Laufvariable
-
   while (source.getNextMessageBlock(msgBlock))
   {
-    // 1. prepare message schedule
-    for (t=0; t<16; ++t)
-    {
-      msg_schedule[t] = msgBlock.words[t];
-    }//for t
-    for (t=16; t<80; ++t)
-    {
-      msg_schedule[t] = SHA1_256::rotl(1, msg_schedule[t-3] ^ msg_schedule[t-8] ^ msg_schedule[t-14] ^ msg_schedule[t-16]);
-    }//for run
-
-    // 2. init. working vars
-    a = H.hash[0];
-    b = H.hash[1];
-    c = H.hash[2];
-    d = H.hash[3];
-    e = H.hash[4];
-
-    // 3. for loop
-    for (t=0; t<80; ++t)
-    {
-      temp1 = SHA1_256::rotl(5, a) + f_t(t, b, c, d) + e + sha1_k[t] + msg_schedule[t];
-      e = d;
-      d = c;
-      c = SHA1_256::rotl(30, b);
-      b = a;
-      a = temp1;
-    }//for t
-
-    // 4. compute next intermediate hash value
-    H.hash[0] = a + H.hash[0];
-    H.hash[1] = b + H.hash[1];
-    H.hash[2] = c + H.hash[2];
-    H.hash[3] = d + H.hash[3];
-    H.hash[4] = e + H.hash[4];
+    compressBlock(H.hash, msgBlock);
   }//while message blocks are there
 
   return H;
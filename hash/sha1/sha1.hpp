@@ -21,8 +21,11 @@
 #ifndef LIBSTRIEZEL_SHA_1_HPP
 #define LIBSTRIEZEL_SHA_1_HPP
 
+#include <cstddef>
+#include <functional>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include "../sha256/MessageSource.hpp"
 
 namespace SHA1
@@ -36,12 +39,35 @@ namespace SHA1
   {
     uint32_t hash[5];
 
+    /* number of characters of the hexadecimal representation */
+    static constexpr std::size_t hexLength = 40;
+
     /* default constructor */
     MessageDigest();
 
+    /* constructs the message digest from the given hash words, this allows
+       digests that are computed at compile time (see compile_time.hpp)
+
+       parameters:
+           words - the words of the hash
+    */
+    constexpr explicit MessageDigest(const uint32_t (&words)[5])
+    : hash{ words[0], words[1], words[2], words[3], words[4] }
+    {
+    }
+
     /* returns the message digest's representation as hexadecimal string */
     std::string toHexString() const;
 
+    /* writes the message digest's representation as hexadecimal string to
+       the given buffer
+
+       parameters:
+           buffer - buffer for exactly hexLength characters, no terminating
+                    null character is written
+    */
+    void toHexChars(char* buffer) const;
+
     /* set the message digest according to the given hexadecimal string and
        returns true in case of success, or false if the string does not re-
        present a valid hexadecimal digest
@@ -50,7 +76,7 @@ namespace SHA1
            digestHexString - the string containing the message digest as hex
                              digits (must be all lower case)
     */
-    bool fromHexString(const std::string& digestHexString);
+    bool fromHexString(const std::string_view digestHexString);
 
     /* returns true, if all hash bits are set to zero */
     bool isNull() const;
@@ -69,6 +95,38 @@ namespace SHA1
   };
 
 
+  /** \brief checks whether a string represents a valid SHA1 hash
+   *
+   * \param hash  a potential SHA1 hash string
+   * \return Returns true, if @hash contains a valid SHA1 hash.
+   *         Returns false otherwise.
+   * \remarks This function only considers lower case letters to be valid.
+   */
+  bool isValidHash(const std::string_view hash);
+
+
+  /** \brief writes the hexadecimal representations of several digests
+   *
+   * \param digests  pointer to the digests
+   * \param count    number of digests
+   * \param buffer   buffer for count * MessageDigest::hexLength characters,
+   *                 the representations are written without separators
+   */
+  void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer);
+
+
+  /** \brief reads several digests from their hexadecimal representations
+   *
+   * \param buffer   count * MessageDigest::hexLength characters, the
+   *                 representations without separators
+   * \param count    number of digests
+   * \param digests  receives the digests
+   * \return Returns true, if all representations were valid.
+   *         Returns false otherwise. Invalid digests are set to "null".
+   */
+  bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests);
+
+
   /** \brief computes and returns the message digest of the given source
    *
    * \param source   the message source
@@ -79,4 +137,22 @@ namespace SHA1
   MessageDigest computeFromSource(MessageSource& source);
 }//SHA1 namespace
 
+
+namespace std
+{
+  /** \brief hash function for SHA-1 message digests
+   *
+   * The bits of a message digest are already evenly distributed, so the
+   * first 64 bits of the digest are used as hash value.
+   */
+  template<>
+  struct hash<SHA1::MessageDigest>
+  {
+    std::size_t operator()(const SHA1::MessageDigest& digest) const noexcept
+    {
+      return static_cast<std::size_t>((static_cast<uint64_t>(digest.hash[0]) << 32) | digest.hash[1]);
+    }
+  };
+} //namespace
+
 #endif // LIBSTRIEZEL_SHA_1_HPP
@@ -0,0 +1,48 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "BatchUtility.hpp"
+#include "../sha2_core.hpp"
+
+namespace SHA224
+{
+
+std::vector<MessageDigest> computeFromBuffers(const std::vector<BatchMessage>& messages)
+{
+  std::vector<MessageDigest> digests;
+  if (messages.empty())
+    return digests;
+  // SHA-224 needs all eight words during computation, but only keeps seven.
+  std::vector<uint32_t> states(8 * messages.size());
+  std::vector<uint32_t*> statePointers(messages.size());
+  for (std::size_t i = 0; i < messages.size(); ++i)
+  {
+    statePointers[i] = &states[8 * i];
+  }
+  SHA256::computeBatchStates(SHA2::SHA224Parameters::initialValue, messages.data(), messages.size(), statePointers.data());
+  digests.reserve(messages.size());
+  for (std::size_t i = 0; i < messages.size(); ++i)
+  {
+    digests.push_back(MessageDigest(statePointers[i]));
+  }
+  return digests;
+}
+
+} //namespace
@@ -0,0 +1,43 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA224_BATCHUTILITY_HPP
+#define LIBSTRIEZEL_SHA224_BATCHUTILITY_HPP
+
+#include <vector>
+#include "sha224.hpp"
+#include "../sha256/BatchUtility.hpp"
+
+namespace SHA224
+{
+  ///alias for type that is shared with SHA-256
+  typedef SHA256::BatchMessage BatchMessage;
+
+  /** \brief computes the message digests of several messages at once
+   *
+   * \param messages  the messages
+   * \return Returns the SHA224 message digests in the order of the messages.
+   * \remarks The implementation is shared with SHA-256, see
+   *          SHA256::setBatchImplementation() for the available choices.
+   */
+  std::vector<MessageDigest> computeFromBuffers(const std::vector<BatchMessage>& messages);
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA224_BATCHUTILITY_HPP
@@ -21,8 +21,11 @@
 #ifndef LIBSTRIEZEL_SHA224_HPP
 #define LIBSTRIEZEL_SHA224_HPP
 
+#include <cstddef>
+#include <functional>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include "../sha256/MessageSource.hpp"
 
 namespace SHA224
@@ -36,6 +39,10 @@ namespace SHA224
   {
     uint32_t hash[7];
 
+
+    /** \brief number of characters of the hexadecimal representation */
+    static constexpr std::size_t hexLength = 56;
+
     /** \brief default constructor */
     MessageDigest();
 
@@ -55,6 +62,14 @@ namespace SHA224
     std::string toHexString() const;
 
 
+    /** \brief writes the hexadecimal representation into a buffer
+     *
+     * \param buffer  buffer for exactly hexLength characters, no terminating
+     *                null character is written
+     */
+    void toHexChars(char* buffer) const;
+
+
     /** \brief set the message digest according to the given hexadecimal string
      *
      * \param digestHexString  the string containing the message digest as hex
@@ -63,7 +78,7 @@ namespace SHA224
      *         Returns false if the string does not represent a valid
      *         hexadecimal digest.
      */
-    bool fromHexString(const std::string& digestHexString);
+    bool fromHexString(const std::string_view digestHexString);
 
 
     /** \brief checks whether the hash is the "null" hash
@@ -90,6 +105,38 @@ namespace SHA224
   }; //struct MessageDigest
 
 
+  /** \brief checks whether a string represents a valid SHA224 hash
+   *
+   * \param hash  a potential SHA224 hash string
+   * \return Returns true, if @hash contains a valid SHA224 hash.
+   *         Returns false otherwise.
+   * \remarks This function only considers lower case letters to be valid.
+   */
+  bool isValidHash(const std::string_view hash);
+
+
+  /** \brief writes the hexadecimal representations of several digests
+   *
+   * \param digests  pointer to the digests
+   * \param count    number of digests
+   * \param buffer   buffer for count * MessageDigest::hexLength characters,
+   *                 the representations are written without separators
+   */
+  void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer);
+
+
+  /** \brief reads several digests from their hexadecimal representations
+   *
+   * \param buffer   count * MessageDigest::hexLength characters, the
+   *                 representations without separators
+   * \param count    number of digests
+   * \param digests  receives the digests
+   * \return Returns true, if all representations were valid.
+   *         Returns false otherwise. Invalid digests are set to "null".
+   */
+  bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests);
+
+
   /** \brief computes and returns the message digest of the given source
    *
    * \param source   the message source
@@ -100,4 +147,22 @@ namespace SHA224
   MessageDigest computeFromSource(MessageSource& source);
 } //namespace
 
+
+namespace std
+{
+  /** \brief hash function for SHA-224 message digests
+   *
+   * The bits of a message digest are already evenly distributed, so the
+   * first 64 bits of the digest are used as hash value.
+   */
+  template<>
+  struct hash<SHA224::MessageDigest>
+  {
+    std::size_t operator()(const SHA224::MessageDigest& digest) const noexcept
+    {
+      return static_cast<std::size_t>((static_cast<uint64_t>(digest.hash[0]) << 32) | digest.hash[1]);
+    }
+  };
+} //namespace
+
 #endif // LIBSTRIEZEL_SHA224_HPP
@@ -0,0 +1,359 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "BatchUtility.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include "compression.hpp"
+#include "functions.hpp"
+#include "../cpu_features.hpp"
+#include "../sha2_core.hpp"
+
+namespace SHA256
+{
+
+/* one message of a batch, prepared for lane-wise processing */
+struct Lane
+{
+  const uint8_t* data;    /**< message data */
+  std::size_t fullBlocks; /**< number of complete blocks in data */
+  std::size_t blocks;     /**< total number of blocks, including padding */
+  uint8_t tail[128];      /**< the last one or two blocks with padding */
+  uint32_t* state;        /**< where to store the final hash value */
+
+  /* returns a pointer to the j-th block of the padded message */
+  const uint8_t* block(const std::size_t j) const
+  {
+    return (j < fullBlocks) ? data + 64 * j : tail + 64 * (j - fullBlocks);
+  }
+};
+
+/* prepares a lane for the given message
+
+   parameters:
+       lane    - the lane
+       message - the message
+       state   - pointer to the hash value of the message
+*/
+void prepareLane(Lane& lane, const BatchMessage& message, uint32_t* state)
+{
+  lane.data = message.data;
+  lane.fullBlocks = message.length / 64;
+  lane.state = state;
+  const std::size_t remainder = message.length % 64;
+  const std::size_t tailLength = (remainder > 55) ? 128 : 64;
+  memset(lane.tail, 0, tailLength);
+  if (remainder > 0)
+    memcpy(lane.tail, message.data + 64 * lane.fullBlocks, remainder);
+  //add 1-bit
+  lane.tail[remainder] = 0x80;
+  //add data length in bits (big endian)
+  const uint64_t bits = static_cast<uint64_t>(message.length) * 8;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    lane.tail[tailLength - 1 - i] = static_cast<uint8_t>(bits >> (8 * i));
+  }
+  lane.blocks = lane.fullBlocks + tailLength / 64;
+}
+
+/* hashes the lane with the sequential compression function */
+void hashLaneSequential(const uint32_t initialValue[8], const Lane& lane)
+{
+  std::copy(initialValue, initialValue + 8, lane.state);
+  compressBlocks(lane.state, lane.data, lane.fullBlocks);
+  compressBlocks(lane.state, lane.tail, lane.blocks - lane.fullBlocks);
+}
+
+#if defined(LIBSTRIEZEL_HASH_X86)
+typedef uint32_t Vector4 __attribute__((vector_size(16)));
+typedef uint32_t Vector8 __attribute__((vector_size(32)));
+typedef uint32_t Vector16 __attribute__((vector_size(64)));
+
+#define SHA256_LANE_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+/* hashes up to L lanes in parallel, where each element of the vector type V
+   belongs to another message
+
+   parameters:
+       initialValue - the initial hash value
+       lanes        - pointers to the lanes, may be null for unused lanes
+*/
+template <typename V, unsigned int L>
+__attribute__((always_inline)) inline void hashLanes(const uint32_t initialValue[8], const Lane* const* lanes)
+{
+  static const uint8_t zeroBlock[64] = { 0 };
+  const V zero = { 0 };
+  V state[8];
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    state[i] = zero + initialValue[i];
+  }
+  std::size_t maxBlocks = 0;
+  for (unsigned int l = 0; l < L; ++l)
+  {
+    if ((lanes[l] != nullptr) && (lanes[l]->blocks > maxBlocks))
+      maxBlocks = lanes[l]->blocks;
+  }
+
+  for (std::size_t j = 0; j < maxBlocks; ++j)
+  {
+    // 1. gather the next block of every lane, lanes that are already done
+    //    get a dummy block and keep their hash value
+    const uint8_t* blocks[L];
+    V active = zero;
+    for (unsigned int l = 0; l < L; ++l)
+    {
+      const bool use = (lanes[l] != nullptr) && (j < lanes[l]->blocks);
+      blocks[l] = use ? lanes[l]->block(j) : zeroBlock;
+      active[l] = use ? 0xFFFFFFFF : 0;
+    }
+    V w[16];
+    for (unsigned int t = 0; t < 16; ++t)
+    {
+      for (unsigned int l = 0; l < L; ++l)
+      {
+        const uint8_t* p = blocks[l] + 4 * t;
+        w[t][l] = (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16)
+                | (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+      }
+    }
+
+    // 2. init. working vars
+    V a = state[0];
+    V b = state[1];
+    V c = state[2];
+    V d = state[3];
+    V e = state[4];
+    V f = state[5];
+    V g = state[6];
+    V h = state[7];
+
+    // 3. rounds, message schedule is computed on the fly
+    for (unsigned int t = 0; t < 64; ++t)
+    {
+      if (t >= 16)
+      {
+        const V w2 = w[(t - 2) & 15];
+        const V w15 = w[(t - 15) & 15];
+        w[t & 15] += (SHA256_LANE_ROTR(w2, 17) ^ SHA256_LANE_ROTR(w2, 19) ^ (w2 >> 10))
+                   + w[(t - 7) & 15]
+                   + (SHA256_LANE_ROTR(w15, 7) ^ SHA256_LANE_ROTR(w15, 18) ^ (w15 >> 3));
+      }
+      const V temp1 = h + (SHA256_LANE_ROTR(e, 6) ^ SHA256_LANE_ROTR(e, 11) ^ SHA256_LANE_ROTR(e, 25))
+                    + ((e & f) ^ (~e & g)) + sha256_k[t] + w[t & 15];
+      const V temp2 = (SHA256_LANE_ROTR(a, 2) ^ SHA256_LANE_ROTR(a, 13) ^ SHA256_LANE_ROTR(a, 22))
+                    + ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + temp1;
+      d = c;
+      c = b;
+      b = a;
+      a = temp1 + temp2;
+    }
+
+    // 4. compute next intermediate hash value for active lanes only
+    state[0] += a & active;
+    state[1] += b & active;
+    state[2] += c & active;
+    state[3] += d & active;
+    state[4] += e & active;
+    state[5] += f & active;
+    state[6] += g & active;
+    state[7] += h & active;
+  }
+
+  for (unsigned int l = 0; l < L; ++l)
+  {
+    if (lanes[l] == nullptr)
+      continue;
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      lanes[l]->state[i] = state[i][l];
+    }
+  }
+}
+
+#undef SHA256_LANE_ROTR
+
+__attribute__((target("sse4.1")))
+void hashLanesSSE41(const uint32_t initialValue[8], const Lane* const* lanes)
+{
+  hashLanes<Vector4, 4>(initialValue, lanes);
+}
+
+__attribute__((target("avx2")))
+void hashLanesAVX2(const uint32_t initialValue[8], const Lane* const* lanes)
+{
+  hashLanes<Vector8, 8>(initialValue, lanes);
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw")))
+void hashLanesAVX512(const uint32_t initialValue[8], const Lane* const* lanes)
+{
+  hashLanes<Vector16, 16>(initialValue, lanes);
+}
+#endif // LIBSTRIEZEL_HASH_X86
+
+bool isSupported(const BatchImplementation impl)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  const libstriezel::hash::CpuFeatures& features = libstriezel::hash::cpuFeatures();
+  #endif
+  switch (impl)
+  {
+    case BatchImplementation::Sequential:
+         return true;
+    #if defined(LIBSTRIEZEL_HASH_X86)
+    case BatchImplementation::SSE41:
+         return features.sse41;
+    case BatchImplementation::AVX2:
+         return features.avx2;
+    case BatchImplementation::AVX512:
+         return features.avx512;
+    #else
+    case BatchImplementation::SSE41:
+    case BatchImplementation::AVX2:
+    case BatchImplementation::AVX512:
+         return false;
+    #endif
+  }//swi
+  return false;
+}
+
+/* returns the batch implementation that is expected to be the fastest */
+BatchImplementation detectBestBatchImplementation()
+{
+  if (isSupported(BatchImplementation::AVX512))
+    return BatchImplementation::AVX512;
+  // The SHA extensions beat four or eight lanes without them.
+  if (isSupported(Implementation::SHANI))
+    return BatchImplementation::Sequential;
+  if (isSupported(BatchImplementation::AVX2))
+    return BatchImplementation::AVX2;
+  if (isSupported(BatchImplementation::SSE41))
+    return BatchImplementation::SSE41;
+  return BatchImplementation::Sequential;
+}
+
+/* returns the variable that holds the active batch implementation */
+std::atomic<BatchImplementation>& activeBatchImplementation()
+{
+  static std::atomic<BatchImplementation> impl(detectBestBatchImplementation());
+  return impl;
+}
+
+BatchImplementation getBatchImplementation()
+{
+  return activeBatchImplementation().load(std::memory_order_relaxed);
+}
+
+bool setBatchImplementation(const BatchImplementation impl)
+{
+  if (!isSupported(impl))
+    return false;
+  activeBatchImplementation().store(impl, std::memory_order_relaxed);
+  return true;
+}
+
+void computeBatchStates(const uint32_t initialValue[8], const BatchMessage* messages, const std::size_t count, uint32_t* const* states)
+{
+  std::vector<Lane> lanes(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    prepareLane(lanes[i], messages[i], states[i]);
+  }
+
+  const BatchImplementation impl = getBatchImplementation();
+  unsigned int width = 1;
+  switch (impl)
+  {
+    case BatchImplementation::Sequential:
+         for (const Lane& lane : lanes)
+         {
+           hashLaneSequential(initialValue, lane);
+         }
+         return;
+    case BatchImplementation::SSE41:
+         width = 4;
+         break;
+    case BatchImplementation::AVX2:
+         width = 8;
+         break;
+    case BatchImplementation::AVX512:
+         width = 16;
+         break;
+  }//swi
+
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  // Lanes of a group are busy until the longest message is done, so group
+  // messages of similar length.
+  std::vector<const Lane*> order(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    order[i] = &lanes[i];
+  }
+  std::stable_sort(order.begin(), order.end(),
+      [](const Lane* x, const Lane* y) { return x->blocks > y->blocks; });
+
+  const Lane* group[16];
+  for (std::size_t first = 0; first < count; first += width)
+  {
+    for (unsigned int l = 0; l < width; ++l)
+    {
+      group[l] = (first + l < count) ? order[first + l] : nullptr;
+    }
+    switch (impl)
+    {
+      case BatchImplementation::SSE41:
+           hashLanesSSE41(initialValue, group);
+           break;
+      case BatchImplementation::AVX2:
+           hashLanesAVX2(initialValue, group);
+           break;
+      case BatchImplementation::AVX512:
+           hashLanesAVX512(initialValue, group);
+           break;
+      case BatchImplementation::Sequential:
+           break;
+    }//swi
+  }
+  #else
+  (void) width;
+  #endif
+}
+
+std::vector<MessageDigest> computeFromBuffers(const std::vector<BatchMessage>& messages)
+{
+  std::vector<MessageDigest> digests(messages.size());
+  if (messages.empty())
+    return digests;
+  std::vector<uint32_t*> states(messages.size());
+  for (std::size_t i = 0; i < messages.size(); ++i)
+  {
+    states[i] = digests[i].hash;
+  }
+  computeBatchStates(SHA2::SHA256Parameters::initialValue, messages.data(), messages.size(), states.data());
+  return digests;
+}
+
+} //namespace
@@ -0,0 +1,99 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA256_BATCHUTILITY_HPP
+#define LIBSTRIEZEL_SHA256_BATCHUTILITY_HPP
+
+#include <cstddef>
+#include <vector>
+#include "sha256.hpp"
+
+namespace SHA256
+{
+
+/// a single message for batch hashing
+struct BatchMessage
+{
+  const uint8_t* data; /**< pointer to the message data */
+  std::size_t length;  /**< length of the message in bytes */
+};
+
+
+/// implementations for hashing several messages at once
+enum class BatchImplementation
+{
+  Sequential, /**< one message after another, using compressBlocks() */
+  SSE41,      /**< four messages in parallel, using SSE 4.1 */
+  AVX2,       /**< eight messages in parallel, using AVX2 */
+  AVX512      /**< sixteen messages in parallel, using AVX-512 */
+};
+
+
+/** \brief checks whether a batch implementation can be used on this machine
+ *
+ * \param impl  the implementation
+ * \return Returns true, if the implementation is supported.
+ */
+bool isSupported(const BatchImplementation impl);
+
+
+/** \brief gets the batch implementation that is currently used
+ *
+ * \return Returns the implementation used by computeFromBuffers().
+ * \remarks By default, the implementation with the most parallel lanes is
+ *          used. However, the sequential implementation is preferred over
+ *          SSE 4.1 and AVX2 lanes when the SHA extensions are present.
+ */
+BatchImplementation getBatchImplementation();
+
+
+/** \brief sets the batch implementation
+ *
+ * \param impl  the implementation that shall be used
+ * \return Returns true, if the implementation was changed.
+ *         Returns false, if the implementation is not supported.
+ */
+bool setBatchImplementation(const BatchImplementation impl);
+
+
+/** \brief computes the final hash values of several messages
+ *
+ * \param initialValue  the initial hash value (differs for SHA-224)
+ * \param messages      pointer to the messages
+ * \param count         number of messages
+ * \param states        array of count pointers to hash values (eight words
+ *                      each) that will hold the final hash values
+ * \remarks This is the shared core of the SHA-224 and SHA-256 batch
+ *          functions. Messages of similar length are grouped together,
+ *          so batches of equally sized messages are processed best.
+ */
+void computeBatchStates(const uint32_t initialValue[8], const BatchMessage* messages, const std::size_t count, uint32_t* const* states);
+
+
+/** \brief computes the message digests of several messages at once
+ *
+ * \param messages  the messages
+ * \return Returns the SHA256 message digests in the order of the messages.
+ */
+std::vector<MessageDigest> computeFromBuffers(const std::vector<BatchMessage>& messages);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA256_BATCHUTILITY_HPP
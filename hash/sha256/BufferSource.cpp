@@ -26,7 +26,7 @@ namespace SHA256
 {
 
 /* BufferSource functions */
-BufferSource::BufferSource(uint8_t* data, uint64_t data_length_in_bits)
+BufferSource::BufferSource(const uint8_t* data, uint64_t data_length_in_bits)
 : MessageSource(), m_BufferPointer(data),
   m_BufferSize((data_length_in_bits/8) + ((data_length_in_bits%8)>0)) //we want full bytes only
 {
@@ -35,7 +35,6 @@ BufferSource::BufferSource(uint8_t* data, uint64_t data_length_in_bits)
   const unsigned int remainingDataBits = (m_BufferSize*8)%512;
   if (remainingDataBits>440)
   {
-    m_PaddingBuffer = new uint8_t[1024/8];
     //zero out all bits
     memset(m_PaddingBuffer, 0, 1024/8);
     //copy remainder
@@ -50,7 +49,6 @@ BufferSource::BufferSource(uint8_t* data, uint64_t data_length_in_bits)
   }
   else
   {
-    m_PaddingBuffer = new uint8_t[512/8];
     //zero out all bits
     memset(m_PaddingBuffer, 0, 512/8);
     //copy remainder
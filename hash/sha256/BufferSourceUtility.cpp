@@ -19,15 +19,26 @@
 */
 
 #include "BufferSourceUtility.hpp"
-#include "BufferSource.hpp"
+#include "Hasher.hpp"
 
 namespace SHA256
 {
 
-MessageDigest computeFromBuffer(uint8_t* data, const uint64_t data_length_in_bits)
+MessageDigest computeFromBuffer(const uint8_t* data, const uint64_t data_length_in_bits)
 {
-  BufferSource source(data, data_length_in_bits);
-  return computeFromSource(source);
+  Hasher hasher;
+  //only full bytes are used, the length is rounded up like in BufferSource
+  hasher.update(data, static_cast<std::size_t>((data_length_in_bits / 8) + ((data_length_in_bits % 8) > 0)));
+  return hasher.finalize();
+}
+
+MessageDigest hash(const void* data, const std::size_t length)
+{
+  //the hasher keeps the incomplete last block in a member array, so a
+  //hasher on the stack needs no further memory
+  Hasher hasher;
+  hasher.update(data, length);
+  return hasher.finalize();
 }
 
 } //namespace
@@ -22,6 +22,7 @@
 #define LIBSTRIEZEL_SHA256_FILESOURCEUTILITY_HPP
 
 #include "sha256.hpp"
+#include "Hasher.hpp"
 
 namespace SHA256
 {
@@ -35,6 +36,23 @@ namespace SHA256
  */
 MessageDigest computeFromFile(const std::string& fileName);
 
+
+/** \brief continues hashing of a file from a previously saved midstate
+ *
+ * \param fileName    name of the file
+ * \param resumeFrom  midstate after the first resumeFrom.length bytes of
+ *                    the file, e.g. a checkpoint of a previous call or
+ *                    the midstate of a new Hasher to start anew
+ * \param checkpoint  receives the midstate after all complete blocks of the
+ *                    file, which allows to resume again once the file grew
+ * \return Returns the SHA256 message digest of the whole file on success.
+ *         Returns the "null" message digest (i.e. all bits set to zero),
+ *         if an error occurred or the file is shorter than resumeFrom.length.
+ * \remarks Only the data after resumeFrom.length is read, so this is only
+ *          correct for files that were appended to since the checkpoint.
+ */
+MessageDigest computeFromFile(const std::string& fileName, const Hasher::Midstate& resumeFrom, Hasher::Midstate& checkpoint);
+
 } //namespace
 
 #endif // LIBSTRIEZEL_SHA256_FILESOURCEUTILITY_HPP
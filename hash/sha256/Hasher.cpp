@@ -0,0 +1,182 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "Hasher.hpp"
+#include <algorithm>
+#include <cstring>
+#include "compression.hpp"
+#include "../sha2_core.hpp"
+
+namespace SHA256
+{
+
+Hasher::Hasher()
+: Hasher(SHA2::SHA256Parameters::initialValue)
+{
+}
+
+Hasher::Hasher(const uint32_t initialValue[8])
+: m_InitialValue(), m_State(), m_Tail(), m_TailLength(0), m_Length(0)
+{
+  std::copy(initialValue, initialValue + 8, m_InitialValue);
+  reset();
+}
+
+void Hasher::reset()
+{
+  std::copy(m_InitialValue, m_InitialValue + 8, m_State);
+  m_TailLength = 0;
+  m_Length = 0;
+}
+
+void Hasher::update(const void* data, const std::size_t length)
+{
+  // data may be null for empty input, which memcpy() does not allow
+  if (length == 0)
+    return;
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  std::size_t remaining = length;
+  m_Length += length;
+  // complete a previously started block first
+  if (m_TailLength > 0)
+  {
+    const std::size_t count = std::min(remaining, 64 - m_TailLength);
+    memcpy(m_Tail + m_TailLength, bytes, count);
+    m_TailLength += count;
+    bytes += count;
+    remaining -= count;
+    if (m_TailLength < 64)
+      return;
+    compressBlocks(m_State, m_Tail, 1);
+    m_TailLength = 0;
+  }
+  // full blocks are processed in place
+  const std::size_t blocks = remaining / 64;
+  if (blocks > 0)
+  {
+    compressBlocks(m_State, bytes, blocks);
+    bytes += 64 * blocks;
+    remaining -= 64 * blocks;
+  }
+  if (remaining > 0)
+  {
+    memcpy(m_Tail, bytes, remaining);
+    m_TailLength = remaining;
+  }
+}
+
+uint64_t Hasher::length() const
+{
+  return m_Length;
+}
+
+void Hasher::finalizeState(uint32_t result[8])
+{
+  const uint64_t bits = m_Length * 8;
+  //add 1-bit
+  m_Tail[m_TailLength++] = 0x80;
+  if (m_TailLength > 56)
+  {
+    memset(m_Tail + m_TailLength, 0, 64 - m_TailLength);
+    compressBlocks(m_State, m_Tail, 1);
+    m_TailLength = 0;
+  }
+  memset(m_Tail + m_TailLength, 0, 56 - m_TailLength);
+  //add data length in bits (big endian)
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    m_Tail[63 - i] = static_cast<uint8_t>(bits >> (8 * i));
+  }
+  compressBlocks(m_State, m_Tail, 1);
+  std::copy(m_State, m_State + 8, result);
+  reset();
+}
+
+Hasher::Midstate Hasher::exportMidstate() const
+{
+  Midstate midstate;
+  std::copy(m_State, m_State + 8, midstate.state);
+  midstate.length = m_Length - m_TailLength;
+  return midstate;
+}
+
+bool Hasher::importMidstate(const Midstate& midstate)
+{
+  if (midstate.length % 64 != 0)
+    return false;
+  std::copy(midstate.state, midstate.state + 8, m_State);
+  m_Length = midstate.length;
+  m_TailLength = 0;
+  return true;
+}
+
+std::string Hasher::Midstate::toHexString() const
+{
+  const char cHexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+  std::string result;
+  result.reserve(80);
+  for (unsigned int i = 0; i < 9; ++i)
+  {
+    const uint64_t value = (i < 8) ? state[i] : length;
+    const unsigned int digits = (i < 8) ? 8 : 16;
+    for (unsigned int j = digits; j > 0; --j)
+    {
+      result.push_back(cHexDigits[(value >> (4 * (j - 1))) & 0x0F]);
+    }
+  }
+  return result;
+}
+
+bool Hasher::Midstate::fromHexString(const std::string& midstateHexString)
+{
+  if (midstateHexString.size() != 80)
+    return false;
+  uint64_t values[9] = { 0 };
+  for (std::size_t pos = 0; pos < midstateHexString.size(); ++pos)
+  {
+    const char c = midstateHexString[pos];
+    uint64_t digit = 0;
+    if ((c >= '0') && (c <= '9'))
+      digit = c - '0';
+    else if ((c >= 'a') && (c <= 'f'))
+      digit = c - 'a' + 10;
+    else
+      return false;
+    const std::size_t index = (pos < 64) ? pos / 8 : 8;
+    values[index] = (values[index] << 4) | digit;
+  }
+  if (values[8] % 64 != 0)
+    return false;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    state[i] = static_cast<uint32_t>(values[i]);
+  }
+  length = values[8];
+  return true;
+}
+
+MessageDigest Hasher::finalize()
+{
+  MessageDigest md;
+  finalizeState(md.hash);
+  return md;
+}
+
+} //namespace
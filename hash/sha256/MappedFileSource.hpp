@@ -0,0 +1,90 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA256_MAPPEDFILESOURCE_HPP
+#define LIBSTRIEZEL_SHA256_MAPPEDFILESOURCE_HPP
+
+#include <cstddef>
+#include <string>
+#include "MessageSource.hpp"
+#include "../MappedFile.hpp"
+
+namespace SHA256
+{
+
+/** \brief message source class for memory-mapped files
+ *
+ * \remarks Besides the block-wise access of a message source, the mapped
+ *          data is also available directly via data() and size(), so it can
+ *          be passed to Hasher::update() in one piece.
+ */
+class MappedFileSource: public MessageSource
+{
+  public:
+    /** \brief constructor */
+    MappedFileSource();
+
+
+    /** \brief destructor */
+    virtual ~MappedFileSource();
+
+
+    /** \brief puts the next message block from the source in mBlock
+     *
+     * \param mBlock  reference to the message block that should be filled
+     * \return Returns true, if there is at least one more message block.
+     *         Returns false and leaves mBlock unchanged, if there are no more
+     *         message blocks.
+     */
+    virtual bool getNextMessageBlock(MessageBlock& mBlock);
+
+
+    /** \brief maps the given file and prepares for reading from it
+     *
+     * \param fileName  name (absolute or relative path) of the file
+     * \return Returns true, if the file was mapped successfully.
+     *         Returns false, if the file cannot be mapped. In that case the
+     *         FileSource class can still be used to read the file.
+     */
+    bool open(const std::string& fileName);
+
+
+    /** \brief gets a pointer to the content of the mapped file
+     *
+     * \return Returns a pointer to the file content.
+     */
+    const uint8_t* data() const;
+
+
+    /** \brief gets the size of the mapped file
+     *
+     * \return Returns the file size in bytes.
+     */
+    std::size_t size() const;
+  private:
+    /** \brief creates the padded final block(s) of the message */
+    void preparePadding();
+
+    libstriezel::hash::MappedFile m_File; /**< the mapped file */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA256_MAPPEDFILESOURCE_HPP
@@ -70,7 +70,7 @@ void MessageBlock::reverseBlock()
 /* MessageSource functions */
 MessageSource::MessageSource()
 : m_BitsRead(0),
-  m_PaddingBuffer((uint8_t*) 0),
+  m_PaddingBuffer(),
   m_Status(psUnpadded)
 {
 
@@ -78,11 +78,6 @@ MessageSource::MessageSource()
 
 MessageSource::~MessageSource()
 {
-  if (m_PaddingBuffer!=(uint8_t*) 0)
-  {
-    delete[] m_PaddingBuffer;
-    m_PaddingBuffer = 0;
-  }
 }
 
 } //namespace
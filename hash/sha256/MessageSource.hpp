@@ -74,7 +74,7 @@ class MessageSource
     virtual bool getNextMessageBlock(MessageBlock& mBlock) = 0;
   protected:
     uint64_t m_BitsRead;
-    uint8_t * m_PaddingBuffer;
+    uint8_t m_PaddingBuffer[128]; /**< final padded block(s) of the message */
     enum PaddingStatus {psUnpadded, psPadded512, psPadded1024, psPadded1024And512Read, psPaddedAndAllRead};
     PaddingStatus m_Status;
 }; //class
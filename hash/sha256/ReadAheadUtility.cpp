@@ -0,0 +1,80 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "ReadAheadUtility.hpp"
+#include <iostream>
+#include "Hasher.hpp"
+
+namespace SHA256
+{
+
+/* hashes all data of the reader
+
+   parameters:
+       reader - the reader, reading has to be started
+   return value:
+       Returns the message digest, or the "null" digest if reading failed.
+*/
+MessageDigest hashFromReader(libstriezel::hash::ReadAheadReader& reader)
+{
+  Hasher hasher;
+  const uint8_t* data = nullptr;
+  std::size_t length = 0;
+  while (reader.next(data, length))
+  {
+    hasher.update(data, length);
+  }
+  if (reader.failed())
+    return MessageDigest();
+  return hasher.finalize();
+}
+
+MessageDigest computeFromFileReadAhead(const std::string& fileName, const std::size_t readSize, const unsigned int queueDepth,
+                                       const libstriezel::hash::CacheMode cacheMode)
+{
+  libstriezel::hash::ReadAheadReader reader(readSize, queueDepth, cacheMode);
+  if (!reader.open(fileName))
+  {
+    std::cout << "Could not open file \""<<fileName<<"\" for reading!\n";
+    return MessageDigest();
+  }
+  const MessageDigest digest = hashFromReader(reader);
+  if (digest.isNull())
+    std::cout << "Could not read file \""<<fileName<<"\"!\n";
+  return digest;
+}
+
+MessageDigest computeFromStream(std::istream& stream)
+{
+  libstriezel::hash::ReadAheadReader reader;
+  if (!reader.open(stream))
+    return MessageDigest();
+  return hashFromReader(reader);
+}
+
+MessageDigest computeFromDescriptor(const int descriptor)
+{
+  libstriezel::hash::ReadAheadReader reader;
+  if (!reader.open(descriptor))
+    return MessageDigest();
+  return hashFromReader(reader);
+}
+
+} //namespace
@@ -0,0 +1,193 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "TreeHash.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include "Hasher.hpp"
+#include "../MappedFile.hpp"
+#include "../ReadAheadReader.hpp"
+
+namespace SHA256
+{
+
+const uint8_t leafPrefix = 0x00;
+const uint8_t parentPrefix = 0x01;
+
+MessageDigest computeLeafHash(const uint8_t* data, const std::size_t length)
+{
+  Hasher hasher;
+  hasher.update(&leafPrefix, 1);
+  hasher.update(data, length);
+  return hasher.finalize();
+}
+
+MessageDigest computeParentHash(const MessageDigest& left, const MessageDigest& right)
+{
+  // The words of the digests are stored in host byte order.
+  uint8_t buffer[65];
+  buffer[0] = parentPrefix;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    for (unsigned int j = 0; j < 4; ++j)
+    {
+      buffer[1 + 4 * i + j] = static_cast<uint8_t>(left.hash[i] >> (24 - 8 * j));
+      buffer[33 + 4 * i + j] = static_cast<uint8_t>(right.hash[i] >> (24 - 8 * j));
+    }
+  }
+  Hasher hasher;
+  hasher.update(buffer, sizeof(buffer));
+  return hasher.finalize();
+}
+
+std::size_t leafCount(const uint64_t length, const std::size_t leafSize)
+{
+  if ((length == 0) || (leafSize == 0))
+    return 1;
+  return static_cast<std::size_t>((length + leafSize - 1) / leafSize);
+}
+
+std::vector<MessageDigest> computeLeafHashes(const uint8_t* data, const std::size_t length, const std::size_t leafSize, const unsigned int maxThreads)
+{
+  if (leafSize == 0)
+    return std::vector<MessageDigest>();
+  const std::size_t count = leafCount(length, leafSize);
+  std::vector<MessageDigest> leaves(count);
+  // Threads take the next leaf that is not done yet.
+  std::atomic<std::size_t> nextLeaf(0);
+  const auto work = [&]()
+  {
+    std::size_t i;
+    while ((i = nextLeaf.fetch_add(1, std::memory_order_relaxed)) < count)
+    {
+      const std::size_t offset = i * leafSize;
+      leaves[i] = computeLeafHash(data + offset, std::min(leafSize, length - offset));
+    }
+  };
+  unsigned int threads = (maxThreads != 0) ? maxThreads : std::thread::hardware_concurrency();
+  threads = static_cast<unsigned int>(std::min<std::size_t>(std::max(threads, 1u), count));
+  std::vector<std::thread> workers;
+  for (unsigned int t = 1; t < threads; ++t)
+  {
+    workers.emplace_back(work);
+  }
+  work();
+  for (std::thread& worker : workers)
+  {
+    worker.join();
+  }
+  return leaves;
+}
+
+/* computes the root of the subtree of the leaves [first; first + count) */
+MessageDigest computeSubtreeRoot(const std::vector<MessageDigest>& leafHashes, const std::size_t first, const std::size_t count)
+{
+  if (count == 1)
+    return leafHashes[first];
+  // largest power of two that is smaller than count
+  std::size_t k = 1;
+  while (k < count - k)
+  {
+    k <<= 1;
+  }
+  return computeParentHash(computeSubtreeRoot(leafHashes, first, k),
+                           computeSubtreeRoot(leafHashes, first + k, count - k));
+}
+
+MessageDigest computeRoot(const std::vector<MessageDigest>& leafHashes)
+{
+  if (leafHashes.empty())
+    return MessageDigest();
+  return computeSubtreeRoot(leafHashes, 0, leafHashes.size());
+}
+
+MessageDigest computeTreeHashFromBuffer(const uint8_t* data, const std::size_t length, const std::size_t leafSize, const unsigned int maxThreads)
+{
+  return computeRoot(computeLeafHashes(data, length, leafSize, maxThreads));
+}
+
+std::vector<MessageDigest> computeLeafHashesFromFile(const std::string& fileName, const std::size_t leafSize, const unsigned int maxThreads)
+{
+  if (leafSize == 0)
+    return std::vector<MessageDigest>();
+  libstriezel::hash::MappedFile mapped;
+  if (mapped.open(fileName))
+  {
+    return computeLeafHashes(mapped.data(), mapped.size(), leafSize, maxThreads);
+  }
+
+  libstriezel::hash::ReadAheadReader reader;
+  if (!reader.open(fileName))
+    return std::vector<MessageDigest>();
+  std::vector<MessageDigest> leaves;
+  Hasher hasher;
+  hasher.update(&leafPrefix, 1);
+  std::size_t leafFill = 0;
+  const uint8_t* data = nullptr;
+  std::size_t length = 0;
+  while (reader.next(data, length))
+  {
+    while (length > 0)
+    {
+      const std::size_t count = std::min(length, leafSize - leafFill);
+      hasher.update(data, count);
+      leafFill += count;
+      data += count;
+      length -= count;
+      if (leafFill == leafSize)
+      {
+        leaves.push_back(hasher.finalize());
+        hasher.update(&leafPrefix, 1);
+        leafFill = 0;
+      }
+    } //while
+  } //while
+  if (reader.failed())
+    return std::vector<MessageDigest>();
+  // incomplete last leaf or empty input
+  if ((leafFill > 0) || leaves.empty())
+    leaves.push_back(hasher.finalize());
+  return leaves;
+}
+
+MessageDigest computeTreeHashFromFile(const std::string& fileName, const std::size_t leafSize, const unsigned int maxThreads)
+{
+  return computeRoot(computeLeafHashesFromFile(fileName, leafSize, maxThreads));
+}
+
+bool verifyLeafRange(const uint8_t* data, const std::size_t length, const std::size_t firstLeaf, const std::size_t leafSize,
+                     const std::vector<MessageDigest>& leafHashes, const MessageDigest& root)
+{
+  if ((leafSize == 0) || (firstLeaf >= leafHashes.size()))
+    return false;
+  const std::vector<MessageDigest> leaves = computeLeafHashes(data, length, leafSize, 1);
+  if (leaves.size() > leafHashes.size() - firstLeaf)
+    return false;
+  // Only the last leaf of the input may be incomplete.
+  const bool containsLastLeaf = (firstLeaf + leaves.size() == leafHashes.size());
+  if (!containsLastLeaf && (length % leafSize != 0))
+    return false;
+  if (!std::equal(leaves.begin(), leaves.end(), leafHashes.begin() + firstLeaf))
+    return false;
+  return computeRoot(leafHashes) == root;
+}
+
+} //namespace
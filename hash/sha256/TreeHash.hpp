@@ -0,0 +1,162 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA256_TREEHASH_HPP
+#define LIBSTRIEZEL_SHA256_TREEHASH_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "sha256.hpp"
+
+/* Tree hash mode for SHA-256
+
+   The input is split into leaves of a fixed size. Only the last leaf may be
+   shorter. Empty input consists of one empty leaf. The leaf size is a
+   parameter of the tree hash, so both sides must use the same value.
+
+   The encoding follows the Merkle tree hash of RFC 6962 and is stable:
+
+     leaf hash   = SHA-256(0x00 || leaf data)
+     parent hash = SHA-256(0x01 || left child hash || right child hash)
+
+   For n > 1 leaves, the left subtree holds the first k leaves, where k is
+   the largest power of two that is smaller than n. The right subtree holds
+   the remaining n - k leaves. A single leaf is its own root.
+
+   The tree hash is NOT the same as the plain SHA-256 of the input.
+*/
+
+namespace SHA256
+{
+
+/// default size of a leaf in bytes (1 MiB)
+const std::size_t defaultLeafSize = 1024 * 1024;
+
+
+/** \brief computes the hash of a single leaf
+ *
+ * \param data    pointer to the data of the leaf
+ * \param length  length of the leaf data in bytes
+ * \return Returns SHA-256(0x00 || data).
+ */
+MessageDigest computeLeafHash(const uint8_t* data, const std::size_t length);
+
+
+/** \brief computes the hash of an inner node
+ *
+ * \param left   hash of the left child
+ * \param right  hash of the right child
+ * \return Returns SHA-256(0x01 || left || right).
+ */
+MessageDigest computeParentHash(const MessageDigest& left, const MessageDigest& right);
+
+
+/** \brief gets the number of leaves for input of the given length
+ *
+ * \param length    length of the input in bytes
+ * \param leafSize  size of a leaf in bytes
+ * \return Returns the number of leaves, at least one.
+ */
+std::size_t leafCount(const uint64_t length, const std::size_t leafSize);
+
+
+/** \brief computes the hashes of all leaves of a buffer
+ *
+ * \param data        pointer to the data
+ * \param length      length of the data in bytes
+ * \param leafSize    size of a leaf in bytes, must not be zero
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns the leaf hashes in the order of the leaves.
+ *         Returns an empty vector, if leafSize is zero.
+ * \remarks The data may also be a range of leaves out of a larger input, as
+ *          long as it starts at a leaf boundary.
+ */
+std::vector<MessageDigest> computeLeafHashes(const uint8_t* data, const std::size_t length, const std::size_t leafSize, const unsigned int maxThreads = 0);
+
+
+/** \brief computes the root hash from the leaf hashes
+ *
+ * \param leafHashes  the hashes of all leaves
+ * \return Returns the root hash of the tree.
+ *         Returns the "null" message digest, if leafHashes is empty.
+ */
+MessageDigest computeRoot(const std::vector<MessageDigest>& leafHashes);
+
+
+/** \brief computes the tree hash of a buffer
+ *
+ * \param data        pointer to the data
+ * \param length      length of the data in bytes
+ * \param leafSize    size of a leaf in bytes
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns the root hash on success.
+ *         Returns the "null" message digest, if leafSize is zero.
+ */
+MessageDigest computeTreeHashFromBuffer(const uint8_t* data, const std::size_t length, const std::size_t leafSize = defaultLeafSize, const unsigned int maxThreads = 0);
+
+
+/** \brief computes the hashes of all leaves of a file
+ *
+ * \param fileName    name of the file
+ * \param leafSize    size of a leaf in bytes
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns the leaf hashes in the order of the leaves.
+ *         Returns an empty vector, if an error occurred.
+ * \remarks Only regular files that can be memory-mapped are hashed in
+ *          parallel, other files are read and hashed sequentially.
+ */
+std::vector<MessageDigest> computeLeafHashesFromFile(const std::string& fileName, const std::size_t leafSize = defaultLeafSize, const unsigned int maxThreads = 0);
+
+
+/** \brief computes the tree hash of a file
+ *
+ * \param fileName    name of the file
+ * \param leafSize    size of a leaf in bytes
+ * \param maxThreads  maximum number of threads, zero means one thread per
+ *                    available processor core
+ * \return Returns the root hash on success.
+ *         Returns the "null" message digest, if an error occurred.
+ */
+MessageDigest computeTreeHashFromFile(const std::string& fileName, const std::size_t leafSize = defaultLeafSize, const unsigned int maxThreads = 0);
+
+
+/** \brief verifies a range of leaves against known leaf hashes and root
+ *
+ * \param data        pointer to the data of the leaf range
+ * \param length      length of the data in bytes
+ * \param firstLeaf   index of the first leaf in the range
+ * \param leafSize    size of a leaf in bytes
+ * \param leafHashes  the known hashes of all leaves of the input
+ * \param root        the known root hash
+ * \return Returns true, if the data matches the leaf hashes and the leaf
+ *         hashes match the root hash. Returns false otherwise.
+ * \remarks The data has to start at the beginning of leaf firstLeaf. Only
+ *          the last leaf of the whole input may be shorter than leafSize.
+ */
+bool verifyLeafRange(const uint8_t* data, const std::size_t length, const std::size_t firstLeaf, const std::size_t leafSize,
+                     const std::vector<MessageDigest>& leafHashes, const MessageDigest& root);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA256_TREEHASH_HPP
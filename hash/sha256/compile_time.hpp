@@ -0,0 +1,171 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA256_COMPILE_TIME_HPP
+#define LIBSTRIEZEL_SHA256_COMPILE_TIME_HPP
+
+#include <array>
+#include <cstddef>
+#include <stdint.h>
+#include <string_view>
+#include "functions.hpp"
+#include "sha256.hpp"
+#include "../sha2_core.hpp"
+
+/* This file contains a constexpr implementation of SHA-256. It allows to
+   compute digests of string literals and other constant data at compile
+   time, e.g.
+
+     constexpr SHA256::MessageDigest digest = SHA256::computeConstexpr("abc");
+
+   The implementation is slow compared to the runtime implementations and
+   the compiler limits the number of evaluation steps, so it is meant for
+   short data (a few kilobytes at most). Use the usual sources for data that
+   is only known at runtime. */
+
+namespace SHA256
+{
+
+namespace compile_time
+{
+
+/* compression function for a single block of 64 bytes
+
+   parameters:
+       state - the intermediate hash value
+       block - pointer to the block in message byte order
+*/
+template<typename Byte>
+constexpr void compressBlock(uint32_t (&state)[8], const Byte* block)
+{
+  uint32_t w[64] = { 0 };
+  for (unsigned int t = 0; t < 16; ++t)
+  {
+    w[t] = (static_cast<uint32_t>(static_cast<uint8_t>(block[4 * t])) << 24)
+         | (static_cast<uint32_t>(static_cast<uint8_t>(block[4 * t + 1])) << 16)
+         | (static_cast<uint32_t>(static_cast<uint8_t>(block[4 * t + 2])) << 8)
+         | static_cast<uint32_t>(static_cast<uint8_t>(block[4 * t + 3]));
+  }
+  for (unsigned int t = 16; t < 64; ++t)
+  {
+    w[t] = sigmaOne(w[t-2]) + w[t-7] + sigmaZero(w[t-15]) + w[t-16];
+  }
+
+  uint32_t a = state[0];
+  uint32_t b = state[1];
+  uint32_t c = state[2];
+  uint32_t d = state[3];
+  uint32_t e = state[4];
+  uint32_t f = state[5];
+  uint32_t g = state[6];
+  uint32_t h = state[7];
+  for (unsigned int t = 0; t < 64; ++t)
+  {
+    const uint32_t temp1 = h + CapitalSigmaOne(e) + SHA1_256::Ch(e, f, g) + sha256_k[t] + w[t];
+    const uint32_t temp2 = CapitalSigmaZero(a) + SHA1_256::Maj(a, b, c);
+    h = g;
+    g = f;
+    f = e;
+    e = d + temp1;
+    d = c;
+    c = b;
+    b = a;
+    a = temp1 + temp2;
+  }
+
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+  state[5] += f;
+  state[6] += g;
+  state[7] += h;
+}
+
+
+/* computes the final hash value of a message
+
+   parameters:
+       data   - pointer to the message
+       length - length of the message in bytes
+*/
+template<typename Byte>
+constexpr MessageDigest compute(const Byte* data, const std::size_t length)
+{
+  uint32_t state[8] = { 0 };
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    state[i] = SHA2::SHA256Parameters::initialValue[i];
+  }
+  const std::size_t fullBlocks = length / 64;
+  for (std::size_t i = 0; i < fullBlocks; ++i)
+  {
+    compressBlock(state, data + 64 * i);
+  }
+
+  // last one or two blocks with padding and message length
+  uint8_t tail[128] = { 0 };
+  const std::size_t remainder = length % 64;
+  for (std::size_t i = 0; i < remainder; ++i)
+  {
+    tail[i] = static_cast<uint8_t>(data[64 * fullBlocks + i]);
+  }
+  tail[remainder] = 0x80;
+  const std::size_t tailLength = (remainder > 55) ? 128 : 64;
+  const uint64_t bits = static_cast<uint64_t>(length) * 8;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    tail[tailLength - 1 - i] = static_cast<uint8_t>(bits >> (8 * i));
+  }
+  compressBlock(state, tail);
+  if (tailLength == 128)
+    compressBlock(state, tail + 64);
+  return MessageDigest(state);
+}
+
+} //namespace compile_time
+
+
+/** \brief computes the SHA-256 message digest of a string at compile time
+ *
+ * \param message  the message, e.g. a string literal
+ * \return Returns the message digest of the message.
+ */
+constexpr MessageDigest computeConstexpr(const std::string_view message)
+{
+  return compile_time::compute(message.data(), message.size());
+}
+
+
+/** \brief computes the SHA-256 message digest of a byte array at compile time
+ *
+ * \param message  the message
+ * \return Returns the message digest of the message.
+ */
+template<std::size_t N>
+constexpr MessageDigest computeConstexpr(const std::array<uint8_t, N>& message)
+{
+  return compile_time::compute(message.data(), N);
+}
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA256_COMPILE_TIME_HPP
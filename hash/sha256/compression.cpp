@@ -0,0 +1,189 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2012, 2015, 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "compression.hpp"
+#include <atomic>
+#include <cstring>
+#include "functions.hpp"
+#include "../cpu_features.hpp"
+#include "../sha2_core.hpp"
+#if defined(LIBSTRIEZEL_HASH_X86)
+#include <immintrin.h>
+#endif
+
+namespace SHA256
+{
+
+/* scalar implementation
+
+   parameters:
+       state - the intermediate hash value
+       words - the message block as 16 words in host byte order
+*/
+void compressScalar(uint32_t state[8], const uint32_t words[16])
+{
+  SHA2::compress<SHA2::SHA256Parameters>(state, words);
+}
+
+#if defined(LIBSTRIEZEL_HASH_X86)
+/* implementation using the SHA extensions
+
+   parameters:
+       state      - the intermediate hash value
+       data       - pointer to the message blocks
+       blockCount - number of blocks in data
+       swapBytes  - whether the words in data are in message byte order (true)
+                    or have already been converted to host byte order (false)
+*/
+__attribute__((target("sha,sse4.1")))
+void compressSHANI(uint32_t state[8], const uint8_t* data, std::size_t blockCount, const bool swapBytes)
+{
+  const __m128i byteSwapMask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+  // The SHA instructions expect the state as ABEF and CDGH.
+  __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+  __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+  tmp = _mm_shuffle_epi32(tmp, 0xB1); // CDAB
+  state1 = _mm_shuffle_epi32(state1, 0x1B); // EFGH
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0); // CDGH
+
+  while (blockCount > 0)
+  {
+    const __m128i abefSave = state0;
+    const __m128i cdghSave = state1;
+    __m128i w[4];
+    #if defined(__GNUC__)
+    #pragma GCC unroll 16
+    #endif
+    for (unsigned int g = 0; g < 16; ++g)
+    {
+      if (g < 4)
+      {
+        w[g] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * g));
+        if (swapBytes)
+          w[g] = _mm_shuffle_epi8(w[g], byteSwapMask);
+      }
+      else
+      {
+        // W[t] for the next four rounds from W[t-16] ... W[t-1]
+        w[g % 4] = _mm_sha256msg2_epu32(
+                     _mm_add_epi32(_mm_sha256msg1_epu32(w[g % 4], w[(g + 1) % 4]),
+                                   _mm_alignr_epi8(w[(g + 3) % 4], w[(g + 2) % 4], 4)),
+                     w[(g + 3) % 4]);
+      }
+      __m128i msg = _mm_add_epi32(w[g % 4],
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&sha256_k[4 * g])));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+      msg = _mm_shuffle_epi32(msg, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    } //for g
+
+    state0 = _mm_add_epi32(state0, abefSave);
+    state1 = _mm_add_epi32(state1, cdghSave);
+    data += 64;
+    --blockCount;
+  } //while
+
+  tmp = _mm_shuffle_epi32(state0, 0x1B); // FEBA
+  state1 = _mm_shuffle_epi32(state1, 0xB1); // DCHG
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+  state1 = _mm_alignr_epi8(state1, tmp, 8); // HGFE
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+#endif
+
+bool isSupported(const Implementation impl)
+{
+  switch (impl)
+  {
+    case Implementation::Scalar:
+         return true;
+    case Implementation::SHANI:
+         #if defined(LIBSTRIEZEL_HASH_X86)
+         return libstriezel::hash::cpuFeatures().sha
+             && libstriezel::hash::cpuFeatures().sse41;
+         #else
+         return false;
+         #endif
+  }//swi
+  return false;
+}
+
+/* returns the fastest implementation that is supported */
+Implementation detectBestImplementation()
+{
+  if (isSupported(Implementation::SHANI))
+    return Implementation::SHANI;
+  return Implementation::Scalar;
+}
+
+/* returns the variable that holds the active implementation */
+std::atomic<Implementation>& activeImplementation()
+{
+  static std::atomic<Implementation> impl(detectBestImplementation());
+  return impl;
+}
+
+Implementation getImplementation()
+{
+  return activeImplementation().load(std::memory_order_relaxed);
+}
+
+bool setImplementation(const Implementation impl)
+{
+  if (!isSupported(impl))
+    return false;
+  activeImplementation().store(impl, std::memory_order_relaxed);
+  return true;
+}
+
+void compressBlock(uint32_t state[8], const MessageBlock& block)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  if (getImplementation() == Implementation::SHANI)
+  {
+    compressSHANI(state, reinterpret_cast<const uint8_t*>(&block.words[0]), 1, false);
+    return;
+  }
+  #endif
+  compressScalar(state, block.words);
+}
+
+void compressBlocks(uint32_t state[8], const uint8_t* data, const std::size_t blockCount)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  if (getImplementation() == Implementation::SHANI)
+  {
+    compressSHANI(state, data, blockCount, true);
+    return;
+  }
+  #endif
+  MessageBlock block;
+  for (std::size_t i = 0; i < blockCount; ++i)
+  {
+    memcpy(&block.words[0], data + 64 * i, 64);
+    block.reverseBlock();
+    compressScalar(state, block.words);
+  }
+}
+
+} //namespace
@@ -31,7 +31,7 @@ namespace SHA256
 {
 
 //SHA-256 constants
-const uint32_t sha256_k[64] = {
+inline constexpr uint32_t sha256_k[64] = {
   0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
   0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
   0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
@@ -42,22 +42,22 @@ const uint32_t sha256_k[64] = {
   0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
 };
 
-inline uint32_t CapitalSigmaZero(const uint32_t x)
+constexpr uint32_t CapitalSigmaZero(const uint32_t x)
 {
   return (SHA1_256::rotr(2, x) ^ SHA1_256::rotr(13, x) ^ SHA1_256::rotr(22, x));
 }
 
-inline uint32_t CapitalSigmaOne(const uint32_t x)
+constexpr uint32_t CapitalSigmaOne(const uint32_t x)
 {
   return (SHA1_256::rotr(6, x) ^ SHA1_256::rotr(11, x) ^ SHA1_256::rotr(25, x));
 }
 
-inline uint32_t sigmaZero(const uint32_t x)
+constexpr uint32_t sigmaZero(const uint32_t x)
 {
   return (SHA1_256::rotr(7, x) ^ SHA1_256::rotr(18, x) ^ (x>>3));
 }
 
-inline uint32_t sigmaOne(const uint32_t x)
+constexpr uint32_t sigmaOne(const uint32_t x)
 {
   return (SHA1_256::rotr(17, x) ^ SHA1_256::rotr(19, x) ^ (x>>10));
 }
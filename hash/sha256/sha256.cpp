@@ -1,7 +1,7 @@
 /*
  -----------------------------------------------------------------------------
     This file is part of striezel's common code library.
-    Copyright (C) 2012, 2015  Dirk Stolle
+    Copyright (C) 2012, 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -18,11 +18,11 @@
  -----------------------------------------------------------------------------
 */
 
-//#define SHA256_DEBUG
-
-#include <iostream>
 #include "sha256.hpp"
-#include "functions.hpp"
+#include <algorithm>
+#include "../HexEncoding.hpp"
+#include "../sha2_core.hpp"
+#include "compression.hpp"
 
 namespace SHA256
 {
@@ -36,61 +36,21 @@ MessageDigest::MessageDigest()
 
 std::string MessageDigest::toHexString() const
 {
-  const char cHexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
-  std::string result;
-  unsigned int i;
-  for (i=0; i<8; ++i)
-  {
-    result.push_back(cHexDigits[hash[i]>>28]);
-    result.push_back(cHexDigits[(hash[i]>>24)%16]);
-    result.push_back(cHexDigits[(hash[i]>>20)%16]);
-    result.push_back(cHexDigits[(hash[i]>>16)%16]);
-    result.push_back(cHexDigits[(hash[i]>>12)%16]);
-    result.push_back(cHexDigits[(hash[i]>>8)%16]);
-    result.push_back(cHexDigits[(hash[i]>>4)%16]);
-    result.push_back(cHexDigits[hash[i]%16]);
-  }//for
+  std::string result(hexLength, '0');
+  toHexChars(&result[0]);
   return result;
 }
 
-bool MessageDigest::fromHexString(const std::string& digestHexString)
+void MessageDigest::toHexChars(char* buffer) const
 {
-  if (digestHexString.length()!=64) return false;
-  unsigned int i, j;
-  for (i=0; i<8; ++i)
-  {
-    hash[i] = 0;
-    for (j=0; j<8; ++j)
-    {
-      switch (digestHexString.at(i*8+j))
-      {
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9':
-             hash[i] = hash[i] | ((digestHexString.at(i*8+j)-'0')<<(28-j*4));
-             break;
-        case 'a':
-        case 'b':
-        case 'c':
-        case 'd':
-        case 'e':
-        case 'f':
-             hash[i] = hash[i] | ((digestHexString.at(i*8+j)-'a'+10)<<(28-j*4));
-             break;
-        default:
-             //invalid character encountered
-             return false;
-      }//swi
-    }//for j
-  }//for i
-  return true;
+  libstriezel::hash::encodeWords(hash, 8, buffer);
+}
+
+bool MessageDigest::fromHexString(const std::string_view digestHexString)
+{
+  if (digestHexString.length() != hexLength)
+    return false;
+  return libstriezel::hash::decodeWords(digestHexString.data(), 8, hash);
 }
 
 bool MessageDigest::isNull() const
@@ -131,126 +91,35 @@ bool MessageDigest::operator<(const MessageDigest& other) const
   return (hash[7]<other.hash[7]);
 }
 
-bool isValidHash(const std::string& hash)
+bool isValidHash(const std::string_view hash)
 {
-  if (hash.length() != 64)
-    return false;
-  unsigned int i;
-  for (i=0; i<64; ++i)
-  {
-    switch (hash[i])
-    {
-      case '0':
-      case '1':
-      case '2':
-      case '3':
-      case '4':
-      case '5':
-      case '6':
-      case '7':
-      case '8':
-      case '9':
-      case 'a':
-      case 'b':
-      case 'c':
-      case 'd':
-      case 'e':
-      case 'f':
-           break;
-      default:
-           return false;
-           break;
-    }//swi
-  }//for
-  return true;
+  return (hash.length() == MessageDigest::hexLength)
+      && libstriezel::hash::isValidHex(hash.data(), hash.length());
+}
+
+void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer)
+{
+  libstriezel::hash::encodeDigests(digests, count, buffer);
+}
+
+bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests)
+{
+  return libstriezel::hash::decodeDigests(buffer, count, digests);
 }
 
 MessageDigest computeFromSource(MessageSource& source)
 {
   MessageBlock msgBlock;
-
-  uint32_t msg_schedule[64];
-  uint32_t a, b, c, d, e, f, g, h;
-  uint32_t temp1, temp2;
   MessageDigest H;
 
-  H.setToNull();
-
   //setup stuff should have been done before this, so go on with hash initialization
 
   //set initial value
-  H.hash[0] = 0x6a09e667;
-  H.hash[1] = 0xbb67ae85;
-  H.hash[2] = 0x3c6ef372;
-  H.hash[3] = 0xa54ff53a;
-  H.hash[4] = 0x510e527f;
-  H.hash[5] = 0x9b05688c;
-  H.hash[6] = 0x1f83d9ab;
-  H.hash[7] = 0x5be0cd19;
-
-  unsigned int t; //loop variable
+  std::copy(SHA2::SHA256Parameters::initialValue, SHA2::SHA256Parameters::initialValue + 8, H.hash);
 
   while (source.getNextMessageBlock(msgBlock))
   {
-    // 1. prepare message schedule
-    for (t=0; t<16; ++t)
-    {
-      msg_schedule[t] = msgBlock.words[t];
-    }//for t
-    #ifdef SHA256_DEBUG
-    for (t=0; t<16; ++t)
-    {
-      std::dec(std::cout);
-      std::cout << "W["<<t<<"] = ";
-      std::hex(std::cout);
-      std::cout <<msg_schedule[t]<<"\n";
-    }//for
-    #endif
-    for (t=16; t<64; ++t)
-    {
-      msg_schedule[t] = sigmaOne(msg_schedule[t-2]) + msg_schedule[t-7] + sigmaZero(msg_schedule[t-15]) + msg_schedule[t-16];
-    }//for run
-
-    // 2. init. working vars
-    a = H.hash[0];
-    b = H.hash[1];
-    c = H.hash[2];
-    d = H.hash[3];
-    e = H.hash[4];
-    f = H.hash[5];
-    g = H.hash[6];
-    h = H.hash[7];
-
-    // 3. for loop
-    for (t=0; t<64; ++t)
-    {
-      temp1 = h + CapitalSigmaOne(e) + SHA1_256::Ch(e, f, g) + sha256_k[t] + msg_schedule[t];
-      temp2 = CapitalSigmaZero(a) + SHA1_256::Maj(a, b, c);
-      h = g;
-      g = f;
-      f = e;
-      e = d + temp1;
-      d = c;
-      c = b;
-      b = a;
-      a = temp1 + temp2;
-      #ifdef SHA256_DEBUG
-      std::dec(std::cout);
-      std::cout << "t="<<t<<": a to h: ";
-      std::hex(std::cout);
-      std::cout <<a<<" "<<b<<" "<<c<<" "<<d<<" "<<e<<" "<<f<<" "<<g<<" "<<h<<"\n";
-      #endif
-    }//for t
-
-    // 4. compute next intermediate hash value
-    H.hash[0] = a + H.hash[0];
-    H.hash[1] = b + H.hash[1];
-    H.hash[2] = c + H.hash[2];
-    H.hash[3] = d + H.hash[3];
-    H.hash[4] = e + H.hash[4];
-    H.hash[5] = f + H.hash[5];
-    H.hash[6] = g + H.hash[6];
-    H.hash[7] = h + H.hash[7];
+    compressBlock(H.hash, msgBlock);
   }//while message blocks are there
 
   return H;
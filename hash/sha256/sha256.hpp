@@ -21,8 +21,11 @@
 #ifndef LIBSTRIEZEL_SHA_256_HPP
 #define LIBSTRIEZEL_SHA_256_HPP
 
+#include <cstddef>
+#include <functional>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include "MessageSource.hpp"
 
 namespace SHA256
@@ -31,12 +34,35 @@ namespace SHA256
   {
     uint32_t hash[8];
 
+    /* number of characters of the hexadecimal representation */
+    static constexpr std::size_t hexLength = 64;
+
     /* default constructor */
     MessageDigest();
 
+    /* constructs the message digest from the given hash words, this allows
+       digests that are computed at compile time (see compile_time.hpp)
+
+       parameters:
+           words - the words of the hash
+    */
+    constexpr explicit MessageDigest(const uint32_t (&words)[8])
+    : hash{ words[0], words[1], words[2], words[3], words[4], words[5], words[6], words[7] }
+    {
+    }
+
     /* returns the message digest's representation as hexadecimal string */
     std::string toHexString() const;
 
+    /* writes the message digest's representation as hexadecimal string to
+       the given buffer
+
+       parameters:
+           buffer - buffer for exactly hexLength characters, no terminating
+                    null character is written
+    */
+    void toHexChars(char* buffer) const;
+
     /* set the message digest according to the given hexadecimal string and
        returns true in case of success, or false if the string does not re-
        present a valid hexadecimal digest
@@ -45,7 +71,7 @@ namespace SHA256
            digestHexString - the string containing the message digest as hex
                              digits (must be all lower case)
     */
-    bool fromHexString(const std::string& digestHexString);
+    bool fromHexString(const std::string_view digestHexString);
 
     /* returns true, if all hash bits are set to zero */
     bool isNull() const;
@@ -71,7 +97,29 @@ namespace SHA256
    *         Returns false otherwise.
    * \remarks This function only considers lower case letters to be valid.
    */
-  bool isValidHash(const std::string& hash);
+  bool isValidHash(const std::string_view hash);
+
+
+  /** \brief writes the hexadecimal representations of several digests
+   *
+   * \param digests  pointer to the digests
+   * \param count    number of digests
+   * \param buffer   buffer for count * MessageDigest::hexLength characters,
+   *                 the representations are written without separators
+   */
+  void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer);
+
+
+  /** \brief reads several digests from their hexadecimal representations
+   *
+   * \param buffer   count * MessageDigest::hexLength characters, the
+   *                 representations without separators
+   * \param count    number of digests
+   * \param digests  receives the digests
+   * \return Returns true, if all representations were valid.
+   *         Returns false otherwise. Invalid digests are set to "null".
+   */
+  bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests);
 
 
   /** \brief computes and returns the message digest of the given source
@@ -84,4 +132,22 @@ namespace SHA256
   MessageDigest computeFromSource(MessageSource& source);
 }//SHA256 namespace
 
+
+namespace std
+{
+  /** \brief hash function for SHA-256 message digests
+   *
+   * The bits of a message digest are already evenly distributed, so the
+   * first 64 bits of the digest are used as hash value.
+   */
+  template<>
+  struct hash<SHA256::MessageDigest>
+  {
+    std::size_t operator()(const SHA256::MessageDigest& digest) const noexcept
+    {
+      return static_cast<std::size_t>((static_cast<uint64_t>(digest.hash[0]) << 32) | digest.hash[1]);
+    }
+  };
+} //namespace
+
 #endif // LIBSTRIEZEL_SHA_256_HPP
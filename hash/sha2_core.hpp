@@ -0,0 +1,229 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA2_CORE_HPP
+#define LIBSTRIEZEL_SHA2_CORE_HPP
+
+#include <stdint.h>
+#include <utility>
+#include "sha-1-256_functions.hpp"
+#include "sha256/functions.hpp"
+#include "sha512/functions.hpp"
+
+/* This file contains the compression function that is shared by all SHA-2
+   variants. It is a template that gets the word size, the number of rounds,
+   the round constants and the functions of the variant from a parameter
+   structure. The rounds are unrolled at compile time, and instead of moving
+   the working variables around after each round, every round uses other
+   elements of the same array, so the compiler can keep them in registers.
+   All functions are always inlined, so they get compiled with the target
+   attributes of the calling function, e.g. the AVX2 code in
+   sha512/compression.cpp. */
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define LIBSTRIEZEL_SHA2_INLINE __attribute__((always_inline)) inline
+#elif defined(_MSC_VER)
+  #define LIBSTRIEZEL_SHA2_INLINE __forceinline
+#else
+  #define LIBSTRIEZEL_SHA2_INLINE inline
+#endif
+
+namespace SHA2
+{
+
+/// parameters of SHA-224 and SHA-256
+struct SHA256Parameters
+{
+  typedef uint32_t Word;
+  static constexpr unsigned int rounds = 64;
+  static constexpr const Word* k = SHA256::sha256_k;
+  static constexpr Word initialValue[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+  };
+
+  static Word Ch(const Word x, const Word y, const Word z) { return SHA1_256::Ch(x, y, z); }
+  static Word Maj(const Word x, const Word y, const Word z) { return SHA1_256::Maj(x, y, z); }
+  static Word CapitalSigmaZero(const Word x) { return SHA256::CapitalSigmaZero(x); }
+  static Word CapitalSigmaOne(const Word x) { return SHA256::CapitalSigmaOne(x); }
+  static Word sigmaZero(const Word x) { return SHA256::sigmaZero(x); }
+  static Word sigmaOne(const Word x) { return SHA256::sigmaOne(x); }
+};
+
+
+/// parameters of SHA-224, differs from SHA-256 in the initial value only
+struct SHA224Parameters: public SHA256Parameters
+{
+  static constexpr Word initialValue[8] = {
+    0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+    0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4
+  };
+};
+
+
+/// parameters of SHA-384 and SHA-512
+struct SHA512Parameters
+{
+  typedef uint64_t Word;
+  static constexpr unsigned int rounds = 80;
+  static constexpr const Word* k = SHA512::sha512_k;
+  static constexpr Word initialValue[8] = {
+    0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+    0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
+  };
+
+  static Word Ch(const Word x, const Word y, const Word z) { return SHA512::Ch(x, y, z); }
+  static Word Maj(const Word x, const Word y, const Word z) { return SHA512::Maj(x, y, z); }
+  static Word CapitalSigmaZero(const Word x) { return SHA512::CapitalSigmaZero(x); }
+  static Word CapitalSigmaOne(const Word x) { return SHA512::CapitalSigmaOne(x); }
+  static Word sigmaZero(const Word x) { return SHA512::sigmaZero(x); }
+  static Word sigmaOne(const Word x) { return SHA512::sigmaOne(x); }
+};
+
+
+/// parameters of SHA-384, differs from SHA-512 in the initial value only
+struct SHA384Parameters: public SHA512Parameters
+{
+  static constexpr Word initialValue[8] = {
+    0xcbbb9d5dc1059ed8, 0x629a292a367cd507, 0x9159015a3070dd17, 0x152fecd8f70e5939,
+    0x67332667ffc00b31, 0x8eb44a8768581511, 0xdb0c2e0d64f98fa7, 0x47b5481dbefa4fa4
+  };
+};
+
+
+namespace detail
+{
+
+/* round t of the compression function
+
+   parameters:
+       v  - the working variables, a is at index -t mod 8
+       wk - sum of W[t] and K[t]
+*/
+template<typename Parameters, unsigned int t>
+LIBSTRIEZEL_SHA2_INLINE void round(typename Parameters::Word (&v)[8], const typename Parameters::Word wk)
+{
+  typedef typename Parameters::Word Word;
+  const Word a = v[(8 - t % 8) % 8];
+  const Word b = v[(9 - t % 8) % 8];
+  const Word c = v[(10 - t % 8) % 8];
+  Word& d = v[(11 - t % 8) % 8];
+  const Word e = v[(12 - t % 8) % 8];
+  const Word f = v[(13 - t % 8) % 8];
+  const Word g = v[(14 - t % 8) % 8];
+  Word& h = v[(15 - t % 8) % 8];
+  const Word temp1 = h + Parameters::CapitalSigmaOne(e) + Parameters::Ch(e, f, g) + wk;
+  // h becomes the new a and d becomes the new e, the others just move on
+  d += temp1;
+  h = temp1 + Parameters::CapitalSigmaZero(a) + Parameters::Maj(a, b, c);
+}
+
+
+/* round t including the computation of W[t]
+
+   parameters:
+       v - the working variables
+       w - the last sixteen words of the message schedule, W[t] is at
+           index t mod 16
+*/
+template<typename Parameters, unsigned int t>
+LIBSTRIEZEL_SHA2_INLINE void scheduleAndRound(typename Parameters::Word (&v)[8], typename Parameters::Word (&w)[16])
+{
+  if constexpr (t >= 16)
+  {
+    w[t % 16] += Parameters::sigmaOne(w[(t - 2) % 16]) + w[(t - 7) % 16]
+               + Parameters::sigmaZero(w[(t - 15) % 16]);
+  }
+  round<Parameters, t>(v, w[t % 16] + Parameters::k[t]);
+}
+
+
+template<typename Parameters, unsigned int... t>
+LIBSTRIEZEL_SHA2_INLINE void allRounds(typename Parameters::Word (&v)[8], typename Parameters::Word (&w)[16],
+                      std::integer_sequence<unsigned int, t...>)
+{
+  (scheduleAndRound<Parameters, t>(v, w), ...);
+}
+
+
+template<typename Parameters, unsigned int... t>
+LIBSTRIEZEL_SHA2_INLINE void allRounds(typename Parameters::Word (&v)[8], const typename Parameters::Word* wk,
+                      std::integer_sequence<unsigned int, t...>)
+{
+  (round<Parameters, t>(v, wk[t]), ...);
+}
+
+} //namespace detail
+
+
+/** \brief applies the compression function to a single message block
+ *
+ * \param state  the intermediate hash value that shall be updated
+ * \param words  the message block as 16 words in host byte order
+ */
+template<typename Parameters>
+LIBSTRIEZEL_SHA2_INLINE void compress(typename Parameters::Word state[8], const typename Parameters::Word words[16])
+{
+  typename Parameters::Word v[8];
+  typename Parameters::Word w[16];
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    v[i] = state[i];
+  }
+  for (unsigned int i = 0; i < 16; ++i)
+  {
+    w[i] = words[i];
+  }
+  detail::allRounds<Parameters>(v, w, std::make_integer_sequence<unsigned int, Parameters::rounds>());
+  // The number of rounds is a multiple of eight, so a is at index 0 again.
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    state[i] += v[i];
+  }
+}
+
+
+/** \brief applies the rounds of the compression function to a state, using
+ * a message schedule that has been computed in advance
+ *
+ * \param state  the intermediate hash value that shall be updated
+ * \param wk     the sums W[t] + K[t] for all rounds, e.g. computed with SIMD
+ *               instructions
+ */
+template<typename Parameters>
+LIBSTRIEZEL_SHA2_INLINE void compressPrecomputed(typename Parameters::Word state[8], const typename Parameters::Word* wk)
+{
+  typename Parameters::Word v[8];
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    v[i] = state[i];
+  }
+  detail::allRounds<Parameters>(v, wk, std::make_integer_sequence<unsigned int, Parameters::rounds>());
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    state[i] += v[i];
+  }
+}
+
+} //namespace SHA2
+
+#undef LIBSTRIEZEL_SHA2_INLINE
+
+#endif // LIBSTRIEZEL_SHA2_CORE_HPP
@@ -21,6 +21,11 @@
 #ifndef LIBSTRIEZEL_SHA384_BUFFERSOURCEUTILITY_HPP
 #define LIBSTRIEZEL_SHA384_BUFFERSOURCEUTILITY_HPP
 
+#include <cstddef>
+#include <string_view>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
 #include "sha384.hpp"
 
 namespace SHA384
@@ -35,7 +40,41 @@ namespace SHA384
    *         Returns the "null" message digest (i.e. all bits set to zero),
    *         if an error occurred.
    */
-  MessageDigest computeFromBuffer(uint8_t* data, const uint64_t data_length_in_bits);
+  MessageDigest computeFromBuffer(const uint8_t* data, const uint64_t data_length_in_bits);
+
+  /** \brief computes the message digest of the data in the given buffer
+   *
+   * \param data    pointer to the message data; may be null, if length is zero
+   * \param length  length of the data in bytes
+   * \return Returns the SHA384 message digest of the data.
+   * \remarks No heap memory is allocated: complete blocks are compressed
+   *          directly from the caller's memory and the padded final block(s)
+   *          are built on the stack.
+   */
+  MessageDigest hash(const void* data, const std::size_t length);
+
+
+  /** \brief computes the message digest of the characters in a string view
+   *
+   * \param data  the message data
+   * \return Returns the SHA384 message digest of the data.
+   */
+  inline MessageDigest hash(const std::string_view data)
+  {
+    return hash(data.data(), data.size());
+  }
+
+#if __cplusplus >= 202002L
+  /** \brief computes the message digest of the bytes in a span
+   *
+   * \param data  the message data
+   * \return Returns the SHA384 message digest of the data.
+   */
+  inline MessageDigest hash(const std::span<const uint8_t> data)
+  {
+    return hash(data.data(), data.size());
+  }
+#endif
 } //namespace
 
 #endif // LIBSTRIEZEL_SHA384_BUFFERSOURCEUTILITY_HPP
@@ -21,12 +21,22 @@
 #include "FileSourceUtility.hpp"
 #include <iostream>
 #include "FileSource.hpp"
+#include "Hasher.hpp"
+#include "MappedFileSource.hpp"
 
 namespace SHA384
 {
 
 MessageDigest computeFromFile(const std::string& fileName)
 {
+  // Regular files are hashed straight out of a memory mapping.
+  MappedFileSource mapped;
+  if (mapped.open(fileName))
+  {
+    Hasher hasher;
+    hasher.update(mapped.data(), mapped.size());
+    return hasher.finalize();
+  }
   //setup file stuff
   FileSource source;
   if (!source.open(fileName))
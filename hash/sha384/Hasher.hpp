@@ -0,0 +1,61 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA384_HASHER_HPP
+#define LIBSTRIEZEL_SHA384_HASHER_HPP
+
+#include "sha384.hpp"
+#include "../sha512/Hasher.hpp"
+
+namespace SHA384
+{
+
+/** \brief incremental computation of SHA-384 message digests
+ *
+ * \remarks See SHA512::Hasher for details, SHA-384 only differs in the
+ *          initial value and the length of the digest.
+ */
+class Hasher: private SHA512::Hasher
+{
+  public:
+    /** \brief constructor */
+    Hasher();
+
+    using SHA512::Hasher::reset;
+    using SHA512::Hasher::update;
+    using SHA512::Hasher::length;
+    using SHA512::Hasher::Midstate;
+    using SHA512::Hasher::exportMidstate;
+    using SHA512::Hasher::importMidstate;
+
+
+    /** \brief pads the message and computes the message digest
+     *
+     * \return Returns the SHA384 message digest of all data that was passed
+     *         to update() since the last reset.
+     * \remarks The hasher is reset afterwards, so it can be used for the
+     *          next message.
+     */
+    MessageDigest finalize();
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA384_HASHER_HPP
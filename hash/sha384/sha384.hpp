@@ -21,8 +21,11 @@
 #ifndef SHA384_HPP_INCLUDED
 #define SHA384_HPP_INCLUDED
 
+#include <cstddef>
+#include <functional>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include "../sha512/MessageSource.hpp"
 
 namespace SHA384
@@ -38,6 +41,10 @@ namespace SHA384
     uint64_t hash[6];
 
 
+    /** \brief number of characters of the hexadecimal representation */
+    static constexpr std::size_t hexLength = 96;
+
+
     /** \brief default constructor */
     MessageDigest();
 
@@ -57,6 +64,14 @@ namespace SHA384
     std::string toHexString() const;
 
 
+    /** \brief writes the hexadecimal representation into a buffer
+     *
+     * \param buffer  buffer for exactly hexLength characters, no terminating
+     *                null character is written
+     */
+    void toHexChars(char* buffer) const;
+
+
     /** \brief set the message digest according to the given hexadecimal string
      *
      * \param digestHexString  the string containing the message digest as hex
@@ -65,7 +80,7 @@ namespace SHA384
      *         Returns false if the string does not represent a valid
      *         hexadecimal digest.
      */
-    bool fromHexString(const std::string& digestHexString);
+    bool fromHexString(const std::string_view digestHexString);
 
 
     /** \brief checks whether the hash is the "null" hash
@@ -92,6 +107,38 @@ namespace SHA384
   }; //struct MessageDigest
 
 
+  /** \brief checks whether a string represents a valid SHA384 hash
+   *
+   * \param hash  a potential SHA384 hash string
+   * \return Returns true, if @hash contains a valid SHA384 hash.
+   *         Returns false otherwise.
+   * \remarks This function only considers lower case letters to be valid.
+   */
+  bool isValidHash(const std::string_view hash);
+
+
+  /** \brief writes the hexadecimal representations of several digests
+   *
+   * \param digests  pointer to the digests
+   * \param count    number of digests
+   * \param buffer   buffer for count * MessageDigest::hexLength characters,
+   *                 the representations are written without separators
+   */
+  void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer);
+
+
+  /** \brief reads several digests from their hexadecimal representations
+   *
+   * \param buffer   count * MessageDigest::hexLength characters, the
+   *                 representations without separators
+   * \param count    number of digests
+   * \param digests  receives the digests
+   * \return Returns true, if all representations were valid.
+   *         Returns false otherwise. Invalid digests are set to "null".
+   */
+  bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests);
+
+
   /** \brief computes and returns the message digest of the given source
    *
    * \param source   the message source
@@ -102,4 +149,22 @@ namespace SHA384
   MessageDigest computeFromSource(MessageSource& source);
 }//SHA384 namespace
 
+
+namespace std
+{
+  /** \brief hash function for SHA-384 message digests
+   *
+   * The bits of a message digest are already evenly distributed, so the
+   * first 64 bits of the digest are used as hash value.
+   */
+  template<>
+  struct hash<SHA384::MessageDigest>
+  {
+    std::size_t operator()(const SHA384::MessageDigest& digest) const noexcept
+    {
+      return static_cast<std::size_t>(digest.hash[0]);
+    }
+  };
+} //namespace
+
 #endif // SHA384_HPP_INCLUDED
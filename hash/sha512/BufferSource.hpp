@@ -40,7 +40,7 @@ class BufferSource: public MessageSource
      *  will be rounded up to the next multiple of eight, because the
      *  implementation is byte-oriented.
      */
-    BufferSource(uint8_t* data, const uint64_t data_length_in_bits);
+    BufferSource(const uint8_t* data, const uint64_t data_length_in_bits);
 
 
     /** destructor */
@@ -56,7 +56,7 @@ class BufferSource: public MessageSource
      */
     virtual bool getNextMessageBlock(MessageBlock& mBlock);
   private:
-    uint8_t * m_BufferPointer; /**< pointer to the buffer */
+    const uint8_t * m_BufferPointer; /**< pointer to the buffer */
     uint64_t m_BufferSize; /**< size of the buffer in bytes */
 }; //class
 
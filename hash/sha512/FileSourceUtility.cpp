@@ -19,14 +19,26 @@
 */
 
 #include "FileSourceUtility.hpp"
+#include <fstream>
 #include <iostream>
+#include <vector>
 #include "FileSource.hpp"
+#include "Hasher.hpp"
+#include "MappedFileSource.hpp"
 
 namespace SHA512
 {
 
 MessageDigest computeFromFile(const std::string& fileName)
 {
+  // Regular files are hashed straight out of a memory mapping.
+  MappedFileSource mapped;
+  if (mapped.open(fileName))
+  {
+    Hasher hasher;
+    hasher.update(mapped.data(), mapped.size());
+    return hasher.finalize();
+  }
   //setup file stuff
   FileSource source;
   if (!source.open(fileName))
@@ -38,4 +50,41 @@ MessageDigest computeFromFile(const std::string& fileName)
   return SHA512::computeFromSource(source);
 }
 
+MessageDigest computeFromFile(const std::string& fileName, const Hasher::Midstate& resumeFrom, Hasher::Midstate& checkpoint)
+{
+  Hasher hasher;
+  if (!hasher.importMidstate(resumeFrom))
+    return MessageDigest();
+  MappedFileSource mapped;
+  if (mapped.open(fileName))
+  {
+    if (mapped.size() < resumeFrom.length)
+      return MessageDigest();
+    hasher.update(mapped.data() + resumeFrom.length, mapped.size() - resumeFrom.length);
+    checkpoint = hasher.exportMidstate();
+    return hasher.finalize();
+  }
+  // Not a regular file (or no memory mapping available), so seek and read.
+  std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+  if (!stream.is_open())
+  {
+    std::cout << "Could not open file \""<<fileName<<"\" for resuming!\n";
+    return MessageDigest();
+  }
+  stream.seekg(0, std::ios::end);
+  const std::streamoff fileSize = stream.tellg();
+  if ((fileSize < 0) || (static_cast<uint64_t>(fileSize) < resumeFrom.length))
+    return MessageDigest();
+  stream.seekg(static_cast<std::streamoff>(resumeFrom.length), std::ios::beg);
+  std::vector<char> buffer(1 << 20);
+  while (stream.read(buffer.data(), buffer.size()) || (stream.gcount() > 0))
+  {
+    hasher.update(buffer.data(), static_cast<std::size_t>(stream.gcount()));
+  }
+  if (stream.bad())
+    return MessageDigest();
+  checkpoint = hasher.exportMidstate();
+  return hasher.finalize();
+}
+
 } //namespace
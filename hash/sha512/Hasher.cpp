@@ -0,0 +1,185 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "Hasher.hpp"
+#include <algorithm>
+#include <cstring>
+#include "compression.hpp"
+#include "../sha2_core.hpp"
+
+namespace SHA512
+{
+
+Hasher::Hasher()
+: Hasher(SHA2::SHA512Parameters::initialValue)
+{
+}
+
+Hasher::Hasher(const uint64_t initialValue[8])
+: m_InitialValue(), m_State(), m_Tail(), m_TailLength(0), m_Length(0)
+{
+  std::copy(initialValue, initialValue + 8, m_InitialValue);
+  reset();
+}
+
+void Hasher::reset()
+{
+  std::copy(m_InitialValue, m_InitialValue + 8, m_State);
+  m_TailLength = 0;
+  m_Length = 0;
+}
+
+void Hasher::update(const void* data, const std::size_t length)
+{
+  // data may be null for empty input, which memcpy() does not allow
+  if (length == 0)
+    return;
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  std::size_t remaining = length;
+  m_Length += length;
+  // complete a previously started block first
+  if (m_TailLength > 0)
+  {
+    const std::size_t count = std::min(remaining, 128 - m_TailLength);
+    memcpy(m_Tail + m_TailLength, bytes, count);
+    m_TailLength += count;
+    bytes += count;
+    remaining -= count;
+    if (m_TailLength < 128)
+      return;
+    compressBlocks(m_State, m_Tail, 1);
+    m_TailLength = 0;
+  }
+  // full blocks are processed in place
+  const std::size_t blocks = remaining / 128;
+  if (blocks > 0)
+  {
+    compressBlocks(m_State, bytes, blocks);
+    bytes += 128 * blocks;
+    remaining -= 128 * blocks;
+  }
+  if (remaining > 0)
+  {
+    memcpy(m_Tail, bytes, remaining);
+    m_TailLength = remaining;
+  }
+}
+
+uint64_t Hasher::length() const
+{
+  return m_Length;
+}
+
+void Hasher::finalizeState(uint64_t result[8])
+{
+  // The length field has 128 bits, but messages are shorter than 2^64 bytes.
+  const uint64_t bitsHigh = m_Length >> 61;
+  const uint64_t bitsLow = m_Length << 3;
+  //add 1-bit
+  m_Tail[m_TailLength++] = 0x80;
+  if (m_TailLength > 112)
+  {
+    memset(m_Tail + m_TailLength, 0, 128 - m_TailLength);
+    compressBlocks(m_State, m_Tail, 1);
+    m_TailLength = 0;
+  }
+  memset(m_Tail + m_TailLength, 0, 112 - m_TailLength);
+  //add data length in bits (big endian)
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    m_Tail[119 - i] = static_cast<uint8_t>(bitsHigh >> (8 * i));
+    m_Tail[127 - i] = static_cast<uint8_t>(bitsLow >> (8 * i));
+  }
+  compressBlocks(m_State, m_Tail, 1);
+  std::copy(m_State, m_State + 8, result);
+  reset();
+}
+
+Hasher::Midstate Hasher::exportMidstate() const
+{
+  Midstate midstate;
+  std::copy(m_State, m_State + 8, midstate.state);
+  midstate.length = m_Length - m_TailLength;
+  return midstate;
+}
+
+bool Hasher::importMidstate(const Midstate& midstate)
+{
+  if (midstate.length % 128 != 0)
+    return false;
+  std::copy(midstate.state, midstate.state + 8, m_State);
+  m_Length = midstate.length;
+  m_TailLength = 0;
+  return true;
+}
+
+std::string Hasher::Midstate::toHexString() const
+{
+  const char cHexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+  std::string result;
+  result.reserve(144);
+  for (unsigned int i = 0; i < 9; ++i)
+  {
+    const uint64_t value = (i < 8) ? state[i] : length;
+    const unsigned int digits = (i < 8) ? 16 : 16;
+    for (unsigned int j = digits; j > 0; --j)
+    {
+      result.push_back(cHexDigits[(value >> (4 * (j - 1))) & 0x0F]);
+    }
+  }
+  return result;
+}
+
+bool Hasher::Midstate::fromHexString(const std::string& midstateHexString)
+{
+  if (midstateHexString.size() != 144)
+    return false;
+  uint64_t values[9] = { 0 };
+  for (std::size_t pos = 0; pos < midstateHexString.size(); ++pos)
+  {
+    const char c = midstateHexString[pos];
+    uint64_t digit = 0;
+    if ((c >= '0') && (c <= '9'))
+      digit = c - '0';
+    else if ((c >= 'a') && (c <= 'f'))
+      digit = c - 'a' + 10;
+    else
+      return false;
+    const std::size_t index = (pos < 128) ? pos / 16 : 8;
+    values[index] = (values[index] << 4) | digit;
+  }
+  if (values[8] % 128 != 0)
+    return false;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    state[i] = static_cast<uint64_t>(values[i]);
+  }
+  length = values[8];
+  return true;
+}
+
+MessageDigest Hasher::finalize()
+{
+  MessageDigest md;
+  finalizeState(md.hash);
+  return md;
+}
+
+} //namespace
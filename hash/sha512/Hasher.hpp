@@ -0,0 +1,146 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA512_HASHER_HPP
+#define LIBSTRIEZEL_SHA512_HASHER_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include "sha512.hpp"
+
+namespace SHA512
+{
+
+/** \brief incremental computation of SHA-512 message digests
+ *
+ * Data can be passed in pieces of arbitrary size via update(). Complete
+ * blocks are compressed directly from the caller's memory, only an
+ * incomplete block at the end of the data is kept in an internal buffer.
+ */
+class Hasher
+{
+  public:
+    /** \brief intermediate state after a number of complete blocks
+     *
+     * A midstate allows to continue hashing of a message at a later time,
+     * e.g. after more data was appended to a file, without processing the
+     * data before the midstate again.
+     */
+    struct Midstate
+    {
+      uint64_t state[8];  /**< intermediate hash value */
+      uint64_t length;    /**< number of message bytes that went into state,
+                               always a multiple of the block size (128) */
+
+      /** \brief gets the midstate as hexadecimal string
+       *
+       * \return Returns the state words followed by the length, each as
+       *         big endian hexadecimal number (144 lower case digits).
+       */
+      std::string toHexString() const;
+
+
+      /** \brief sets the midstate from a hexadecimal string
+       *
+       * \param midstateHexString  string as created by toHexString()
+       * \return Returns true in case of success.
+       *         Returns false, if the string is not a valid midstate.
+       */
+      bool fromHexString(const std::string& midstateHexString);
+    };
+
+
+    /** \brief constructor */
+    Hasher();
+
+
+    /** \brief resets the hasher to the state before any data was passed */
+    void reset();
+
+
+    /** \brief passes the next piece of the message to the hasher
+     *
+     * \param data    pointer to the data
+     * \param length  length of the data in bytes
+     */
+    void update(const void* data, const std::size_t length);
+
+
+    /** \brief gets the number of bytes that have been passed to the hasher
+     *
+     * \return Returns the number of bytes passed since the last reset.
+     */
+    uint64_t length() const;
+
+
+    /** \brief pads the message and computes the message digest
+     *
+     * \return Returns the SHA512 message digest of all data that was passed
+     *         to update() since the last reset.
+     * \remarks The hasher is reset afterwards, so it can be used for the
+     *          next message.
+     */
+    MessageDigest finalize();
+
+
+    /** \brief gets the intermediate state after all complete blocks
+     *
+     * \return Returns the midstate.
+     * \remarks Data of an incomplete block at the end is not part of the
+     *          midstate, so hashing has to resume at Midstate::length.
+     */
+    Midstate exportMidstate() const;
+
+
+    /** \brief continues hashing from a midstate
+     *
+     * \param midstate  the midstate, e.g. from exportMidstate()
+     * \return Returns true, if the midstate was imported.
+     *         Returns false, if the length is not a multiple of the block
+     *         size. The hasher is unchanged in that case.
+     * \remarks The next call of update() has to pass the message data that
+     *          starts at Midstate::length.
+     */
+    bool importMidstate(const Midstate& midstate);
+  protected:
+    /** \brief constructor for variants with another initial value
+     *
+     * \param initialValue  the initial hash value
+     */
+    explicit Hasher(const uint64_t initialValue[8]);
+
+
+    /** \brief pads the message and resets the hasher
+     *
+     * \param result  array of eight words that receives the final hash value
+     */
+    void finalizeState(uint64_t result[8]);
+  private:
+    uint64_t m_InitialValue[8]; /**< initial hash value */
+    uint64_t m_State[8];        /**< intermediate hash value */
+    uint8_t m_Tail[128];        /**< data of the incomplete block */
+    std::size_t m_TailLength;   /**< number of bytes in m_Tail */
+    uint64_t m_Length;          /**< total message length in bytes */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA512_HASHER_HPP
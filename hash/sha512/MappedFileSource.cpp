@@ -0,0 +1,116 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "MappedFileSource.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace SHA512
+{
+
+MappedFileSource::MappedFileSource()
+: MessageSource(), m_File()
+{
+}
+
+MappedFileSource::~MappedFileSource()
+{
+  m_File.close();
+}
+
+bool MappedFileSource::open(const std::string& fileName)
+{
+  if (!m_File.open(fileName))
+    return false;
+  m_BitsRead = 0;
+  m_Status = psUnpadded;
+  return true;
+}
+
+const uint8_t* MappedFileSource::data() const
+{
+  return m_File.data();
+}
+
+std::size_t MappedFileSource::size() const
+{
+  return m_File.size();
+}
+
+void MappedFileSource::preparePadding()
+{
+  const std::size_t remainder = m_File.size() % 128;
+  const std::size_t paddingLength = (remainder > 111) ? 256 : 128;
+  memset(m_PaddingBuffer, 0, 256);
+  if (remainder > 0)
+    memcpy(m_PaddingBuffer, m_File.data() + (m_File.size() - remainder), remainder);
+  //add 1-bit
+  m_PaddingBuffer[remainder] = 0x80;
+  //add data length in bits (big endian, 128 bits)
+  const uint64_t bitsHigh = static_cast<uint64_t>(m_File.size()) >> 61;
+  const uint64_t bitsLow = static_cast<uint64_t>(m_File.size()) << 3;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    m_PaddingBuffer[paddingLength - 9 - i] = static_cast<uint8_t>(bitsHigh >> (8 * i));
+    m_PaddingBuffer[paddingLength - 1 - i] = static_cast<uint8_t>(bitsLow >> (8 * i));
+  }
+  m_Status = (paddingLength == 256) ? psPadded2048 : psPadded1024;
+}
+
+bool MappedFileSource::getNextMessageBlock(MessageBlock& mBlock)
+{
+  if (m_Status == psUnpadded)
+  {
+    if (!m_File.isOpen())
+      return false;
+    if (m_BitsRead / 8 + 128 <= m_File.size())
+    {
+      memcpy(&(mBlock.words[0]), m_File.data() + m_BitsRead / 8, 128);
+      m_BitsRead += 1024;
+      mBlock.reverseBlock();
+      return true;
+    }
+    preparePadding();
+  }
+  switch (m_Status)
+  {
+    case psPadded1024:
+         memcpy(&(mBlock.words[0]), &m_PaddingBuffer[0], 128);
+         m_Status = psPaddedAndAllRead;
+         break;
+    case psPadded2048:
+         memcpy(&(mBlock.words[0]), &m_PaddingBuffer[0], 128);
+         m_Status = psPadded2048And1024Read;
+         break;
+    case psPadded2048And1024Read:
+         memcpy(&(mBlock.words[0]), &m_PaddingBuffer[128], 128);
+         m_Status = psPaddedAndAllRead;
+         break;
+    case psPaddedAndAllRead:
+         return false;
+    case psUnpadded:
+         //should never happen
+         throw std::logic_error("MappedFileSource::getNextMessageBlock(): Code execution should never get to this point!");
+  }//swi
+  mBlock.reverseBlock();
+  return true;
+}
+
+} //namespace
@@ -56,18 +56,13 @@ void MessageBlock::reverseBlock()
 /* MessageSource functions */
 MessageSource::MessageSource()
 : m_BitsRead(0),
-  m_PaddingBuffer((uint8_t*) 0),
+  m_PaddingBuffer(),
   m_Status(psUnpadded)
 {
 }
 
 MessageSource::~MessageSource()
 {
-  if (m_PaddingBuffer!=(uint8_t*) 0)
-  {
-    delete[] m_PaddingBuffer;
-    m_PaddingBuffer = 0;
-  }
 }
 
 } //namespace
@@ -65,7 +65,7 @@ class MessageSource
     virtual bool getNextMessageBlock(MessageBlock& mBlock) = 0;
   protected:
     uint64_t m_BitsRead;
-    uint8_t * m_PaddingBuffer;
+    uint8_t m_PaddingBuffer[256]; /**< final padded block(s) of the message */
     enum PaddingStatus {psUnpadded, psPadded1024, psPadded2048, psPadded2048And1024Read, psPaddedAndAllRead};
     PaddingStatus m_Status;
 }; //class
@@ -0,0 +1,80 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_SHA512_READAHEADUTILITY_HPP
+#define LIBSTRIEZEL_SHA512_READAHEADUTILITY_HPP
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include "sha512.hpp"
+#include "../ReadAheadReader.hpp"
+
+namespace SHA512
+{
+  /** \brief computes the message digest of a file while the file is read
+   *         ahead in a separate thread
+   *
+   * \param fileName    name of the file
+   * \param readSize    size of a single read in bytes
+   * \param queueDepth  number of buffers that can be filled in advance
+   * \param cacheMode   whether the file's data shall stay in the page cache,
+   *                    CacheMode::Bypass is meant for bulk scans of files
+   *                    that will not be read again soon
+   * \return Returns the SHA512 message digest on success.
+   *         Returns the "null" message digest (i.e. all bits set to zero),
+   *         if an error occurred.
+   * \remarks Reading and hashing overlap, which helps on slow storage like
+   *          network shares. For local files, computeFromFile() is usually
+   *          at least as fast.
+   */
+  MessageDigest computeFromFileReadAhead(const std::string& fileName,
+      const std::size_t readSize = libstriezel::hash::ReadAheadReader::defaultReadSize,
+      const unsigned int queueDepth = libstriezel::hash::ReadAheadReader::defaultQueueDepth,
+      const libstriezel::hash::CacheMode cacheMode = libstriezel::hash::CacheMode::Normal);
+
+
+  /** \brief computes the message digest of all data that can be read from
+   *         a stream, e.g. std::cin
+   *
+   * \param stream  the stream, it does not need to be seekable
+   * \return Returns the SHA512 message digest on success.
+   *         Returns the "null" message digest (i.e. all bits set to zero),
+   *         if an error occurred.
+   * \remarks The stream is read in large pieces by a separate thread.
+   */
+  MessageDigest computeFromStream(std::istream& stream);
+
+
+  /** \brief computes the message digest of all data that can be read from
+   *         an open file descriptor, e.g. a pipe or a socket
+   *
+   * \param descriptor  the file descriptor, it is not closed afterwards
+   * \return Returns the SHA512 message digest on success.
+   *         Returns the "null" message digest (i.e. all bits set to zero),
+   *         if an error occurred or if file descriptors are not supported
+   *         on this platform.
+   * \remarks The descriptor is read in large pieces by a separate thread.
+   *          Interrupted and short reads are retried.
+   */
+  MessageDigest computeFromDescriptor(const int descriptor);
+} //namespace
+
+#endif // LIBSTRIEZEL_SHA512_READAHEADUTILITY_HPP
@@ -0,0 +1,211 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of the striezel's common code library.
+    Copyright (C) 2012, 2015, 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "compression.hpp"
+#include <atomic>
+#include <cstring>
+#include "functions.hpp"
+#include "../cpu_features.hpp"
+#include "../sha2_core.hpp"
+
+namespace SHA512
+{
+
+/* scalar implementation
+
+   parameters:
+       state - the intermediate hash value
+       words - the message block as 16 words in host byte order
+*/
+void compressScalar(uint64_t state[8], const uint64_t words[16])
+{
+  SHA2::compress<SHA2::SHA512Parameters>(state, words);
+}
+
+#if defined(LIBSTRIEZEL_HASH_X86)
+typedef uint64_t Pair __attribute__((vector_size(16)));
+
+#define SHA512_PAIR_ROTR(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+/* SIMD implementation: The message schedule is computed two words at a time
+   (W[t] depends on W[t-2]), the round constants are added in the same
+   step, and then the rounds are done with scalar code. The target attribute
+   of the calling function decides which instructions are used, e.g. AVX-512
+   has a native rotation for 64 bit elements.
+
+   parameters:
+       state      - the intermediate hash value
+       data       - pointer to the message blocks
+       blockCount - number of blocks in data
+       swapBytes  - whether the words in data are in message byte order (true)
+                    or have already been converted to host byte order (false)
+*/
+__attribute__((always_inline)) inline void compressVector(uint64_t state[8], const uint8_t* data, std::size_t blockCount, const bool swapBytes)
+{
+  alignas(32) uint64_t wk[80];
+  while (blockCount > 0)
+  {
+    // 1. prepare message schedule, x[i] holds W[2i] and W[2i+1]
+    Pair x[8];
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      memcpy(&x[i], data + 16 * i, 16);
+      if (swapBytes)
+      {
+        x[i][0] = __builtin_bswap64(x[i][0]);
+        x[i][1] = __builtin_bswap64(x[i][1]);
+      }
+      const Pair wkPair = x[i] + Pair{ sha512_k[2 * i], sha512_k[2 * i + 1] };
+      memcpy(&wk[2 * i], &wkPair, 16);
+    }
+    #if defined(__GNUC__)
+    #pragma GCC unroll 32
+    #endif
+    for (unsigned int p = 8; p < 40; ++p)
+    {
+      const Pair w2 = x[(p - 1) % 8];
+      // W[t-15], W[t-14] and W[t-7], W[t-6] straddle two pairs
+      const Pair w15 = { x[p % 8][1], x[(p - 7) % 8][0] };
+      const Pair w7 = { x[(p - 4) % 8][1], x[(p - 3) % 8][0] };
+      x[p % 8] += (SHA512_PAIR_ROTR(w2, 19) ^ SHA512_PAIR_ROTR(w2, 61) ^ (w2 >> 6))
+                + w7
+                + (SHA512_PAIR_ROTR(w15, 1) ^ SHA512_PAIR_ROTR(w15, 8) ^ (w15 >> 7));
+      const Pair wkPair = x[p % 8] + Pair{ sha512_k[2 * p], sha512_k[2 * p + 1] };
+      memcpy(&wk[2 * p], &wkPair, 16);
+    }
+
+    // 2. rounds with precomputed W[t] + K[t]
+    SHA2::compressPrecomputed<SHA2::SHA512Parameters>(state, wk);
+    data += 128;
+    --blockCount;
+  }
+}
+
+#undef SHA512_PAIR_ROTR
+
+__attribute__((target("avx2,bmi2")))
+void compressAVX2(uint64_t state[8], const uint8_t* data, std::size_t blockCount, const bool swapBytes)
+{
+  compressVector(state, data, blockCount, swapBytes);
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2")))
+void compressAVX512(uint64_t state[8], const uint8_t* data, std::size_t blockCount, const bool swapBytes)
+{
+  compressVector(state, data, blockCount, swapBytes);
+}
+#endif // LIBSTRIEZEL_HASH_X86
+
+bool isSupported(const Implementation impl)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  const libstriezel::hash::CpuFeatures& features = libstriezel::hash::cpuFeatures();
+  #endif
+  switch (impl)
+  {
+    case Implementation::Scalar:
+         return true;
+    #if defined(LIBSTRIEZEL_HASH_X86)
+    case Implementation::AVX2:
+         return features.avx2 && features.bmi2;
+    case Implementation::AVX512:
+         return features.avx512 && features.bmi2;
+    #else
+    case Implementation::AVX2:
+    case Implementation::AVX512:
+         return false;
+    #endif
+  }//swi
+  return false;
+}
+
+/* returns the fastest implementation that is supported */
+Implementation detectBestImplementation()
+{
+  if (isSupported(Implementation::AVX512))
+    return Implementation::AVX512;
+  if (isSupported(Implementation::AVX2))
+    return Implementation::AVX2;
+  return Implementation::Scalar;
+}
+
+/* returns the variable that holds the active implementation */
+std::atomic<Implementation>& activeImplementation()
+{
+  static std::atomic<Implementation> impl(detectBestImplementation());
+  return impl;
+}
+
+Implementation getImplementation()
+{
+  return activeImplementation().load(std::memory_order_relaxed);
+}
+
+bool setImplementation(const Implementation impl)
+{
+  if (!isSupported(impl))
+    return false;
+  activeImplementation().store(impl, std::memory_order_relaxed);
+  return true;
+}
+
+void compressBlock(uint64_t state[8], const MessageBlock& block)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  switch (getImplementation())
+  {
+    case Implementation::AVX512:
+         compressAVX512(state, reinterpret_cast<const uint8_t*>(&block.words[0]), 1, false);
+         return;
+    case Implementation::AVX2:
+         compressAVX2(state, reinterpret_cast<const uint8_t*>(&block.words[0]), 1, false);
+         return;
+    case Implementation::Scalar:
+         break;
+  }//swi
+  #endif
+  compressScalar(state, block.words);
+}
+
+void compressBlocks(uint64_t state[8], const uint8_t* data, const std::size_t blockCount)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  switch (getImplementation())
+  {
+    case Implementation::AVX512:
+         compressAVX512(state, data, blockCount, true);
+         return;
+    case Implementation::AVX2:
+         compressAVX2(state, data, blockCount, true);
+         return;
+    case Implementation::Scalar:
+         break;
+  }//swi
+  #endif
+  MessageBlock block;
+  for (std::size_t i = 0; i < blockCount; ++i)
+  {
+    memcpy(&block.words[0], data + 128 * i, 128);
+    block.reverseBlock();
+    compressScalar(state, block.words);
+  }
+}
+
+} //namespace
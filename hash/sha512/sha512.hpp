@@ -21,8 +21,11 @@
 #ifndef SHA512_HPP_INCLUDED
 #define SHA512_HPP_INCLUDED
 
+#include <cstddef>
+#include <functional>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include "MessageSource.hpp"
 
 namespace SHA512
@@ -32,6 +35,10 @@ namespace SHA512
     uint64_t hash[8];
 
 
+    /** \brief number of characters of the hexadecimal representation */
+    static constexpr std::size_t hexLength = 128;
+
+
     /** \brief default constructor */
     MessageDigest();
 
@@ -40,6 +47,14 @@ namespace SHA512
     std::string toHexString() const;
 
 
+    /** \brief writes the hexadecimal representation into a buffer
+     *
+     * \param buffer  buffer for exactly hexLength characters, no terminating
+     *                null character is written
+     */
+    void toHexChars(char* buffer) const;
+
+
     /* set the message digest according to the given hexadecimal string and
        returns true in case of success, or false if the string does not re-
        present a valid hexadecimal digest
@@ -48,7 +63,7 @@ namespace SHA512
            digestHexString - the string containing the message digest as hex
                              digits (must be all lower case)
     */
-    bool fromHexString(const std::string& digestHexString);
+    bool fromHexString(const std::string_view digestHexString);
 
 
     /* returns true, if all hash bits are set to zero */
@@ -72,6 +87,38 @@ namespace SHA512
   }; //struct MessageDigest
 
 
+  /** \brief checks whether a string represents a valid SHA512 hash
+   *
+   * \param hash  a potential SHA512 hash string
+   * \return Returns true, if @hash contains a valid SHA512 hash.
+   *         Returns false otherwise.
+   * \remarks This function only considers lower case letters to be valid.
+   */
+  bool isValidHash(const std::string_view hash);
+
+
+  /** \brief writes the hexadecimal representations of several digests
+   *
+   * \param digests  pointer to the digests
+   * \param count    number of digests
+   * \param buffer   buffer for count * MessageDigest::hexLength characters,
+   *                 the representations are written without separators
+   */
+  void toHexChars(const MessageDigest* digests, const std::size_t count, char* buffer);
+
+
+  /** \brief reads several digests from their hexadecimal representations
+   *
+   * \param buffer   count * MessageDigest::hexLength characters, the
+   *                 representations without separators
+   * \param count    number of digests
+   * \param digests  receives the digests
+   * \return Returns true, if all representations were valid.
+   *         Returns false otherwise. Invalid digests are set to "null".
+   */
+  bool fromHexChars(const char* buffer, const std::size_t count, MessageDigest* digests);
+
+
   /** \brief computes and returns the message digest of the given source
    *
    * \param source   the message source
@@ -82,4 +129,22 @@ namespace SHA512
   MessageDigest computeFromSource(MessageSource& source);
 }//SHA512 namespace
 
+
+namespace std
+{
+  /** \brief hash function for SHA-512 message digests
+   *
+   * The bits of a message digest are already evenly distributed, so the
+   * first 64 bits of the digest are used as hash value.
+   */
+  template<>
+  struct hash<SHA512::MessageDigest>
+  {
+    std::size_t operator()(const SHA512::MessageDigest& digest) const noexcept
+    {
+      return static_cast<std::size_t>(digest.hash[0]);
+    }
+  };
+} //namespace
+
 #endif // SHA512_HPP_INCLUDED
@@ -0,0 +1,275 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "BufferSourceUtility.hpp"
+#include <algorithm>
+#include "accumulate.hpp"
+
+namespace XXH3
+{
+
+/* start and end offsets into the secret for 129 to 240 bytes of input */
+const std::size_t midSizeStartOffset = 3;
+const std::size_t midSizeLastOffset = 17;
+
+/* minimum size of a secret, used for the offsets of short inputs */
+const std::size_t secretSizeMin = 136;
+
+inline uint32_t swap32(const uint32_t x)
+{
+  return ((x << 24) & 0xFF000000) | ((x << 8) & 0x00FF0000)
+       | ((x >> 8) & 0x0000FF00) | ((x >> 24) & 0x000000FF);
+}
+
+inline uint64_t swap64(const uint64_t x)
+{
+  return (static_cast<uint64_t>(swap32(static_cast<uint32_t>(x))) << 32) | swap32(static_cast<uint32_t>(x >> 32));
+}
+
+inline uint64_t rotl64(const uint64_t x, const unsigned int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+/* final mixing step of XXH64, used by the shortest inputs */
+inline uint64_t avalancheXXH64(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= prime64_2;
+  h ^= h >> 29;
+  h *= prime64_3;
+  h ^= h >> 32;
+  return h;
+}
+
+/* final mixing step for four to eight bytes */
+inline uint64_t rrmxmx(uint64_t h, const uint64_t length)
+{
+  h ^= rotl64(h, 49) ^ rotl64(h, 24);
+  h *= 0x9FB21C651E98DF25ULL;
+  h ^= (h >> 35) + length;
+  h *= 0x9FB21C651E98DF25ULL;
+  h ^= h >> 28;
+  return h;
+}
+
+/* mixes 16 bytes of input with 16 bytes of secret */
+inline uint64_t mix16(const uint8_t* input, const uint8_t* secret, const uint64_t seed)
+{
+  return multiplyFold(read64(input) ^ (read64(secret) + seed),
+                      read64(input + 8) ^ (read64(secret + 8) - seed));
+}
+
+/* 128 bit accumulator of the short inputs: low and high half */
+struct Accumulator128
+{
+  uint64_t low;
+  uint64_t high;
+};
+
+/* mixes 32 bytes of input into a 128 bit accumulator */
+inline void mix32(Accumulator128& acc, const uint8_t* input1, const uint8_t* input2, const uint8_t* secret, const uint64_t seed)
+{
+  acc.low += mix16(input1, secret, seed);
+  acc.low ^= read64(input2) + read64(input2 + 8);
+  acc.high += mix16(input2, secret + 16, seed);
+  acc.high ^= read64(input1) + read64(input1 + 8);
+}
+
+/* converts the 128 bit accumulator of 17 to 240 bytes into the result */
+Hash128 finishMidSize128(const Accumulator128& acc, const std::size_t length, const uint64_t seed)
+{
+  Hash128 result;
+  result.hash[1] = avalanche(acc.low + acc.high);
+  result.hash[0] = 0 - avalanche((acc.low * prime64_1) + (acc.high * prime64_4) + ((length - seed) * prime64_2));
+  return result;
+}
+
+/* computes the 64 bit hash of up to midSizeMax bytes */
+uint64_t hashShort64(const uint8_t* input, const std::size_t length, const uint64_t seed)
+{
+  const uint8_t* secret = defaultSecret;
+  if (length == 0)
+    return avalancheXXH64(seed ^ (read64(secret + 56) ^ read64(secret + 64)));
+  if (length <= 3)
+  {
+    const uint32_t combined = (static_cast<uint32_t>(input[0]) << 16) | (static_cast<uint32_t>(input[length >> 1]) << 24)
+                            | static_cast<uint32_t>(input[length - 1]) | (static_cast<uint32_t>(length) << 8);
+    const uint64_t bitflip = (read32(secret) ^ read32(secret + 4)) + seed;
+    return avalancheXXH64(static_cast<uint64_t>(combined) ^ bitflip);
+  }
+  if (length <= 8)
+  {
+    const uint64_t mixedSeed = seed ^ (static_cast<uint64_t>(swap32(static_cast<uint32_t>(seed))) << 32);
+    const uint64_t bitflip = (read64(secret + 8) ^ read64(secret + 16)) - mixedSeed;
+    const uint64_t input64 = read32(input + length - 4) + (static_cast<uint64_t>(read32(input)) << 32);
+    return rrmxmx(input64 ^ bitflip, length);
+  }
+  if (length <= 16)
+  {
+    const uint64_t bitflip1 = (read64(secret + 24) ^ read64(secret + 32)) + seed;
+    const uint64_t bitflip2 = (read64(secret + 40) ^ read64(secret + 48)) - seed;
+    const uint64_t low = read64(input) ^ bitflip1;
+    const uint64_t high = read64(input + length - 8) ^ bitflip2;
+    return avalanche(length + swap64(low) + high + multiplyFold(low, high));
+  }
+  uint64_t acc = length * prime64_1;
+  if (length <= 128)
+  {
+    // pairs of 16 bytes from the start and from the end of the input
+    for (std::size_t i = (length - 1) / 32 + 1; i > 0; --i)
+    {
+      const std::size_t offset = 16 * (i - 1);
+      acc += mix16(input + offset, secret + 2 * offset, seed);
+      acc += mix16(input + length - 16 - offset, secret + 2 * offset + 16, seed);
+    }
+    return avalanche(acc);
+  }
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    acc += mix16(input + 16 * i, secret + 16 * i, seed);
+  }
+  uint64_t accEnd = mix16(input + length - 16, secret + secretSizeMin - midSizeLastOffset, seed);
+  acc = avalanche(acc);
+  for (std::size_t i = 8; i < length / 16; ++i)
+  {
+    accEnd += mix16(input + 16 * i, secret + 16 * (i - 8) + midSizeStartOffset, seed);
+  }
+  return avalanche(acc + accEnd);
+}
+
+/* computes the 128 bit hash of up to midSizeMax bytes */
+Hash128 hashShort128(const uint8_t* input, const std::size_t length, const uint64_t seed)
+{
+  const uint8_t* secret = defaultSecret;
+  Hash128 result;
+  if (length == 0)
+  {
+    result.hash[1] = avalancheXXH64(seed ^ read64(secret + 64) ^ read64(secret + 72));
+    result.hash[0] = avalancheXXH64(seed ^ read64(secret + 80) ^ read64(secret + 88));
+    return result;
+  }
+  if (length <= 3)
+  {
+    const uint32_t combinedLow = (static_cast<uint32_t>(input[0]) << 16) | (static_cast<uint32_t>(input[length >> 1]) << 24)
+                               | static_cast<uint32_t>(input[length - 1]) | (static_cast<uint32_t>(length) << 8);
+    const uint32_t swapped = swap32(combinedLow);
+    const uint32_t combinedHigh = (swapped << 13) | (swapped >> 19);
+    const uint64_t bitflipLow = (read32(secret) ^ read32(secret + 4)) + seed;
+    const uint64_t bitflipHigh = (read32(secret + 8) ^ read32(secret + 12)) - seed;
+    result.hash[1] = avalancheXXH64(combinedLow ^ bitflipLow);
+    result.hash[0] = avalancheXXH64(combinedHigh ^ bitflipHigh);
+    return result;
+  }
+  if (length <= 8)
+  {
+    const uint64_t mixedSeed = seed ^ (static_cast<uint64_t>(swap32(static_cast<uint32_t>(seed))) << 32);
+    const uint64_t input64 = read32(input) + (static_cast<uint64_t>(read32(input + length - 4)) << 32);
+    const uint64_t bitflip = (read64(secret + 16) ^ read64(secret + 24)) + mixedSeed;
+    uint64_t high = 0;
+    uint64_t low = multiply128(input64 ^ bitflip, prime64_1 + (length << 2), high);
+    high += low << 1;
+    low ^= high >> 3;
+    low ^= low >> 35;
+    low *= 0x9FB21C651E98DF25ULL;
+    low ^= low >> 28;
+    result.hash[1] = low;
+    result.hash[0] = avalanche(high);
+    return result;
+  }
+  if (length <= 16)
+  {
+    const uint64_t bitflipLow = (read64(secret + 32) ^ read64(secret + 40)) - seed;
+    const uint64_t bitflipHigh = (read64(secret + 48) ^ read64(secret + 56)) + seed;
+    const uint64_t inputLow = read64(input);
+    const uint64_t inputHigh = read64(input + length - 8) ^ bitflipHigh;
+    uint64_t mHigh = 0;
+    uint64_t mLow = multiply128(inputLow ^ read64(input + length - 8) ^ bitflipLow, prime64_1, mHigh);
+    mLow += static_cast<uint64_t>(length - 1) << 54;
+    mHigh += inputHigh + (inputHigh & 0xFFFFFFFF) * (prime32_2 - 1);
+    mLow ^= swap64(mHigh);
+    uint64_t high = 0;
+    const uint64_t low = multiply128(mLow, prime64_2, high);
+    high += mHigh * prime64_2;
+    result.hash[1] = avalanche(low);
+    result.hash[0] = avalanche(high);
+    return result;
+  }
+  Accumulator128 acc = { length * prime64_1, 0 };
+  if (length <= 128)
+  {
+    for (std::size_t i = (length - 1) / 32 + 1; i > 0; --i)
+    {
+      const std::size_t offset = 16 * (i - 1);
+      mix32(acc, input + offset, input + length - 16 - offset, secret + 2 * offset, seed);
+    }
+    return finishMidSize128(acc, length, seed);
+  }
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    mix32(acc, input + 32 * i, input + 32 * i + 16, secret + 32 * i, seed);
+  }
+  acc.low = avalanche(acc.low);
+  acc.high = avalanche(acc.high);
+  for (std::size_t i = 4; i < length / 32; ++i)
+  {
+    mix32(acc, input + 32 * i, input + 32 * i + 16, secret + midSizeStartOffset + 32 * (i - 4), seed);
+  }
+  mix32(acc, input + length - 16, input + length - 32, secret + secretSizeMin - midSizeLastOffset - 16, 0 - seed);
+  return finishMidSize128(acc, length, seed);
+}
+
+uint64_t computeFromBuffer64(const void* data, const std::size_t length, const uint64_t seed)
+{
+  const uint8_t* input = static_cast<const uint8_t*>(data);
+  if (length <= midSizeMax)
+    return hashShort64(input, length, seed);
+  uint8_t customSecret[secretSize];
+  const uint8_t* secret = defaultSecret;
+  if (seed != 0)
+  {
+    deriveSecret(seed, customSecret);
+    secret = customSecret;
+  }
+  uint64_t acc[8];
+  std::copy(initialAccumulators, initialAccumulators + 8, acc);
+  accumulateLong(acc, input, length, secret);
+  return finishLong64(acc, secret, length);
+}
+
+Hash128 computeFromBuffer128(const void* data, const std::size_t length, const uint64_t seed)
+{
+  const uint8_t* input = static_cast<const uint8_t*>(data);
+  if (length <= midSizeMax)
+    return hashShort128(input, length, seed);
+  uint8_t customSecret[secretSize];
+  const uint8_t* secret = defaultSecret;
+  if (seed != 0)
+  {
+    deriveSecret(seed, customSecret);
+    secret = customSecret;
+  }
+  uint64_t acc[8];
+  std::copy(initialAccumulators, initialAccumulators + 8, acc);
+  accumulateLong(acc, input, length, secret);
+  return finishLong128(acc, secret, length);
+}
+
+} //namespace
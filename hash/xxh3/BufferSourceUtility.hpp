@@ -0,0 +1,52 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_XXH3_BUFFERSOURCEUTILITY_HPP
+#define LIBSTRIEZEL_XXH3_BUFFERSOURCEUTILITY_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "xxh3.hpp"
+
+namespace XXH3
+{
+
+/** \brief computes the 64 bit XXH3 hash of a buffer
+ *
+ * \param data    pointer to the data
+ * \param length  length of the data in bytes
+ * \param seed    the seed, zero is the default of xxHash
+ * \return Returns the same value as XXH3_64bits_withSeed() of xxHash.
+ */
+uint64_t computeFromBuffer64(const void* data, const std::size_t length, const uint64_t seed = 0);
+
+
+/** \brief computes the 128 bit XXH3 hash of a buffer
+ *
+ * \param data    pointer to the data
+ * \param length  length of the data in bytes
+ * \param seed    the seed, zero is the default of xxHash
+ * \return Returns the same value as XXH3_128bits_withSeed() of xxHash.
+ */
+Hash128 computeFromBuffer128(const void* data, const std::size_t length, const uint64_t seed = 0);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_XXH3_BUFFERSOURCEUTILITY_HPP
@@ -0,0 +1,91 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "FileSourceUtility.hpp"
+#include <iostream>
+#include "BufferSourceUtility.hpp"
+#include "Hasher.hpp"
+#include "../MappedFile.hpp"
+#include "../ReadAheadReader.hpp"
+
+namespace XXH3
+{
+
+/* passes the file's contents to the hasher, if it cannot be memory-mapped
+
+   parameters:
+       fileName - name of the file
+       hasher   - the hasher
+   return value:
+       Returns true, if the whole file was passed to the hasher.
+*/
+bool readIntoHasher(const std::string& fileName, Hasher& hasher)
+{
+  libstriezel::hash::ReadAheadReader reader;
+  if (!reader.open(fileName))
+  {
+    std::cout << "Could not open file \""<<fileName<<"\" for XXH3 hashing!\n";
+    return false;
+  }
+  const uint8_t* data = nullptr;
+  std::size_t length = 0;
+  while (reader.next(data, length))
+  {
+    hasher.update(data, length);
+  }
+  if (reader.failed())
+  {
+    std::cout << "Error while reading file \""<<fileName<<"\"!\n";
+    return false;
+  }
+  return true;
+}
+
+bool computeFromFile64(const std::string& fileName, uint64_t& hash, const uint64_t seed)
+{
+  libstriezel::hash::MappedFile mapped;
+  if (mapped.open(fileName))
+  {
+    hash = computeFromBuffer64(mapped.data(), mapped.size(), seed);
+    return true;
+  }
+  Hasher hasher(seed);
+  if (!readIntoHasher(fileName, hasher))
+    return false;
+  hash = hasher.digest64();
+  return true;
+}
+
+bool computeFromFile128(const std::string& fileName, Hash128& hash, const uint64_t seed)
+{
+  libstriezel::hash::MappedFile mapped;
+  if (mapped.open(fileName))
+  {
+    hash = computeFromBuffer128(mapped.data(), mapped.size(), seed);
+    return true;
+  }
+  Hasher hasher(seed);
+  if (!readIntoHasher(fileName, hasher))
+    return false;
+  hash = hasher.digest128();
+  return true;
+}
+
+} //namespace
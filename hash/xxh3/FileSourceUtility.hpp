@@ -0,0 +1,54 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_XXH3_FILESOURCEUTILITY_HPP
+#define LIBSTRIEZEL_XXH3_FILESOURCEUTILITY_HPP
+
+#include <stdint.h>
+#include <string>
+#include "xxh3.hpp"
+
+namespace XXH3
+{
+
+/** \brief computes the 64 bit XXH3 hash of the given file's contents
+ *
+ * \param fileName  name of the file
+ * \param hash      receives the hash value of the file
+ * \param seed      the seed, zero is the default of xxHash
+ * \return Returns true, if the hash value was computed.
+ *         Returns false, if an error occurred.
+ */
+bool computeFromFile64(const std::string& fileName, uint64_t& hash, const uint64_t seed = 0);
+
+
+/** \brief computes the 128 bit XXH3 hash of the given file's contents
+ *
+ * \param fileName  name of the file
+ * \param hash      receives the hash value of the file
+ * \param seed      the seed, zero is the default of xxHash
+ * \return Returns true, if the hash value was computed.
+ *         Returns false, if an error occurred.
+ */
+bool computeFromFile128(const std::string& fileName, Hash128& hash, const uint64_t seed = 0);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_XXH3_FILESOURCEUTILITY_HPP
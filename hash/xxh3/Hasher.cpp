@@ -0,0 +1,143 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "Hasher.hpp"
+#include <algorithm>
+#include <cstring>
+#include "BufferSourceUtility.hpp"
+
+namespace XXH3
+{
+
+Hasher::Hasher(const uint64_t seed)
+: m_Seed(seed), m_Secret(), m_Acc(), m_Buffer(), m_BufferLength(0),
+  m_StripesInBlock(0), m_Length(0)
+{
+  deriveSecret(seed, m_Secret);
+  reset();
+}
+
+void Hasher::reset()
+{
+  std::copy(initialAccumulators, initialAccumulators + 8, m_Acc);
+  m_BufferLength = 0;
+  m_StripesInBlock = 0;
+  m_Length = 0;
+}
+
+void Hasher::consumeStripes(uint64_t acc[8], std::size_t& stripesInBlock, const uint8_t* input, std::size_t nbStripes) const
+{
+  while (nbStripes > 0)
+  {
+    const std::size_t count = std::min(nbStripes, stripesPerBlock - stripesInBlock);
+    accumulate(acc, input, m_Secret + 8 * stripesInBlock, count);
+    stripesInBlock += count;
+    if (stripesInBlock == stripesPerBlock)
+    {
+      scramble(acc, m_Secret + secretSize - stripeLength);
+      stripesInBlock = 0;
+    }
+    input += count * stripeLength;
+    nbStripes -= count;
+  }
+}
+
+void Hasher::update(const void* data, const std::size_t length)
+{
+  if (length == 0)
+    return;
+  const uint8_t* input = static_cast<const uint8_t*>(data);
+  const uint8_t* const end = input + length;
+  m_Length += length;
+  if (length <= bufferSize - m_BufferLength)
+  {
+    memcpy(m_Buffer + m_BufferLength, input, length);
+    m_BufferLength += length;
+    return;
+  }
+
+  // The data is only consumed when more data follows, because the last
+  // stripe of the message is processed differently.
+  if (m_BufferLength > 0)
+  {
+    const std::size_t count = bufferSize - m_BufferLength;
+    memcpy(m_Buffer + m_BufferLength, input, count);
+    input += count;
+    consumeStripes(m_Acc, m_StripesInBlock, m_Buffer, bufferSize / stripeLength);
+    m_BufferLength = 0;
+  }
+  if (static_cast<std::size_t>(end - input) > bufferSize)
+  {
+    const std::size_t nbStripes = static_cast<std::size_t>(end - 1 - input) / stripeLength;
+    consumeStripes(m_Acc, m_StripesInBlock, input, nbStripes);
+    input += nbStripes * stripeLength;
+    // keep the last stripe, it may be needed for the final hash value
+    memcpy(m_Buffer + bufferSize - stripeLength, input - stripeLength, stripeLength);
+  }
+  m_BufferLength = static_cast<std::size_t>(end - input);
+  memcpy(m_Buffer, input, m_BufferLength);
+}
+
+uint64_t Hasher::length() const
+{
+  return m_Length;
+}
+
+void Hasher::finalAccumulators(uint64_t acc[8]) const
+{
+  std::copy(m_Acc, m_Acc + 8, acc);
+  uint8_t lastStripe[stripeLength];
+  const uint8_t* lastStripePtr = nullptr;
+  if (m_BufferLength >= stripeLength)
+  {
+    std::size_t stripesInBlock = m_StripesInBlock;
+    consumeStripes(acc, stripesInBlock, m_Buffer, (m_BufferLength - 1) / stripeLength);
+    lastStripePtr = m_Buffer + m_BufferLength - stripeLength;
+  }
+  else
+  {
+    // the beginning of the last stripe was consumed before
+    const std::size_t catchUp = stripeLength - m_BufferLength;
+    memcpy(lastStripe, m_Buffer + bufferSize - catchUp, catchUp);
+    memcpy(lastStripe + catchUp, m_Buffer, m_BufferLength);
+    lastStripePtr = lastStripe;
+  }
+  accumulate(acc, lastStripePtr, m_Secret + secretSize - stripeLength - 7, 1);
+}
+
+uint64_t Hasher::digest64() const
+{
+  if (m_Length <= midSizeMax)
+    return computeFromBuffer64(m_Buffer, m_BufferLength, m_Seed);
+  uint64_t acc[8];
+  finalAccumulators(acc);
+  return finishLong64(acc, m_Secret, m_Length);
+}
+
+Hash128 Hasher::digest128() const
+{
+  if (m_Length <= midSizeMax)
+    return computeFromBuffer128(m_Buffer, m_BufferLength, m_Seed);
+  uint64_t acc[8];
+  finalAccumulators(acc);
+  return finishLong128(acc, m_Secret, m_Length);
+}
+
+} //namespace
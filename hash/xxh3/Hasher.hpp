@@ -0,0 +1,112 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_XXH3_HASHER_HPP
+#define LIBSTRIEZEL_XXH3_HASHER_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "accumulate.hpp"
+#include "xxh3.hpp"
+
+namespace XXH3
+{
+
+/** \brief incremental computation of XXH3 hash values
+ *
+ * The same state yields the 64 bit and the 128 bit hash value, so both can
+ * be computed from a single pass over the data.
+ */
+class Hasher
+{
+  public:
+    /** \brief constructor
+     *
+     * \param seed  the seed, zero is the default of xxHash
+     */
+    explicit Hasher(const uint64_t seed = 0);
+
+
+    /** \brief resets the hasher to the state before any data was passed */
+    void reset();
+
+
+    /** \brief passes the next piece of the message to the hasher
+     *
+     * \param data    pointer to the data
+     * \param length  length of the data in bytes
+     */
+    void update(const void* data, const std::size_t length);
+
+
+    /** \brief gets the number of bytes that have been passed to the hasher
+     *
+     * \return Returns the number of bytes passed since the last reset.
+     */
+    uint64_t length() const;
+
+
+    /** \brief computes the 64 bit hash value of the data so far
+     *
+     * \return Returns the 64 bit XXH3 hash of all data that was passed to
+     *         update() since the last reset.
+     * \remarks Unlike the SHA hashers, the state is not changed, so more
+     *          data may be passed afterwards.
+     */
+    uint64_t digest64() const;
+
+
+    /** \brief computes the 128 bit hash value of the data so far
+     *
+     * \return Returns the 128 bit XXH3 hash of all data that was passed to
+     *         update() since the last reset.
+     * \remarks Unlike the SHA hashers, the state is not changed, so more
+     *          data may be passed afterwards.
+     */
+    Hash128 digest128() const;
+  private:
+    static const std::size_t bufferSize = 256;
+
+    /* accumulates stripes and scrambles whenever a block is complete
+
+       parameters:
+           acc             - the accumulators
+           stripesInBlock  - number of stripes of the current block so far
+           input           - pointer to the stripes
+           nbStripes       - number of stripes
+    */
+    void consumeStripes(uint64_t acc[8], std::size_t& stripesInBlock, const uint8_t* input, std::size_t nbStripes) const;
+
+    /* accumulates the buffered data and the last stripe for the final hash
+       value, without changing the state */
+    void finalAccumulators(uint64_t acc[8]) const;
+
+    uint64_t m_Seed;                /**< the seed */
+    uint8_t m_Secret[secretSize];   /**< secret for inputs above midSizeMax */
+    uint64_t m_Acc[8];              /**< the accumulators */
+    uint8_t m_Buffer[bufferSize];   /**< buffered input */
+    std::size_t m_BufferLength;     /**< number of bytes in m_Buffer */
+    std::size_t m_StripesInBlock;   /**< stripes of the current block so far */
+    uint64_t m_Length;              /**< total message length in bytes */
+}; //class
+
+} //namespace
+
+#endif // LIBSTRIEZEL_XXH3_HASHER_HPP
@@ -0,0 +1,320 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "accumulate.hpp"
+#include <atomic>
+#include <cstring>
+#include "../cpu_features.hpp"
+
+namespace XXH3
+{
+
+const uint8_t defaultSecret[secretSize] = {
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+void deriveSecret(const uint64_t seed, uint8_t secret[secretSize])
+{
+  for (std::size_t i = 0; i < secretSize; i += 16)
+  {
+    const uint64_t low = read64(defaultSecret + i) + seed;
+    const uint64_t high = read64(defaultSecret + i + 8) - seed;
+    for (unsigned int j = 0; j < 8; ++j)
+    {
+      secret[i + j] = static_cast<uint8_t>(low >> (8 * j));
+      secret[i + 8 + j] = static_cast<uint8_t>(high >> (8 * j));
+    }
+  }
+}
+
+/* scalar implementation of accumulate() */
+void accumulateScalar(uint64_t acc[8], const uint8_t* input, const uint8_t* secret, std::size_t nbStripes)
+{
+  while (nbStripes > 0)
+  {
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      const uint64_t data = read64(input + 8 * i);
+      const uint64_t key = data ^ read64(secret + 8 * i);
+      acc[i ^ 1] += data;
+      acc[i] += (key & 0xFFFFFFFF) * (key >> 32);
+    }
+    input += stripeLength;
+    secret += 8;
+    --nbStripes;
+  }
+}
+
+/* scalar implementation of scramble() */
+void scrambleScalar(uint64_t acc[8], const uint8_t* secret)
+{
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    uint64_t a = acc[i];
+    a ^= a >> 47;
+    a ^= read64(secret + 8 * i);
+    acc[i] = a * prime32_1;
+  }
+}
+
+#if defined(LIBSTRIEZEL_HASH_X86)
+typedef uint64_t Vector2 __attribute__((vector_size(16)));
+typedef uint64_t Vector4 __attribute__((vector_size(32)));
+typedef uint64_t Vector8 __attribute__((vector_size(64)));
+
+/* The vector implementations keep L accumulators in each vector of type V.
+   The compiler maps the swap of neighbouring lanes to a shuffle and the
+   32 x 32 bit multiplication of masked and shifted lanes to pmuludq. */
+template <typename V, unsigned int L>
+__attribute__((always_inline)) inline void accumulateLanes(uint64_t acc[8], const uint8_t* input, const uint8_t* secret, std::size_t nbStripes)
+{
+  V a[8 / L];
+  memcpy(a, acc, 64);
+  V swapMask;
+  for (unsigned int l = 0; l < L; ++l)
+  {
+    swapMask[l] = l ^ 1;
+  }
+  while (nbStripes > 0)
+  {
+    for (unsigned int i = 0; i < 8 / L; ++i)
+    {
+      V data;
+      V key;
+      memcpy(&data, input + 8 * L * i, sizeof(V));
+      memcpy(&key, secret + 8 * L * i, sizeof(V));
+      key ^= data;
+      a[i] += __builtin_shuffle(data, swapMask) + (key & 0xFFFFFFFF) * (key >> 32);
+    }
+    input += stripeLength;
+    secret += 8;
+    --nbStripes;
+  }
+  memcpy(acc, a, 64);
+}
+
+template <typename V, unsigned int L>
+__attribute__((always_inline)) inline void scrambleLanes(uint64_t acc[8], const uint8_t* secret)
+{
+  for (unsigned int i = 0; i < 8 / L; ++i)
+  {
+    V a;
+    V key;
+    memcpy(&a, acc + L * i, sizeof(V));
+    memcpy(&key, secret + 8 * L * i, sizeof(V));
+    a ^= a >> 47;
+    a ^= key;
+    // both halves are multiplied separately to stay with 32 bit factors
+    a = (a & 0xFFFFFFFF) * prime32_1 + (((a >> 32) * prime32_1) << 32);
+    memcpy(acc + L * i, &a, sizeof(V));
+  }
+}
+
+__attribute__((target("sse2")))
+void accumulateSSE2(uint64_t acc[8], const uint8_t* input, const uint8_t* secret, std::size_t nbStripes)
+{
+  accumulateLanes<Vector2, 2>(acc, input, secret, nbStripes);
+}
+
+__attribute__((target("sse2")))
+void scrambleSSE2(uint64_t acc[8], const uint8_t* secret)
+{
+  scrambleLanes<Vector2, 2>(acc, secret);
+}
+
+__attribute__((target("avx2")))
+void accumulateAVX2(uint64_t acc[8], const uint8_t* input, const uint8_t* secret, std::size_t nbStripes)
+{
+  accumulateLanes<Vector4, 4>(acc, input, secret, nbStripes);
+}
+
+__attribute__((target("avx2")))
+void scrambleAVX2(uint64_t acc[8], const uint8_t* secret)
+{
+  scrambleLanes<Vector4, 4>(acc, secret);
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw")))
+void accumulateAVX512(uint64_t acc[8], const uint8_t* input, const uint8_t* secret, std::size_t nbStripes)
+{
+  accumulateLanes<Vector8, 8>(acc, input, secret, nbStripes);
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw")))
+void scrambleAVX512(uint64_t acc[8], const uint8_t* secret)
+{
+  scrambleLanes<Vector8, 8>(acc, secret);
+}
+#endif // LIBSTRIEZEL_HASH_X86
+
+bool isSupported(const Implementation impl)
+{
+  #if defined(LIBSTRIEZEL_HASH_X86)
+  const libstriezel::hash::CpuFeatures& features = libstriezel::hash::cpuFeatures();
+  #endif
+  switch (impl)
+  {
+    case Implementation::Scalar:
+         return true;
+    #if defined(LIBSTRIEZEL_HASH_X86)
+    case Implementation::SSE2:
+         // SSE2 is part of every processor that has SSE 4.1.
+         return features.sse41;
+    case Implementation::AVX2:
+         return features.avx2;
+    case Implementation::AVX512:
+         return features.avx512;
+    #else
+    case Implementation::SSE2:
+    case Implementation::AVX2:
+    case Implementation::AVX512:
+         return false;
+    #endif
+  }//swi
+  return false;
+}
+
+/* returns the fastest implementation that is supported */
+Implementation detectBestImplementation()
+{
+  if (isSupported(Implementation::AVX512))
+    return Implementation::AVX512;
+  if (isSupported(Implementation::AVX2))
+    return Implementation::AVX2;
+  if (isSupported(Implementation::SSE2))
+    return Implementation::SSE2;
+  return Implementation::Scalar;
+}
+
+/* returns the variable that holds the active implementation */
+std::atomic<Implementation>& activeImplementation()
+{
+  static std::atomic<Implementation> impl(detectBestImplementation());
+  return impl;
+}
+
+Implementation getImplementation()
+{
+  return activeImplementation().load(std::memory_order_relaxed);
+}
+
+bool setImplementation(const Implementation impl)
+{
+  if (!isSupported(impl))
+    return false;
+  activeImplementation().store(impl, std::memory_order_relaxed);
+  return true;
+}
+
+void accumulate(uint64_t acc[8], const uint8_t* input, const uint8_t* secret, const std::size_t nbStripes)
+{
+  switch (getImplementation())
+  {
+    #if defined(LIBSTRIEZEL_HASH_X86)
+    case Implementation::SSE2:
+         accumulateSSE2(acc, input, secret, nbStripes);
+         return;
+    case Implementation::AVX2:
+         accumulateAVX2(acc, input, secret, nbStripes);
+         return;
+    case Implementation::AVX512:
+         accumulateAVX512(acc, input, secret, nbStripes);
+         return;
+    #endif
+    default:
+         accumulateScalar(acc, input, secret, nbStripes);
+         return;
+  }//swi
+}
+
+void scramble(uint64_t acc[8], const uint8_t* secret)
+{
+  switch (getImplementation())
+  {
+    #if defined(LIBSTRIEZEL_HASH_X86)
+    case Implementation::SSE2:
+         scrambleSSE2(acc, secret);
+         return;
+    case Implementation::AVX2:
+         scrambleAVX2(acc, secret);
+         return;
+    case Implementation::AVX512:
+         scrambleAVX512(acc, secret);
+         return;
+    #endif
+    default:
+         scrambleScalar(acc, secret);
+         return;
+  }//swi
+}
+
+/* offset of the secret for merging the accumulators */
+const std::size_t mergeOffset = 11;
+
+void accumulateLong(uint64_t acc[8], const uint8_t* input, const std::size_t length, const uint8_t* secret)
+{
+  const std::size_t blockLength = stripeLength * stripesPerBlock;
+  // The last stripe is always processed separately, even if it is complete.
+  const std::size_t blocks = (length - 1) / blockLength;
+  for (std::size_t n = 0; n < blocks; ++n)
+  {
+    accumulate(acc, input + n * blockLength, secret, stripesPerBlock);
+    scramble(acc, secret + secretSize - stripeLength);
+  }
+  const std::size_t stripes = ((length - 1) - blockLength * blocks) / stripeLength;
+  accumulate(acc, input + blocks * blockLength, secret, stripes);
+  accumulate(acc, input + length - stripeLength, secret + secretSize - stripeLength - 7, 1);
+}
+
+uint64_t mergeAccumulators(const uint64_t acc[8], const uint8_t* secret, const uint64_t start)
+{
+  uint64_t result = start;
+  for (unsigned int i = 0; i < 4; ++i)
+  {
+    result += multiplyFold(acc[2 * i] ^ read64(secret + 16 * i), acc[2 * i + 1] ^ read64(secret + 16 * i + 8));
+  }
+  return avalanche(result);
+}
+
+uint64_t finishLong64(const uint64_t acc[8], const uint8_t* secret, const uint64_t length)
+{
+  return mergeAccumulators(acc, secret + mergeOffset, length * prime64_1);
+}
+
+Hash128 finishLong128(const uint64_t acc[8], const uint8_t* secret, const uint64_t length)
+{
+  Hash128 result;
+  result.hash[1] = mergeAccumulators(acc, secret + mergeOffset, length * prime64_1);
+  result.hash[0] = mergeAccumulators(acc, secret + secretSize - stripeLength - mergeOffset, ~(length * prime64_2));
+  return result;
+}
+
+} //namespace
@@ -0,0 +1,239 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_XXH3_ACCUMULATE_HPP
+#define LIBSTRIEZEL_XXH3_ACCUMULATE_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "xxh3.hpp"
+
+/* Building blocks of XXH3, the 64 bit and 128 bit variants of xxHash 0.8.
+   XXH3 is no cryptographic hash, but it runs at memory bandwidth, which
+   makes it useful to sort out files that cannot be equal. */
+
+namespace XXH3
+{
+
+/// size of a stripe in bytes
+const std::size_t stripeLength = 64;
+
+/// size of the secret in bytes
+const std::size_t secretSize = 192;
+
+/// number of stripes of a block, after each block the accumulators are
+/// scrambled
+const std::size_t stripesPerBlock = (secretSize - stripeLength) / 8;
+
+/// longest input that is not hashed via stripes
+const std::size_t midSizeMax = 240;
+
+const uint32_t prime32_1 = 0x9E3779B1U;
+const uint32_t prime32_2 = 0x85EBCA77U;
+const uint32_t prime32_3 = 0xC2B2AE3DU;
+const uint64_t prime64_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t prime64_3 = 0x165667B19E3779F9ULL;
+const uint64_t prime64_4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t prime64_5 = 0x27D4EB2F165667C5ULL;
+
+/// the default secret
+extern const uint8_t defaultSecret[secretSize];
+
+/// initial values of the accumulators
+const uint64_t initialAccumulators[8] = {
+  prime32_3, prime64_1, prime64_2, prime64_3,
+  prime64_4, prime32_2, prime64_5, prime32_1
+};
+
+
+/// implementations of the accumulation
+enum class Implementation
+{
+  Scalar, /**< portable C++ implementation */
+  SSE2,   /**< two accumulators per instruction, using SSE2 */
+  AVX2,   /**< four accumulators per instruction, using AVX2 */
+  AVX512  /**< all eight accumulators at once, using AVX-512 */
+};
+
+
+/** \brief checks whether an implementation can be used on this machine
+ *
+ * \param impl  the implementation
+ * \return Returns true, if the implementation is supported.
+ */
+bool isSupported(const Implementation impl);
+
+
+/** \brief gets the implementation that is currently used
+ *
+ * \return Returns the implementation used by accumulate() and scramble().
+ * \remarks By default, the fastest supported implementation is used.
+ */
+Implementation getImplementation();
+
+
+/** \brief sets the implementation of the accumulation
+ *
+ * \param impl  the implementation that shall be used
+ * \return Returns true, if the implementation was changed.
+ *         Returns false, if the implementation is not supported.
+ */
+bool setImplementation(const Implementation impl);
+
+
+/** \brief reads eight bytes in little endian order */
+inline uint64_t read64(const uint8_t* p)
+{
+  uint64_t result = 0;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    result |= static_cast<uint64_t>(p[i]) << (8 * i);
+  }
+  return result;
+}
+
+
+/** \brief reads four bytes in little endian order */
+inline uint32_t read32(const uint8_t* p)
+{
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+       | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+
+/** \brief multiplies two 64 bit numbers
+ *
+ * \param a     first factor
+ * \param b     second factor
+ * \param high  receives the upper 64 bits of the product
+ * \return Returns the lower 64 bits of the product.
+ */
+inline uint64_t multiply128(const uint64_t a, const uint64_t b, uint64_t& high)
+{
+  #if defined(__SIZEOF_INT128__)
+  // __extension__ keeps -pedantic quiet about the non-standard type
+  __extension__ typedef unsigned __int128 UInt128;
+  const UInt128 product = static_cast<UInt128>(a) * b;
+  high = static_cast<uint64_t>(product >> 64);
+  return static_cast<uint64_t>(product);
+  #else
+  const uint64_t lowLow = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+  const uint64_t highLow = (a >> 32) * (b & 0xFFFFFFFF);
+  const uint64_t lowHigh = (a & 0xFFFFFFFF) * (b >> 32);
+  const uint64_t highHigh = (a >> 32) * (b >> 32);
+  const uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+  high = (highLow >> 32) + (cross >> 32) + highHigh;
+  return (cross << 32) | (lowLow & 0xFFFFFFFF);
+  #endif
+}
+
+
+/** \brief multiplies two 64 bit numbers and returns the xor of both
+ *         halves of the 128 bit product
+ */
+inline uint64_t multiplyFold(const uint64_t a, const uint64_t b)
+{
+  uint64_t high = 0;
+  const uint64_t low = multiply128(a, b, high);
+  return low ^ high;
+}
+
+
+/** \brief mixes the bits of a 64 bit value (final step of most lengths) */
+inline uint64_t avalanche(uint64_t h)
+{
+  h ^= h >> 37;
+  h *= 0x165667919E3779F9ULL;
+  h ^= h >> 32;
+  return h;
+}
+
+
+/** \brief derives the secret for a seed
+ *
+ * \param seed    the seed
+ * \param secret  receives secretSize bytes
+ */
+void deriveSecret(const uint64_t seed, uint8_t secret[secretSize]);
+
+
+/** \brief accumulates consecutive stripes
+ *
+ * \param acc        the eight accumulators
+ * \param input      pointer to the stripes
+ * \param secret     secret for the first stripe, each further stripe uses
+ *                   the secret eight bytes later
+ * \param nbStripes  number of stripes
+ */
+void accumulate(uint64_t acc[8], const uint8_t* input, const uint8_t* secret, const std::size_t nbStripes);
+
+
+/** \brief scrambles the accumulators at the end of a block
+ *
+ * \param acc     the eight accumulators
+ * \param secret  the last 64 bytes of the secret
+ */
+void scramble(uint64_t acc[8], const uint8_t* secret);
+
+
+/** \brief accumulates the stripes of input that is longer than midSizeMax
+ *
+ * \param acc     the eight accumulators, initialized with
+ *                initialAccumulators
+ * \param input   pointer to the input
+ * \param length  length of the input in bytes
+ * \param secret  the secret
+ */
+void accumulateLong(uint64_t acc[8], const uint8_t* input, const std::size_t length, const uint8_t* secret);
+
+
+/** \brief merges the accumulators into a 64 bit hash value
+ *
+ * \param acc     the eight accumulators
+ * \param secret  secret for merging
+ * \param start   start value
+ * \return Returns the merged value.
+ */
+uint64_t mergeAccumulators(const uint64_t acc[8], const uint8_t* secret, const uint64_t start);
+
+
+/** \brief computes the 64 bit hash value from the accumulators
+ *
+ * \param acc     the eight accumulators after accumulateLong()
+ * \param secret  the secret
+ * \param length  length of the input in bytes
+ * \return Returns the hash value.
+ */
+uint64_t finishLong64(const uint64_t acc[8], const uint8_t* secret, const uint64_t length);
+
+
+/** \brief computes the 128 bit hash value from the accumulators
+ *
+ * \param acc     the eight accumulators after accumulateLong()
+ * \param secret  the secret
+ * \param length  length of the input in bytes
+ * \return Returns the hash value.
+ */
+Hash128 finishLong128(const uint64_t acc[8], const uint8_t* secret, const uint64_t length);
+
+} //namespace
+
+#endif // LIBSTRIEZEL_XXH3_ACCUMULATE_HPP
@@ -0,0 +1,80 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include "xxh3.hpp"
+#include "../HexEncoding.hpp"
+
+namespace XXH3
+{
+
+// Hash128 functions
+
+Hash128::Hash128()
+{
+  setToNull();
+}
+
+std::string Hash128::toHexString() const
+{
+  std::string result(hexLength, '0');
+  toHexChars(&result[0]);
+  return result;
+}
+
+void Hash128::toHexChars(char* buffer) const
+{
+  libstriezel::hash::encodeWords(hash, 2, buffer);
+}
+
+bool Hash128::fromHexString(const std::string_view hexString)
+{
+  if (hexString.length() != hexLength)
+    return false;
+  return libstriezel::hash::decodeWords(hexString.data(), 2, hash);
+}
+
+bool Hash128::isNull() const
+{
+  return ((hash[0]==0) and (hash[1]==0));
+}
+
+void Hash128::setToNull()
+{
+  hash[0] = hash[1] = 0;
+}
+
+bool Hash128::operator==(const Hash128& other) const
+{
+  return ((hash[0]==other.hash[0]) and (hash[1]==other.hash[1]));
+}
+
+bool Hash128::operator!=(const Hash128& other) const
+{
+  return ((hash[0]!=other.hash[0]) or (hash[1]!=other.hash[1]));
+}
+
+bool Hash128::operator<(const Hash128& other) const
+{
+  if (hash[0]<other.hash[0]) return true;
+  if (hash[0]>other.hash[0]) return false;
+  return (hash[1]<other.hash[1]);
+}
+
+} //namespace
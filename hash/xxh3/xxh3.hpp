@@ -0,0 +1,102 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_XXH3_HPP
+#define LIBSTRIEZEL_XXH3_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+
+namespace XXH3
+{
+  ///the 128 bit hash value of XXH3
+  struct Hash128
+  {
+    /* the upper (index 0) and the lower (index 1) 64 bits, so that the
+       hexadecimal representation is the canonical one of xxHash */
+    uint64_t hash[2];
+
+    /* number of characters of the hexadecimal representation */
+    static constexpr std::size_t hexLength = 32;
+
+    /* default constructor */
+    Hash128();
+
+    /* returns the hash value's representation as hexadecimal string */
+    std::string toHexString() const;
+
+    /* writes the hash value's representation as hexadecimal string to the
+       given buffer
+
+       parameters:
+           buffer - buffer for exactly hexLength characters, no terminating
+                    null character is written
+    */
+    void toHexChars(char* buffer) const;
+
+    /* set the hash value according to the given hexadecimal string and
+       returns true in case of success, or false if the string does not re-
+       present a valid hexadecimal hash value
+
+       parameters:
+           hexString - the string containing the hash value as hex digits
+                       (must be all lower case)
+    */
+    bool fromHexString(const std::string_view hexString);
+
+    /* returns true, if all hash bits are set to zero */
+    bool isNull() const;
+
+    /* sets all bits of the hash to zero */
+    void setToNull();
+
+    /* equality operator */
+    bool operator==(const Hash128& other) const;
+
+    /* inequality operator */
+    bool operator!=(const Hash128& other) const;
+
+    /* comparison operator */
+    bool operator<(const Hash128& other) const;
+  };
+} //namespace
+
+
+namespace std
+{
+  /** \brief hash function for XXH3 hash values
+   *
+   * The bits of a hash value are already evenly distributed, so the lower
+   * 64 bits are used as hash value.
+   */
+  template<>
+  struct hash<XXH3::Hash128>
+  {
+    std::size_t operator()(const XXH3::Hash128& digest) const noexcept
+    {
+      return static_cast<std::size_t>(digest.hash[1]);
+    }
+  };
+} //namespace
+
+#endif // LIBSTRIEZEL_XXH3_HPP
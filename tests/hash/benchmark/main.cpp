@@ -0,0 +1,468 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../filesystem/file.hpp"
+#include "../../../hash/blake3/Hasher.hpp"
+#include "../../../hash/blake3/compression.hpp"
+#include "../../../hash/crc32c/crc32c.hpp"
+#include "../../../hash/sha1/BufferSourceUtility.hpp"
+#include "../../../hash/sha1/FileSourceUtility.hpp"
+#include "../../../hash/sha1/Hasher.hpp"
+#include "../../../hash/sha1/compression.hpp"
+#include "../../../hash/sha224/BufferSourceUtility.hpp"
+#include "../../../hash/sha224/FileSourceUtility.hpp"
+#include "../../../hash/sha224/Hasher.hpp"
+#include "../../../hash/sha256/BatchUtility.hpp"
+#include "../../../hash/sha256/BufferSourceUtility.hpp"
+#include "../../../hash/sha256/FileSourceUtility.hpp"
+#include "../../../hash/sha256/Hasher.hpp"
+#include "../../../hash/sha256/compression.hpp"
+#include "../../../hash/sha384/BufferSourceUtility.hpp"
+#include "../../../hash/sha384/FileSourceUtility.hpp"
+#include "../../../hash/sha384/Hasher.hpp"
+#include "../../../hash/sha512/BufferSourceUtility.hpp"
+#include "../../../hash/sha512/FileSourceUtility.hpp"
+#include "../../../hash/sha512/Hasher.hpp"
+#include "../../../hash/sha512/compression.hpp"
+#include "../../../hash/xxh3/BufferSourceUtility.hpp"
+
+/* Measures throughput and latency of the hash functions for message sizes
+   from 0 bytes up to 1 GiB. Every algorithm is measured through each of its
+   entry points (BufferSource, Hasher, FileSource) and with every SIMD
+   implementation that the processor supports. The results are written as
+   a table, as CSV or as JSON. */
+
+typedef std::chrono::steady_clock Clock;
+
+/* result of the hash functions, so that the compiler cannot drop them */
+volatile std::size_t sink = 0;
+
+/* a hash function through one of its entry points */
+struct Case
+{
+  std::string algorithm;       /* name of the algorithm */
+  std::string path;            /* entry point, e.g. "hasher" */
+  std::string implementation;  /* implementation, or "default" */
+  std::function<bool()> select;  /* activates the implementation */
+  std::function<void(uint8_t*, std::size_t)> run; /* hashes one message */
+  bool usesFile;               /* whether run() hashes the file instead */
+  std::size_t maxSize;         /* largest size for this case */
+  unsigned int messages = 1;   /* number of messages per call of run() */
+};
+
+/* measurement of one case and size */
+struct Result
+{
+  const Case* testCase;
+  std::size_t size;
+  uint64_t iterations;
+  double meanNanoseconds;
+  double minNanoseconds;
+};
+
+/* name of the file that is hashed by the FileSource cases */
+std::string fileName;
+
+template<typename Digest>
+void consume(const Digest& digest)
+{
+  sink = sink ^ std::hash<Digest>()(digest);
+}
+
+template<typename H>
+void hashWithHasher(uint8_t* data, const std::size_t length)
+{
+  H hasher;
+  hasher.update(data, length);
+  consume(hasher.finalize());
+}
+
+/* adds the cases of a SHA variant */
+template<typename H, typename BufferFunction, typename FileFunction>
+void addSHA(std::vector<Case>& cases, const std::string& algorithm, BufferFunction buffer, FileFunction file,
+            const std::vector<std::pair<std::string, std::function<bool()> > >& implementations)
+{
+  const auto any = []() { return true; };
+  cases.push_back(Case{ algorithm, "buffer-source", "default", any,
+      [buffer](uint8_t* data, std::size_t length) { consume(buffer(data, 8 * static_cast<uint64_t>(length))); }, false, ~std::size_t(0) });
+  for (const auto& impl : implementations)
+  {
+    cases.push_back(Case{ algorithm, "hasher", impl.first, impl.second, hashWithHasher<H>, false, ~std::size_t(0) });
+  }
+  cases.push_back(Case{ algorithm, "file-source", "default", any,
+      [file](uint8_t*, std::size_t) { consume(file(fileName)); }, true, ~std::size_t(0) });
+}
+
+/* returns all cases */
+std::vector<Case> createCases()
+{
+  std::vector<Case> cases;
+  const auto any = []() { return true; };
+  const std::vector<std::pair<std::string, std::function<bool()> > > sha1 = {
+    { "scalar", []() { return SHA1::setImplementation(SHA1::Implementation::Scalar); } },
+    { "sha-ni", []() { return SHA1::setImplementation(SHA1::Implementation::SHANI); } }
+  };
+  const std::vector<std::pair<std::string, std::function<bool()> > > sha256 = {
+    { "scalar", []() { return SHA256::setImplementation(SHA256::Implementation::Scalar); } },
+    { "sha-ni", []() { return SHA256::setImplementation(SHA256::Implementation::SHANI); } }
+  };
+  const std::vector<std::pair<std::string, std::function<bool()> > > sha512 = {
+    { "scalar", []() { return SHA512::setImplementation(SHA512::Implementation::Scalar); } },
+    { "avx2", []() { return SHA512::setImplementation(SHA512::Implementation::AVX2); } },
+    { "avx512", []() { return SHA512::setImplementation(SHA512::Implementation::AVX512); } }
+  };
+  const std::vector<std::pair<std::string, std::function<bool()> > > blake3 = {
+    { "scalar", []() { return BLAKE3::setImplementation(BLAKE3::Implementation::Scalar); } },
+    { "sse4.1", []() { return BLAKE3::setImplementation(BLAKE3::Implementation::SSE41); } },
+    { "avx2", []() { return BLAKE3::setImplementation(BLAKE3::Implementation::AVX2); } },
+    { "avx512", []() { return BLAKE3::setImplementation(BLAKE3::Implementation::AVX512); } }
+  };
+
+  addSHA<SHA1::Hasher>(cases, "SHA-1", SHA1::computeFromBuffer,
+      [](const std::string& name) { return SHA1::computeFromFile(name); }, sha1);
+  addSHA<SHA224::Hasher>(cases, "SHA-224", SHA224::computeFromBuffer,
+      [](const std::string& name) { return SHA224::computeFromFile(name); }, sha256);
+  addSHA<SHA256::Hasher>(cases, "SHA-256", SHA256::computeFromBuffer,
+      [](const std::string& name) { return SHA256::computeFromFile(name); }, sha256);
+  // 16 messages of the same size at once, the latency is per message
+  for (const auto& impl : { std::make_pair(std::string("sse4.1"), SHA256::BatchImplementation::SSE41),
+                            std::make_pair(std::string("avx2"), SHA256::BatchImplementation::AVX2),
+                            std::make_pair(std::string("avx512"), SHA256::BatchImplementation::AVX512) })
+  {
+    const SHA256::BatchImplementation batchImpl = impl.second;
+    cases.push_back(Case{ "SHA-256", "batch-of-16", impl.first,
+        [batchImpl]() { return SHA256::setBatchImplementation(batchImpl); },
+        [](uint8_t* data, std::size_t length)
+        {
+          const std::vector<SHA256::BatchMessage> messages(16, SHA256::BatchMessage{ data, length });
+          for (const SHA256::MessageDigest& digest : SHA256::computeFromBuffers(messages))
+          {
+            consume(digest);
+          }
+        }, false, 1024 * 1024, 16 });
+  }
+  addSHA<SHA384::Hasher>(cases, "SHA-384", SHA384::computeFromBuffer,
+      [](const std::string& name) { return SHA384::computeFromFile(name); }, sha512);
+  addSHA<SHA512::Hasher>(cases, "SHA-512", SHA512::computeFromBuffer,
+      [](const std::string& name) { return SHA512::computeFromFile(name); }, sha512);
+  for (const auto& impl : blake3)
+  {
+    cases.push_back(Case{ "BLAKE3", "hasher", impl.first, impl.second, hashWithHasher<BLAKE3::Hasher>, false, ~std::size_t(0) });
+  }
+  cases.push_back(Case{ "XXH3-64", "buffer", "default", any,
+      [](uint8_t* data, std::size_t length) { sink = sink ^ XXH3::computeFromBuffer64(data, length); }, false, ~std::size_t(0) });
+  cases.push_back(Case{ "CRC-32C", "buffer", "default", any,
+      [](uint8_t* data, std::size_t length) { sink = sink ^ CRC32C::computeFromBuffer(data, length); }, false, ~std::size_t(0) });
+  return cases;
+}
+
+/* the implementations that are active by default */
+struct DefaultImplementations
+{
+  SHA1::Implementation sha1;
+  SHA256::Implementation sha256;
+  SHA256::BatchImplementation sha256Batch;
+  SHA512::Implementation sha512;
+  BLAKE3::Implementation blake3;
+
+  DefaultImplementations()
+  : sha1(SHA1::getImplementation()), sha256(SHA256::getImplementation()),
+    sha256Batch(SHA256::getBatchImplementation()), sha512(SHA512::getImplementation()),
+    blake3(BLAKE3::getImplementation())
+  {
+  }
+
+  /* activates the default implementations again */
+  void restore() const
+  {
+    SHA1::setImplementation(sha1);
+    SHA256::setImplementation(sha256);
+    SHA256::setBatchImplementation(sha256Batch);
+    SHA512::setImplementation(sha512);
+    BLAKE3::setImplementation(blake3);
+  }
+};
+
+/* measures one case with messages of the given size
+
+   Small messages are timed in batches, so that the overhead of the clock
+   does not distort the result. The minimum is the fastest batch divided by
+   its number of messages.
+*/
+Result measure(const Case& testCase, uint8_t* data, const std::size_t size, const double minSeconds)
+{
+  // warm-up, which also determines the size of a batch
+  uint64_t batch = 1;
+  while (true)
+  {
+    const Clock::time_point start = Clock::now();
+    for (uint64_t i = 0; i < batch; ++i)
+    {
+      testCase.run(data, size);
+    }
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    if ((elapsed >= 1e-4) || (batch >= (1u << 24)))
+      break;
+    batch *= 2;
+  }
+
+  Result result{ &testCase, size, 0, 0.0, 0.0 };
+  double total = 0.0;
+  double fastest = 0.0;
+  unsigned int batches = 0;
+  while ((total < minSeconds) || (batches < 3))
+  {
+    const Clock::time_point start = Clock::now();
+    for (uint64_t i = 0; i < batch; ++i)
+    {
+      testCase.run(data, size);
+    }
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    if ((batches == 0) || (elapsed < fastest))
+      fastest = elapsed;
+    total += elapsed;
+    result.iterations += batch;
+    ++batches;
+  }
+  result.iterations *= testCase.messages;
+  result.meanNanoseconds = 1e9 * total / result.iterations;
+  result.minNanoseconds = 1e9 * fastest / (batch * testCase.messages);
+  return result;
+}
+
+/* returns the throughput in MiB per second, based on the mean time */
+double throughput(const Result& result)
+{
+  if (result.meanNanoseconds <= 0.0)
+    return 0.0;
+  return (result.size / (1024.0 * 1024.0)) / (result.meanNanoseconds * 1e-9);
+}
+
+/* escapes a string for JSON output, the names never need more than this */
+std::string quoted(const std::string& text)
+{
+  return "\"" + text + "\"";
+}
+
+enum class Format { Table, CSV, JSON };
+
+void printHeader(const Format format)
+{
+  switch (format)
+  {
+    case Format::Table:
+         std::cout << std::left << std::setw(10) << "algorithm" << std::setw(15) << "path"
+                   << std::setw(9) << "impl" << std::right << std::setw(12) << "bytes"
+                   << std::setw(12) << "iterations" << std::setw(16) << "mean ns"
+                   << std::setw(16) << "min ns" << std::setw(12) << "MiB/s" << "\n";
+         break;
+    case Format::CSV:
+         std::cout << "algorithm,path,implementation,size_bytes,iterations,mean_ns,min_ns,mib_per_s\n";
+         break;
+    case Format::JSON:
+         std::cout << "{\"benchmark\": \"hash\", \"results\": [";
+         break;
+  }//swi
+}
+
+void printResult(const Format format, const Result& result, const bool first)
+{
+  const Case& c = *result.testCase;
+  switch (format)
+  {
+    case Format::Table:
+         std::cout << std::left << std::setw(10) << c.algorithm << std::setw(15) << c.path
+                   << std::setw(9) << c.implementation << std::right << std::setw(12) << result.size
+                   << std::setw(12) << result.iterations << std::fixed << std::setprecision(1)
+                   << std::setw(16) << result.meanNanoseconds << std::setw(16) << result.minNanoseconds
+                   << std::setw(12) << throughput(result) << "\n";
+         break;
+    case Format::CSV:
+         std::cout << c.algorithm << ',' << c.path << ',' << c.implementation << ',' << result.size
+                   << ',' << result.iterations << std::fixed << std::setprecision(1)
+                   << ',' << result.meanNanoseconds << ',' << result.minNanoseconds
+                   << ',' << throughput(result) << "\n";
+         break;
+    case Format::JSON:
+         std::cout << (first ? "\n" : ",\n") << "  {\"algorithm\": " << quoted(c.algorithm)
+                   << ", \"path\": " << quoted(c.path) << ", \"implementation\": " << quoted(c.implementation)
+                   << ", \"size_bytes\": " << result.size << ", \"iterations\": " << result.iterations
+                   << std::fixed << std::setprecision(1)
+                   << ", \"mean_ns\": " << result.meanNanoseconds << ", \"min_ns\": " << result.minNanoseconds
+                   << ", \"mib_per_s\": " << throughput(result) << "}";
+         break;
+  }//swi
+  std::cout.flush();
+}
+
+/* parses a size with an optional suffix K, M or G (powers of 1024) */
+bool parseSize(const std::string& text, std::size_t& size)
+{
+  char* end = nullptr;
+  const unsigned long long value = std::strtoull(text.c_str(), &end, 10);
+  if (end == text.c_str())
+    return false;
+  const std::string suffix(end);
+  unsigned int shift = 0;
+  if ((suffix == "K") || (suffix == "k"))
+    shift = 10;
+  else if ((suffix == "M") || (suffix == "m"))
+    shift = 20;
+  else if ((suffix == "G") || (suffix == "g"))
+    shift = 30;
+  else if (!suffix.empty())
+    return false;
+  size = static_cast<std::size_t>(value) << shift;
+  return true;
+}
+
+void showHelp()
+{
+  std::cout << "benchmark_hash [OPTIONS]\n"
+            << "\n"
+            << "Measures throughput and latency of the hash functions.\n"
+            << "\n"
+            << "options:\n"
+            << "  --format FORMAT      output format: table (default), csv or json\n"
+            << "  --max-size SIZE      largest message size, e.g. 64M (default: 1G)\n"
+            << "  --min-time SECONDS   minimum time per measurement (default: 0.2)\n"
+            << "  --filter TEXT        only measure algorithms whose name contains TEXT\n"
+            << "  --no-files           skip the cases that hash a file\n"
+            << "  -h, --help           show this help and exit\n";
+}
+
+int main(int argc, char** argv)
+{
+  Format format = Format::Table;
+  std::size_t maxSize = std::size_t(1) << 30;
+  double minSeconds = 0.2;
+  std::string filter;
+  bool useFiles = true;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string param(argv[i]);
+    const bool hasValue = (i + 1 < argc);
+    if ((param == "--help") || (param == "-h"))
+    {
+      showHelp();
+      return 0;
+    }
+    else if ((param == "--format") && hasValue)
+    {
+      const std::string value(argv[++i]);
+      if (value == "table")
+        format = Format::Table;
+      else if (value == "csv")
+        format = Format::CSV;
+      else if (value == "json")
+        format = Format::JSON;
+      else
+      {
+        std::cerr << "Error: Unknown format " << value << ".\n";
+        return 2;
+      }
+    }
+    else if ((param == "--max-size") && hasValue)
+    {
+      if (!parseSize(argv[++i], maxSize))
+      {
+        std::cerr << "Error: " << argv[i] << " is no valid size.\n";
+        return 2;
+      }
+    }
+    else if ((param == "--min-time") && hasValue)
+    {
+      minSeconds = std::atof(argv[++i]);
+    }
+    else if ((param == "--filter") && hasValue)
+    {
+      filter = argv[++i];
+    }
+    else if (param == "--no-files")
+    {
+      useFiles = false;
+    }
+    else
+    {
+      std::cerr << "Error: Invalid parameter " << param << ".\n";
+      return 2;
+    }
+  }
+
+  // sizes 0, 64, 1 KiB, 16 KiB, 256 KiB, ... - each 16 times the previous
+  std::vector<std::size_t> sizes = { 0 };
+  for (std::size_t size = 64; size <= maxSize; size *= 16)
+  {
+    sizes.push_back(size);
+  }
+  std::vector<uint8_t> data(sizes.back());
+  uint32_t x = 0x2545F491;
+  for (uint8_t& byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+  if (useFiles && !libstriezel::filesystem::file::createTemp(fileName))
+  {
+    std::cerr << "Error: Could not create a temporary file.\n";
+    return 1;
+  }
+
+  const DefaultImplementations defaults;
+  const std::vector<Case> cases = createCases();
+  printHeader(format);
+  bool first = true;
+  for (const std::size_t size : sizes)
+  {
+    if (useFiles)
+    {
+      // The file stays in the page cache, so this measures the hashing.
+      std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      stream.write(reinterpret_cast<const char*>(data.data()), size);
+      stream.close();
+    }
+    for (const Case& c : cases)
+    {
+      if ((c.usesFile && !useFiles) || (size > c.maxSize)
+          || (c.algorithm.find(filter) == std::string::npos))
+        continue;
+      defaults.restore();
+      if (!c.select())
+        continue;
+      printResult(format, measure(c, data.data(), size, minSeconds), first);
+      first = false;
+    }
+  }
+  if (format == Format::JSON)
+    std::cout << "\n]}\n";
+  defaults.restore();
+  if (useFiles)
+    libstriezel::filesystem::file::remove(fileName);
+  return 0;
+}
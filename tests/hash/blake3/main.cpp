@@ -0,0 +1,195 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../hash/blake3/BufferSourceUtility.hpp"
+#include "../../../hash/blake3/FileSourceUtility.hpp"
+#include "../../../hash/blake3/Hasher.hpp"
+#include "../../../hash/blake3/compression.hpp"
+
+/* Checks BLAKE3 against the official test vectors, whose input consists of
+   the bytes 0, 1, ..., 250, 0, 1, ... repeated up to the given length. Longer
+   inputs that were hashed with the reference implementation are added to
+   cover the parallel tree hashing. */
+
+struct TestVector
+{
+  std::size_t length;
+  std::string digest;
+};
+
+const std::vector<TestVector> vectors = {
+    { 0, "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262" },
+    { 1, "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213" },
+    { 63, "e9bc37a594daad83be9470df7f7b3798297c3d834ce80ba85d6e207627b7db7b" },
+    { 64, "4eed7141ea4a5cd4b788606bd23f46e212af9cacebacdc7d1f4c6dc7f2511b98" },
+    { 65, "de1e5fa0be70df6d2be8fffd0e99ceaa8eb6e8c93a63f2d8d1c30ecb6b263dee" },
+    { 1023, "10108970eeda3eb932baac1428c7a2163b0e924c9a9e25b35bba72b28f70bd11" },
+    { 1024, "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7" },
+    { 1025, "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444" },
+    { 2048, "e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a" },
+    { 2049, "5f4d72f40d7a5f82b15ca2b2e44b1de3c2ef86c426c95c1af0b6879522563030" },
+    { 3072, "b98cb0ff3623be03326b373de6b9095218513e64f1ee2edd2525c7ad1e5cffd2" },
+    { 3073, "7124b49501012f81cc7f11ca069ec9226cecb8a2c850cfe644e327d22d3e1cd3" },
+    { 4096, "015094013f57a5277b59d8475c0501042c0b642e531b0a1c8f58d2163229e969" },
+    { 4097, "9b4052b38f1c5fc8b1f9ff7ac7b27cd242487b3d890d15c96a1c25b8aa0fb995" },
+    { 5120, "9cadc15fed8b5d854562b26a9536d9707cadeda9b143978f319ab34230535833" },
+    { 5121, "628bd2cb2004694adaab7bbd778a25df25c47b9d4155a55f8fbd79f2fe154cff" },
+    { 6144, "3e2e5b74e048f3add6d21faab3f83aa44d3b2278afb83b80b3c35164ebeca205" },
+    { 6145, "f1323a8631446cc50536a9f705ee5cb619424d46887f3c376c695b70e0f0507f" },
+    { 7168, "61da957ec2499a95d6b8023e2b0e604ec7f6b50e80a9678b89d2628e99ada77a" },
+    { 7169, "a003fc7a51754a9b3c7fae0367ab3d782dccf28855a03d435f8cfe74605e7817" },
+    { 8192, "aae792484c8efe4f19e2ca7d371d8c467ffb10748d8a5a1ae579948f718a2a63" },
+    { 8193, "bab6c09cb8ce8cf459261398d2e7aef35700bf488116ceb94a36d0f5f1b7bc3b" },
+    { 16384, "f875d6646de28985646f34ee13be9a576fd515f76b5b0a26bb324735041ddde4" },
+    { 31744, "62b6960e1a44bcc1eb1a611a8d6235b6b4b78f32e7abc4fb4c6cdcce94895c47" },
+    { 102400, "bc3e3d41a1146b069abffad3c0d44860cf664390afce4d9661f7902e7943e085" },
+    { 65536, "68d647e619a930e7b1082f74f334b0c65a315725569bdc123f0ee11881717bfe" },
+    { 65537, "7c99f9840a73dfcb6e5bfe4ff6d1558acab7e015640790c26411818bdbe17eca" },
+    { 201608, "8c895f29dc2a973b311a5b5437d101d9e441435801d6215b63281ba58543d6cb" },
+    { 1048576, "74cb441fd087764ca9c3694da742ebe30cbeb3060a17009ca81825c7a8d10343" },
+    { 4195081, "7a89dbee8e55aec48d1bdf1cb12805f904dc7e790a4954bc6bf929d4c3062fe0" }
+};
+
+/* returns the test input of the given length */
+std::vector<uint8_t> testInput(const std::size_t length)
+{
+  std::vector<uint8_t> input(length);
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    input[i] = static_cast<uint8_t>(i % 251);
+  }
+  return input;
+}
+
+/* checks a computed digest and prints an error message on mismatch */
+bool check(const std::string& what, const TestVector& vector, const BLAKE3::MessageDigest& digest)
+{
+  if (digest.toHexString() == vector.digest)
+    return true;
+  std::cerr << "Error: " << what << " of " << vector.length << " bytes failed.\n"
+            << "Expected: " << vector.digest << "\n"
+            << "Computed: " << digest.toHexString() << "\n";
+  return false;
+}
+
+/* checks all ways to compute the digest with the current implementation */
+bool checkVectors()
+{
+  for (const TestVector& vector : vectors)
+  {
+    const std::vector<uint8_t> input = testInput(vector.length);
+    BLAKE3::Hasher hasher;
+    hasher.update(input.data(), input.size());
+    if (!check("Hasher", vector, hasher.finalize()))
+      return false;
+    // pieces of odd sizes, which end within blocks and chunks
+    const std::size_t pieceSizes[] = { 1, 63, 1000, 3000 };
+    for (const std::size_t pieceSize : pieceSizes)
+    {
+      for (std::size_t offset = 0; offset < input.size(); offset += pieceSize)
+      {
+        hasher.update(input.data() + offset, std::min(pieceSize, input.size() - offset));
+      }
+      if (hasher.length() != input.size())
+      {
+        std::cerr << "Error: Hasher::length() returned " << hasher.length()
+                  << " instead of " << input.size() << ".\n";
+        return false;
+      }
+      if (!check("Hashing in pieces of " + std::to_string(pieceSize) + " bytes", vector, hasher.finalize()))
+        return false;
+    }
+    if (!check("computeFromBuffer()", vector, BLAKE3::computeFromBuffer(input.data(), 8 * input.size())))
+      return false;
+    const unsigned int threadCounts[] = { 1, 3, 0 };
+    for (const unsigned int threads : threadCounts)
+    {
+      if (!check("computeFromBufferParallel() with " + std::to_string(threads) + " threads", vector,
+                 BLAKE3::computeFromBufferParallel(input.data(), input.size(), threads)))
+        return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  // hex round trip
+  BLAKE3::MessageDigest digest;
+  if (!digest.isNull() || !BLAKE3::isValidHash(vectors[0].digest)
+      || !digest.fromHexString(vectors[0].digest) || (digest.toHexString() != vectors[0].digest)
+      || BLAKE3::isValidHash("af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f326")
+      || BLAKE3::isValidHash("AF1349B9F5F9A1A6A0404DEA36DCC9499BCB25C9ADC112B7CC9A93CAE41F3262"))
+  {
+    std::cerr << "Error: Conversion from or to hexadecimal string failed!\n";
+    return 1;
+  }
+
+  const BLAKE3::Implementation implementations[] = {
+    BLAKE3::Implementation::Scalar, BLAKE3::Implementation::SSE41,
+    BLAKE3::Implementation::AVX2, BLAKE3::Implementation::AVX512
+  };
+  for (const BLAKE3::Implementation impl : implementations)
+  {
+    if (!BLAKE3::setImplementation(impl))
+    {
+      std::cout << "Info: Implementation " << static_cast<int>(impl)
+                << " is not supported on this machine, skipping it.\n";
+      continue;
+    }
+    if (BLAKE3::getImplementation() != impl)
+    {
+      std::cerr << "Error: Implementation was not changed!\n";
+      return 1;
+    }
+    if (!checkVectors())
+    {
+      std::cerr << "Implementation " << static_cast<int>(impl) << " failed.\n";
+      return 1;
+    }
+  }
+
+  // files, mapped in parallel or read sequentially if empty
+  const std::string fileName = "blake3_test_file.bin";
+  for (const std::size_t index : { std::size_t(0), vectors.size() - 1 })
+  {
+    const std::vector<uint8_t> input = testInput(vectors[index].length);
+    std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    stream.write(reinterpret_cast<const char*>(input.data()), input.size());
+    stream.close();
+    const bool success = check("computeFromFile()", vectors[index], BLAKE3::computeFromFile(fileName));
+    std::remove(fileName.c_str());
+    if (!success)
+      return 1;
+  }
+  if (!BLAKE3::computeFromFile("does-not-exist.bin").isNull())
+  {
+    std::cerr << "Error: Digest of a missing file is not null!\n";
+    return 1;
+  }
+
+  std::cout << "Passed test!\n";
+  return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <array>
+#include <iostream>
+#include <string>
+#include "../../../hash/sha1/Hasher.hpp"
+#include "../../../hash/sha1/compile_time.hpp"
+#include "../../../hash/sha256/Hasher.hpp"
+#include "../../../hash/sha256/compile_time.hpp"
+
+/* Checks the constexpr implementations of SHA-1 and SHA-256 against known
+   digests at compile time and against the runtime implementations. */
+
+template<typename Digest, std::size_t N>
+constexpr bool hasWords(const Digest& digest, const uint32_t (&words)[N])
+{
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    if (digest.hash[i] != words[i])
+      return false;
+  }
+  return true;
+}
+
+// These are evaluated by the compiler, the test does not build if they fail.
+constexpr uint32_t sha1Abc[5] = { 0xa9993e36, 0x4706816a, 0xba3e2571, 0x7850c26c, 0x9cd0d89d };
+static_assert(hasWords(SHA1::computeConstexpr("abc"), sha1Abc));
+constexpr uint32_t sha1Empty[5] = { 0xda39a3ee, 0x5e6b4b0d, 0x3255bfef, 0x95601890, 0xafd80709 };
+static_assert(hasWords(SHA1::computeConstexpr(""), sha1Empty));
+constexpr uint32_t sha1TwoBlocks[5] = { 0x84983e44, 0x1c3bd26e, 0xbaae4aa1, 0xf95129e5, 0xe54670f1 };
+static_assert(hasWords(SHA1::computeConstexpr("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"), sha1TwoBlocks));
+
+constexpr uint32_t sha256Abc[8] = {
+  0xba7816bf, 0x8f01cfea, 0x414140de, 0x5dae2223, 0xb00361a3, 0x96177a9c, 0xb410ff61, 0xf20015ad
+};
+static_assert(hasWords(SHA256::computeConstexpr("abc"), sha256Abc));
+constexpr std::array<uint8_t, 3> abcBytes = { 0x61, 0x62, 0x63 };
+static_assert(hasWords(SHA256::computeConstexpr(abcBytes), sha256Abc));
+constexpr uint32_t sha256TwoBlocks[8] = {
+  0x248d6a61, 0xd20638b8, 0xe5c02693, 0x0c3e6039, 0xa33ce459, 0x64ff2167, 0xf6ecedd4, 0x19db06c1
+};
+static_assert(hasWords(SHA256::computeConstexpr("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"), sha256TwoBlocks));
+
+// digest of a constant that is usable like any other digest at runtime
+constexpr SHA256::MessageDigest embeddedDigest = SHA256::computeConstexpr("libstriezel");
+
+int main()
+{
+  // every length around the block boundaries, evaluated at runtime
+  std::string message;
+  for (unsigned int length = 0; length <= 200; ++length)
+  {
+    SHA1::Hasher sha1;
+    sha1.update(message.data(), message.size());
+    if (SHA1::computeConstexpr(message) != sha1.finalize())
+    {
+      std::cerr << "Error: SHA-1 digest for length " << length << " does not match.\n";
+      return 1;
+    }
+    SHA256::Hasher sha256;
+    sha256.update(message.data(), message.size());
+    if (SHA256::computeConstexpr(message) != sha256.finalize())
+    {
+      std::cerr << "Error: SHA-256 digest for length " << length << " does not match.\n";
+      return 1;
+    }
+    message.push_back(static_cast<char>('a' + (length * 7) % 26));
+  }
+
+  SHA256::Hasher hasher;
+  hasher.update("libstriezel", 11);
+  if (embeddedDigest != hasher.finalize())
+  {
+    std::cerr << "Error: Embedded digest " << embeddedDigest.toHexString()
+              << " does not match runtime digest.\n";
+    return 1;
+  }
+
+  std::cout << "Passed test!\n";
+  return 0;
+}
@@ -0,0 +1,214 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+#include "../../../hash/ContentChunker.hpp"
+#include "../../../hash/sha256/Hasher.hpp"
+
+/* returns pseudo-random test data of the given length */
+std::vector<uint8_t> testInput(const std::size_t length, uint64_t seed)
+{
+  std::vector<uint8_t> input(length);
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    input[i] = static_cast<uint8_t>(seed >> 32);
+  }
+  return input;
+}
+
+/* checks that the chunks cover the data, respect the size limits and have
+   the message digests of their data */
+bool checkChunks(const std::vector<uint8_t>& input, const std::vector<libstriezel::hash::Chunk>& chunks,
+                 const libstriezel::hash::ChunkParameters& params)
+{
+  uint64_t offset = 0;
+  for (std::size_t i = 0; i < chunks.size(); ++i)
+  {
+    const libstriezel::hash::Chunk& chunk = chunks[i];
+    if (chunk.offset != offset)
+    {
+      std::cerr << "Error: Chunk " << i << " starts at " << chunk.offset
+                << " instead of " << offset << ".\n";
+      return false;
+    }
+    if ((chunk.length > params.maxSize) || (chunk.length == 0)
+        || ((chunk.length < params.minSize) && (i + 1 != chunks.size())))
+    {
+      std::cerr << "Error: Chunk " << i << " has a length of " << chunk.length << " bytes.\n";
+      return false;
+    }
+    SHA256::Hasher hasher;
+    hasher.update(input.data() + chunk.offset, chunk.length);
+    if (hasher.finalize() != chunk.digest)
+    {
+      std::cerr << "Error: Message digest of chunk " << i << " is wrong.\n";
+      return false;
+    }
+    offset += chunk.length;
+  }
+  if (offset != input.size())
+  {
+    std::cerr << "Error: Chunks cover " << offset << " bytes instead of "
+              << input.size() << " bytes.\n";
+    return false;
+  }
+  return true;
+}
+
+/* checks whether two lists of chunks are equal */
+bool equalChunks(const std::vector<libstriezel::hash::Chunk>& a, const std::vector<libstriezel::hash::Chunk>& b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    if ((a[i].offset != b[i].offset) || (a[i].length != b[i].length) || (a[i].digest != b[i].digest))
+      return false;
+  }
+  return true;
+}
+
+int main()
+{
+  using namespace libstriezel::hash;
+
+  // invalid parameters
+  const ChunkParameters invalidParams[] = {
+    ChunkParameters(32, 8192, 65536), ChunkParameters(4096, 2048, 65536),
+    ChunkParameters(2048, 8192, 4096), ChunkParameters(2048, 6000, 65536)
+  };
+  std::vector<Chunk> chunks;
+  for (const ChunkParameters& params : invalidParams)
+  {
+    if (params.isValid() || chunkBuffer("abc", 3, chunks, params))
+    {
+      std::cerr << "Error: Invalid chunk parameters were accepted!\n";
+      return 1;
+    }
+  }
+
+  // empty and short data
+  if (!chunkBuffer("", 0, chunks) || !chunks.empty())
+  {
+    std::cerr << "Error: Empty data was not split into zero chunks!\n";
+    return 1;
+  }
+  const std::vector<uint8_t> shortInput = testInput(1000, 42);
+  if (!chunkBuffer(shortInput.data(), shortInput.size(), chunks) || (chunks.size() != 1)
+      || !checkChunks(shortInput, chunks, ChunkParameters()))
+  {
+    std::cerr << "Error: Data below the minimum size was not one chunk!\n";
+    return 1;
+  }
+
+  // results are the same for any number of threads
+  const std::vector<uint8_t> input = testInput(3 * 1024 * 1024 + 17, 0x0123456789ABCDEFULL);
+  const ChunkParameters parameterSets[] = {
+    ChunkParameters(), ChunkParameters(64, 256, 1024), ChunkParameters(16384, 16384, 16384)
+  };
+  for (const ChunkParameters& params : parameterSets)
+  {
+    std::vector<Chunk> reference;
+    if (!chunkBuffer(input.data(), input.size(), reference, params, 1)
+        || !checkChunks(input, reference, params))
+    {
+      std::cerr << "Error: Chunking with one thread failed!\n";
+      return 1;
+    }
+    for (const unsigned int threads : { 3u, 0u })
+    {
+      if (!chunkBuffer(input.data(), input.size(), chunks, params, threads)
+          || !equalChunks(reference, chunks))
+      {
+        std::cerr << "Error: Chunking with " << threads << " threads gives other chunks!\n";
+        return 1;
+      }
+    }
+  }
+
+  // chunk sizes are close to the average
+  std::vector<Chunk> original;
+  chunkBuffer(input.data(), input.size(), original);
+  const std::size_t average = input.size() / original.size();
+  if ((average < 6 * 1024) || (average > 12 * 1024))
+  {
+    std::cerr << "Error: Average chunk size is " << average << " bytes.\n";
+    return 1;
+  }
+
+  // An insertion near the start only changes the chunks around it.
+  std::vector<uint8_t> modified(input);
+  modified.insert(modified.begin() + 100000, 123, 0x5A);
+  if (!chunkBuffer(modified.data(), modified.size(), chunks) || !checkChunks(modified, chunks, ChunkParameters()))
+  {
+    std::cerr << "Error: Chunking of the modified data failed!\n";
+    return 1;
+  }
+  std::set<SHA256::MessageDigest> known;
+  for (const Chunk& chunk : original)
+  {
+    known.insert(chunk.digest);
+  }
+  std::size_t shared = 0;
+  for (const Chunk& chunk : chunks)
+  {
+    shared += known.count(chunk.digest);
+  }
+  if (shared + 3 < original.size())
+  {
+    std::cerr << "Error: Only " << shared << " of " << original.size()
+              << " chunks are unchanged after an insertion.\n";
+    return 1;
+  }
+
+  // regular files are memory-mapped
+  const std::string fileName = "content_chunker_test_file.bin";
+  for (const std::vector<uint8_t>* data : { &shortInput, &input })
+  {
+    std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    stream.write(reinterpret_cast<const char*>(data->data()), data->size());
+    stream.close();
+    std::vector<Chunk> expected;
+    chunkBuffer(data->data(), data->size(), expected);
+    const bool success = chunkFile(fileName, chunks) && equalChunks(expected, chunks);
+    std::remove(fileName.c_str());
+    if (!success)
+    {
+      std::cerr << "Error: Chunking of a file failed!\n";
+      return 1;
+    }
+  }
+  if (chunkFile("does-not-exist.bin", chunks))
+  {
+    std::cerr << "Error: Missing file was chunked!\n";
+    return 1;
+  }
+
+  std::cout << "Passed test!\n";
+  return 0;
+}
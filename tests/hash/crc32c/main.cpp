@@ -0,0 +1,152 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../hash/crc32c/FileSourceUtility.hpp"
+#include "../../../hash/crc32c/crc32c.hpp"
+
+/* Checks CRC-32C against values of a bitwise reference implementation. The
+   input consists of the bytes 0, 1, ..., 250, 0, 1, ... repeated up to the
+   given length. The longer inputs cover both stream lengths of the PCLMUL
+   implementation. */
+
+struct TestVector
+{
+  std::size_t length;
+  uint32_t crc;
+};
+
+const std::vector<TestVector> vectors = {
+    { 0, 0x00000000 },
+    { 1, 0x527D5351 },
+    { 32, 0x46DD794E },
+    { 1000, 0x11F66220 },
+    { 25000, 0x04CE7F3E },
+    { 100003, 0xCAA08A5C }
+};
+
+/* returns the test input of the given length */
+std::vector<uint8_t> testInput(const std::size_t length)
+{
+  std::vector<uint8_t> input(length);
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    input[i] = static_cast<uint8_t>(i % 251);
+  }
+  return input;
+}
+
+/* checks a computed checksum and prints an error message on mismatch */
+bool check(const std::string& what, const TestVector& vector, const uint32_t crc)
+{
+  if (crc == vector.crc)
+    return true;
+  std::cerr << "Error: " << what << " of " << vector.length << " bytes failed.\n"
+            << "Expected: " << std::hex << vector.crc << "\n"
+            << "Computed: " << crc << std::dec << "\n";
+  return false;
+}
+
+/* checks all ways to compute the checksum with the current implementation */
+bool checkVectors()
+{
+  const char* checkInput = "123456789";
+  if (CRC32C::computeFromBuffer(checkInput, strlen(checkInput)) != 0xE3069283)
+  {
+    std::cerr << "Error: Check value of CRC-32C is wrong.\n";
+    return false;
+  }
+  for (const TestVector& vector : vectors)
+  {
+    const std::vector<uint8_t> input = testInput(vector.length);
+    if (!check("computeFromBuffer()", vector, CRC32C::computeFromBuffer(input.data(), input.size())))
+      return false;
+    // pieces of odd sizes, which start at unaligned addresses
+    const std::size_t pieceSizes[] = { 1, 7, 1000, 30000 };
+    for (const std::size_t pieceSize : pieceSizes)
+    {
+      uint32_t crc = 0;
+      for (std::size_t offset = 0; offset < input.size(); offset += pieceSize)
+      {
+        crc = CRC32C::extend(crc, input.data() + offset, std::min(pieceSize, input.size() - offset));
+      }
+      if (!check("extend() in pieces of " + std::to_string(pieceSize) + " bytes", vector, crc))
+        return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  const CRC32C::Implementation implementations[] = {
+    CRC32C::Implementation::Scalar, CRC32C::Implementation::SSE42,
+    CRC32C::Implementation::PCLMUL
+  };
+  for (const CRC32C::Implementation impl : implementations)
+  {
+    if (!CRC32C::setImplementation(impl))
+    {
+      std::cout << "Info: Implementation " << static_cast<int>(impl)
+                << " is not supported on this machine, skipping it.\n";
+      continue;
+    }
+    if (CRC32C::getImplementation() != impl)
+    {
+      std::cerr << "Error: Implementation was not changed!\n";
+      return 1;
+    }
+    if (!checkVectors())
+    {
+      std::cerr << "Implementation " << static_cast<int>(impl) << " failed.\n";
+      return 1;
+    }
+  }
+
+  // files, mapped or read sequentially if empty
+  const std::string fileName = "crc32c_test_file.bin";
+  for (const std::size_t index : { std::size_t(0), vectors.size() - 1 })
+  {
+    const std::vector<uint8_t> input = testInput(vectors[index].length);
+    std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    stream.write(reinterpret_cast<const char*>(input.data()), input.size());
+    stream.close();
+    uint32_t crc = 0xFFFFFFFF;
+    const bool success = CRC32C::computeFromFile(fileName, crc)
+                      && check("computeFromFile()", vectors[index], crc);
+    std::remove(fileName.c_str());
+    if (!success)
+      return 1;
+  }
+  uint32_t crc = 0;
+  if (CRC32C::computeFromFile("does-not-exist.bin", crc))
+  {
+    std::cerr << "Error: Checksum of a missing file was computed!\n";
+    return 1;
+  }
+
+  std::cout << "Passed test!\n";
+  return 0;
+}
@@ -0,0 +1,229 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../../filesystem/directory.hpp"
+#include "../../../filesystem/file.hpp"
+#include "../../../hash/DigestCache.hpp"
+#include "../../../hash/sha1/FileSourceUtility.hpp"
+#include "../../../hash/sha256/FileSourceUtility.hpp"
+#include "../../../hash/sha512/FileSourceUtility.hpp"
+
+using libstriezel::filesystem::file;
+
+/* writes content to a file and sets its modification time into the past */
+bool writeFile(const std::string& fileName, const std::string& content, const time_t age)
+{
+  std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  stream.write(content.data(), content.size());
+  stream.close();
+  return stream.good() && file::setModificationTime(fileName, std::time(nullptr) - age);
+}
+
+/* removes the test files */
+void cleanUp(const std::vector<std::string>& fileNames)
+{
+  for (const std::string& fileName : fileNames)
+  {
+    file::remove(fileName);
+  }
+}
+
+int main()
+{
+  std::vector<std::string> fileNames(5);
+  for (std::string& fileName : fileNames)
+  {
+    if (!file::createTemp(fileName))
+    {
+      std::cout << "ERROR: Could not create temporary file!" << std::endl;
+      return 1;
+    }
+  }
+  const std::string cacheFileName = fileNames[4];
+  for (unsigned int i = 0; i < 4; ++i)
+  {
+    if (!writeFile(fileNames[i], "content of file #" + std::to_string(i), 1000))
+    {
+      std::cout << "ERROR: Could not write temporary file!" << std::endl;
+      cleanUp(fileNames);
+      return 1;
+    }
+  }
+
+  libstriezel::hash::DigestCache cache;
+  SHA256::MessageDigest sha256;
+  if (cache.lookup(fileNames[0], sha256))
+  {
+    std::cout << "ERROR: Empty cache returned a digest!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+
+  // first computation fills the cache
+  if ((cache.computeSHA256(fileNames[0]) != SHA256::computeFromFile(fileNames[0]))
+      || (cache.computeSHA1(fileNames[0]) != SHA1::computeFromFile(fileNames[0]))
+      || (cache.computeSHA512(fileNames[0]) != SHA512::computeFromFile(fileNames[0])))
+  {
+    std::cout << "ERROR: Cache computed wrong digests!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+  if ((cache.size() != 1) || !cache.lookup(fileNames[0], sha256)
+      || (sha256 != SHA256::computeFromFile(fileNames[0])))
+  {
+    std::cout << "ERROR: Digest was not cached!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+
+  // changed file invalidates the entry
+  if (!writeFile(fileNames[0], "changed content", 500) || cache.lookup(fileNames[0], sha256))
+  {
+    std::cout << "ERROR: Digest of changed file was still valid!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+  if (cache.computeSHA256(fileNames[0]) != SHA256::computeFromFile(fileNames[0]))
+  {
+    std::cout << "ERROR: Digest of changed file is wrong!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+  SHA1::MessageDigest sha1;
+  if (cache.lookup(fileNames[0], sha1))
+  {
+    std::cout << "ERROR: Old SHA-1 digest survived the change!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+
+  // recently modified files are not cached
+  if (!writeFile(fileNames[3], "very new", 0) || cache.computeSHA256(fileNames[3]).isNull()
+      || cache.lookup(fileNames[3], sha256))
+  {
+    std::cout << "ERROR: Recently modified file was cached!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+
+  // concurrent use
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&cache, &fileNames]()
+    {
+      for (unsigned int i = 0; i < 3; ++i)
+      {
+        cache.computeSHA256(fileNames[i]);
+        cache.computeSHA512(fileNames[i]);
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  if (cache.size() != 3)
+  {
+    std::cout << "ERROR: Cache has " << cache.size() << " entries instead of 3!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+
+  // save and load
+  if (!cache.save(cacheFileName))
+  {
+    std::cout << "ERROR: Could not save cache!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+  libstriezel::hash::DigestCache loaded;
+  if (!loaded.load(cacheFileName) || (loaded.size() != 3))
+  {
+    std::cout << "ERROR: Could not load cache!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    SHA512::MessageDigest sha512;
+    if (!loaded.lookup(fileNames[i], sha256) || (sha256 != SHA256::computeFromFile(fileNames[i]))
+        || !loaded.lookup(fileNames[i], sha512) || (sha512 != SHA512::computeFromFile(fileNames[i])))
+    {
+      std::cout << "ERROR: Loaded cache has wrong digests for file #" << i << "!" << std::endl;
+      cleanUp(fileNames);
+      return 1;
+    }
+  }
+
+  // truncated cache file is rejected
+  std::string content;
+  if (!file::readIntoString(cacheFileName, content) || !writeFile(cacheFileName, content.substr(0, content.size() - 1), 0))
+  {
+    std::cout << "ERROR: Could not truncate cache file!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+  libstriezel::hash::DigestCache truncated;
+  if (truncated.load(cacheFileName) || (truncated.size() != 0))
+  {
+    std::cout << "ERROR: Truncated cache file was loaded!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+
+  // failed rename leaves no temporary file behind
+  std::string directoryName;
+  if (!libstriezel::filesystem::directory::createTemp(directoryName))
+  {
+    std::cout << "ERROR: Could not create temporary directory!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+  const bool savedOverDirectory = loaded.save(directoryName);
+  const bool tempFileLeft = file::exists(directoryName + ".tmp");
+  file::remove(directoryName + ".tmp");
+  libstriezel::filesystem::directory::remove(directoryName);
+  if (savedOverDirectory || tempFileLeft)
+  {
+    std::cout << "ERROR: Saving over a directory succeeded or left a temporary file!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+
+  // entries of deleted files are stale
+  file::remove(fileNames[1]);
+  if ((loaded.removeStaleEntries() != 1) || (loaded.size() != 2))
+  {
+    std::cout << "ERROR: Stale entry was not removed!" << std::endl;
+    cleanUp(fileNames);
+    return 1;
+  }
+
+  cleanUp(fileNames);
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
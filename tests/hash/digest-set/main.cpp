@@ -0,0 +1,369 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "../../../filesystem/directory.hpp"
+#include "../../../filesystem/file.hpp"
+#include "../../../hash/DigestSet.hpp"
+#include "../../../hash/sha1/sha1.hpp"
+#include "../../../hash/sha224/sha224.hpp"
+#include "../../../hash/sha256/sha256.hpp"
+#include "../../../hash/sha384/sha384.hpp"
+#include "../../../hash/sha512/sha512.hpp"
+
+using namespace libstriezel::hash;
+
+/* Checks the open addressing digest set and map, including persistence,
+   and the std::hash specializations of the message digest types. */
+
+uint64_t nextRandom(uint64_t& x)
+{
+  x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+  return x;
+}
+
+std::vector<SHA256::MessageDigest> randomDigests(const std::size_t count, uint64_t seed)
+{
+  std::vector<SHA256::MessageDigest> digests(count);
+  for (SHA256::MessageDigest& digest : digests)
+  {
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      digest.hash[i] = static_cast<uint32_t>(nextRandom(seed) >> 32);
+    }
+  }
+  return digests;
+}
+
+bool testSet()
+{
+  const std::vector<SHA256::MessageDigest> digests = randomDigests(100000, 42);
+  DigestSet<SHA256::MessageDigest> set;
+  for (const SHA256::MessageDigest& digest : digests)
+  {
+    if (!set.insert(digest))
+    {
+      std::cerr << "Error: Digest was not inserted.\n";
+      return false;
+    }
+  }
+  if ((set.size() != digests.size()) || (set.capacity() < set.size() / 3 * 4))
+  {
+    std::cerr << "Error: Size or capacity of set is wrong. Size: "
+              << set.size() << ", capacity: " << set.capacity() << "\n";
+    return false;
+  }
+  for (const SHA256::MessageDigest& digest : digests)
+  {
+    if (set.insert(digest) || !set.contains(digest))
+    {
+      std::cerr << "Error: Duplicate was inserted or digest is missing.\n";
+      return false;
+    }
+  }
+  for (const SHA256::MessageDigest& digest : randomDigests(1000, 43))
+  {
+    if (set.contains(digest))
+    {
+      std::cerr << "Error: Set contains a digest that was never inserted.\n";
+      return false;
+    }
+  }
+
+  // erase every second digest
+  for (std::size_t i = 0; i < digests.size(); i += 2)
+  {
+    if (!set.erase(digests[i]) || set.erase(digests[i]))
+    {
+      std::cerr << "Error: Erase of digest " << i << " failed.\n";
+      return false;
+    }
+  }
+  if (set.size() != digests.size() / 2)
+  {
+    std::cerr << "Error: Size after erase is wrong: " << set.size() << ".\n";
+    return false;
+  }
+  for (std::size_t i = 0; i < digests.size(); ++i)
+  {
+    if (set.contains(digests[i]) != (i % 2 == 1))
+    {
+      std::cerr << "Error: Wrong result for digest " << i << " after erase.\n";
+      return false;
+    }
+  }
+  std::size_t visited = 0;
+  set.forEach([&visited](const SHA256::MessageDigest&) { ++visited; });
+  if (visited != set.size())
+  {
+    std::cerr << "Error: forEach() visited " << visited << " digests.\n";
+    return false;
+  }
+
+  // null digest is stored outside of the slots
+  SHA256::MessageDigest nullDigest;
+  nullDigest.setToNull();
+  if (set.contains(nullDigest) || !set.insert(nullDigest) || set.insert(nullDigest)
+      || !set.contains(nullDigest) || (set.size() != digests.size() / 2 + 1))
+  {
+    std::cerr << "Error: Null digest is not handled correctly.\n";
+    return false;
+  }
+  if (!set.erase(nullDigest) || set.contains(nullDigest))
+  {
+    std::cerr << "Error: Null digest was not erased.\n";
+    return false;
+  }
+  set.clear();
+  if (!set.empty() || set.contains(digests[1]))
+  {
+    std::cerr << "Error: Set is not empty after clear().\n";
+    return false;
+  }
+  return true;
+}
+
+bool testMap()
+{
+  const std::vector<SHA256::MessageDigest> digests = randomDigests(5000, 7);
+  DigestMap<SHA256::MessageDigest, uint64_t> map;
+  map.reserve(digests.size());
+  const std::size_t capacity = map.capacity();
+  for (std::size_t i = 0; i < digests.size(); ++i)
+  {
+    map.insert(digests[i], i);
+  }
+  if (map.capacity() != capacity)
+  {
+    std::cerr << "Error: Map grew despite reserve().\n";
+    return false;
+  }
+  if (map.insert(digests[0], 12345) || (*map.find(digests[0]) != 0))
+  {
+    std::cerr << "Error: insert() changed an existing value.\n";
+    return false;
+  }
+  if (map.insertOrAssign(digests[0], 12345) || (*map.find(digests[0]) != 12345))
+  {
+    std::cerr << "Error: insertOrAssign() did not change the value.\n";
+    return false;
+  }
+  for (std::size_t i = 1; i < digests.size(); ++i)
+  {
+    const uint64_t* value = map.find(digests[i]);
+    if ((value == nullptr) || (*value != i))
+    {
+      std::cerr << "Error: Value of digest " << i << " is wrong.\n";
+      return false;
+    }
+  }
+  uint64_t sum = 0;
+  map.forEach([&sum](const SHA256::MessageDigest&, const uint64_t value) { sum += value; });
+  const uint64_t n = digests.size();
+  if (sum != n * (n - 1) / 2 + 12345)
+  {
+    std::cerr << "Error: forEach() returned wrong sum " << sum << ".\n";
+    return false;
+  }
+  return true;
+}
+
+bool testPersistence()
+{
+  std::string fileName;
+  if (!libstriezel::filesystem::file::createTemp(fileName))
+  {
+    std::cerr << "Error: Could not create temporary file.\n";
+    return false;
+  }
+  const std::vector<SHA256::MessageDigest> digests = randomDigests(20000, 99);
+  SHA256::MessageDigest nullDigest;
+  nullDigest.setToNull();
+  {
+    DigestMap<SHA256::MessageDigest, uint32_t> map;
+    for (std::size_t i = 0; i < digests.size(); ++i)
+    {
+      map.insert(digests[i], static_cast<uint32_t>(i));
+    }
+    map.insert(nullDigest, 777);
+    if (!map.save(fileName))
+    {
+      std::cerr << "Error: Map could not be saved.\n";
+      libstriezel::filesystem::file::remove(fileName);
+      return false;
+    }
+  }
+
+  bool success = true;
+  DigestMap<SHA256::MessageDigest, uint32_t> loaded;
+  if (!loaded.load(fileName) || !loaded.isMapped() || (loaded.size() != digests.size() + 1))
+  {
+    std::cerr << "Error: Map could not be loaded.\n";
+    success = false;
+  }
+  for (std::size_t i = 0; success && (i < digests.size()); ++i)
+  {
+    const uint32_t* value = loaded.find(digests[i]);
+    if ((value == nullptr) || (*value != i))
+    {
+      std::cerr << "Error: Loaded map has wrong value for digest " << i << ".\n";
+      success = false;
+    }
+  }
+  if (success && ((loaded.find(nullDigest) == nullptr) || (*loaded.find(nullDigest) != 777)))
+  {
+    std::cerr << "Error: Loaded map lost the null digest.\n";
+    success = false;
+  }
+  // first change copies the mapped data
+  if (success && (!loaded.erase(digests[0]) || loaded.isMapped() || loaded.contains(digests[0])
+      || !loaded.contains(digests[1])))
+  {
+    std::cerr << "Error: Loaded map could not be changed.\n";
+    success = false;
+  }
+
+  // a set of another slot size must not load the file
+  DigestSet<SHA256::MessageDigest> set;
+  if (success && set.load(fileName))
+  {
+    std::cerr << "Error: Set loaded the file of a map.\n";
+    success = false;
+  }
+  // A corrupt file without an empty slot still loads, because load() does
+  // not read the slots, but lookups and changes of the table must finish.
+  std::string content;
+  if (success && libstriezel::filesystem::file::readIntoString(fileName, content))
+  {
+    uint32_t slotSize = 0;
+    uint64_t capacity = 0;
+    memcpy(&slotSize, &content[12], sizeof(slotSize));
+    memcpy(&capacity, &content[32], sizeof(capacity));
+    const std::size_t firstSlot = content.size() - capacity * slotSize;
+    std::string full(content);
+    for (uint64_t i = 0; i < capacity; ++i)
+    {
+      char* digest = &full[firstSlot + i * slotSize];
+      if (std::all_of(digest, digest + sizeof(SHA256::MessageDigest), [](const char c) { return c == 0; }))
+        std::fill(digest, digest + sizeof(SHA256::MessageDigest), static_cast<char>(0xAB));
+    }
+    std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    stream.write(full.data(), full.size());
+    stream.close();
+    SHA256::MessageDigest absent;
+    std::fill(absent.hash, absent.hash + 8, 0x12345678);
+
+    if (!loaded.load(fileName) || !loaded.isMapped() || !loaded.contains(digests[1])
+        || loaded.contains(absent) || (loaded.find(absent) != nullptr) || loaded.erase(absent))
+    {
+      std::cerr << "Error: Lookups in a full table failed.\n";
+      success = false;
+    }
+    else if (!loaded.erase(digests[1]) || loaded.contains(digests[1]) || !loaded.contains(digests[2]))
+    {
+      std::cerr << "Error: Removal from a full table failed.\n";
+      success = false;
+    }
+    else if (!loaded.load(fileName) || !loaded.insert(absent, 5) || !loaded.contains(absent)
+        || !loaded.contains(digests[1]) || (loaded.capacity() != 2 * capacity))
+    {
+      std::cerr << "Error: Insertion into a full table failed.\n";
+      success = false;
+    }
+  }
+  // a truncated file must not load
+  if (success)
+  {
+    std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    stream.write(content.data(), content.size() - 8);
+    stream.close();
+    if (loaded.load(fileName) || !loaded.empty())
+    {
+      std::cerr << "Error: Truncated file was loaded.\n";
+      success = false;
+    }
+  }
+  // a failed rename leaves no temporary file behind
+  std::string directoryName;
+  if (success && libstriezel::filesystem::directory::createTemp(directoryName))
+  {
+    const bool saved = set.save(directoryName);
+    const bool tempFileLeft = libstriezel::filesystem::file::exists(directoryName + ".tmp");
+    libstriezel::filesystem::file::remove(directoryName + ".tmp");
+    libstriezel::filesystem::directory::remove(directoryName);
+    if (saved || tempFileLeft)
+    {
+      std::cerr << "Error: Saving over a directory succeeded or left a temporary file.\n";
+      success = false;
+    }
+  }
+  libstriezel::filesystem::file::remove(fileName);
+  return success;
+}
+
+template<typename Digest>
+bool testStdHash(const std::string& name)
+{
+  const std::size_t words = sizeof(Digest::hash) / sizeof(Digest::hash[0]);
+  uint64_t x = 12345;
+  std::vector<Digest> digests(1000);
+  for (Digest& digest : digests)
+  {
+    for (std::size_t i = 0; i < words; ++i)
+    {
+      digest.hash[i] = static_cast<decltype(digest.hash[0] + 0)>(nextRandom(x));
+    }
+  }
+  std::unordered_set<Digest> set(digests.begin(), digests.end());
+  std::unordered_set<std::size_t> hashes;
+  for (const Digest& digest : digests)
+  {
+    hashes.insert(std::hash<Digest>()(digest));
+  }
+  if ((set.size() != digests.size()) || (hashes.size() != digests.size()))
+  {
+    std::cerr << "Error: std::unordered_set of " << name << " digests has "
+              << set.size() << " entries and " << hashes.size()
+              << " distinct hashes instead of " << digests.size() << ".\n";
+    return false;
+  }
+  return true;
+}
+
+int main()
+{
+  if (!testSet() || !testMap() || !testPersistence())
+    return 1;
+  if (!testStdHash<SHA1::MessageDigest>("SHA-1")
+      || !testStdHash<SHA224::MessageDigest>("SHA-224")
+      || !testStdHash<SHA256::MessageDigest>("SHA-256")
+      || !testStdHash<SHA384::MessageDigest>("SHA-384")
+      || !testStdHash<SHA512::MessageDigest>("SHA-512"))
+    return 1;
+
+  std::cout << "Passed test!\n";
+  return 0;
+}
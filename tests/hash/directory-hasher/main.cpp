@@ -0,0 +1,291 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "../../../filesystem/directory.hpp"
+#include "../../../filesystem/file.hpp"
+#include "../../../hash/DirectoryHasher.hpp"
+#include "../../../hash/sha1/Hasher.hpp"
+#include "../../../hash/sha224/Hasher.hpp"
+#include "../../../hash/sha256/Hasher.hpp"
+#include "../../../hash/sha384/Hasher.hpp"
+#include "../../../hash/sha512/Hasher.hpp"
+
+using namespace libstriezel::hash;
+
+/* Checks that the directory hasher reports every regular file of a tree
+   exactly once and with the correct message digests. */
+
+/* a file of the test tree */
+struct TestFile
+{
+  std::string name;
+  std::size_t length;
+  uint32_t seed;
+};
+
+std::vector<uint8_t> fileContent(const TestFile& file)
+{
+  std::vector<uint8_t> data(file.length);
+  uint32_t x = file.seed;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+  return data;
+}
+
+MultiDigest expectedDigests(const std::vector<uint8_t>& data)
+{
+  MultiDigest result;
+  SHA1::Hasher sha1;
+  sha1.update(data.data(), data.size());
+  result.sha1 = sha1.finalize();
+  SHA224::Hasher sha224;
+  sha224.update(data.data(), data.size());
+  result.sha224 = sha224.finalize();
+  SHA256::Hasher sha256;
+  sha256.update(data.data(), data.size());
+  result.sha256 = sha256.finalize();
+  SHA384::Hasher sha384;
+  sha384.update(data.data(), data.size());
+  result.sha384 = sha384.finalize();
+  SHA512::Hasher sha512;
+  sha512.update(data.data(), data.size());
+  result.sha512 = sha512.finalize();
+  return result;
+}
+
+bool equal(const MultiDigest& a, const MultiDigest& b)
+{
+  return (a.sha1 == b.sha1) && (a.sha224 == b.sha224) && (a.sha256 == b.sha256)
+      && (a.sha384 == b.sha384) && (a.sha512 == b.sha512);
+}
+
+bool writeFile(const std::string& fileName, const std::vector<uint8_t>& data)
+{
+  std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+  stream.close();
+  return stream.good();
+}
+
+void removeTree(const std::string& root, const std::vector<TestFile>& files, const std::vector<std::string>& directories)
+{
+  for (const TestFile& file : files)
+  {
+    libstriezel::filesystem::file::remove(root + "/" + file.name);
+  }
+  libstriezel::filesystem::file::remove(root + "/link");
+  libstriezel::filesystem::file::remove(root + "/sub/loop");
+  for (auto iter = directories.rbegin(); iter != directories.rend(); ++iter)
+  {
+    libstriezel::filesystem::directory::remove(root + "/" + *iter);
+  }
+  libstriezel::filesystem::directory::remove(root);
+}
+
+int main()
+{
+  std::string root;
+  if (!libstriezel::filesystem::directory::createTemp(root))
+  {
+    std::cout << "ERROR: Could not create temporary directory!" << std::endl;
+    return 1;
+  }
+
+  // With the limits used below, files of less than 1 KiB are batched and
+  // files of 64 KiB or more are large.
+  const std::vector<std::string> directories = { "sub", "sub/deep", "many" };
+  std::vector<TestFile> files = {
+    { "empty", 0, 1 },
+    { "small", 100, 2 },
+    { "sub/medium", 5000, 3 },
+    { "sub/deep/large", 300000, 4 },
+    { "sub/deep/other-large", 65536, 5 }
+  };
+  for (unsigned int i = 0; i < 150; ++i)
+  {
+    files.push_back({ "many/file" + std::to_string(i), i * 7, 100 + i });
+  }
+
+  for (const std::string& dir : directories)
+  {
+    if (!libstriezel::filesystem::directory::create(root + "/" + dir))
+    {
+      std::cout << "ERROR: Could not create directory " << dir << "!" << std::endl;
+      removeTree(root, files, directories);
+      return 1;
+    }
+  }
+  for (const TestFile& file : files)
+  {
+    if (!writeFile(root + "/" + file.name, fileContent(file)))
+    {
+      std::cout << "ERROR: Could not write file " << file.name << "!" << std::endl;
+      removeTree(root, files, directories);
+      return 1;
+    }
+  }
+  // A link to a file is hashed, a link to a directory is not followed.
+  if ((symlink((root + "/small").c_str(), (root + "/link").c_str()) != 0)
+      || (symlink(root.c_str(), (root + "/sub/loop").c_str()) != 0))
+  {
+    std::cout << "ERROR: Could not create symbolic links!" << std::endl;
+    removeTree(root, files, directories);
+    return 1;
+  }
+  files.push_back({ "link", 100, 2 });
+  std::sort(files.begin(), files.end(),
+      [](const TestFile& a, const TestFile& b) { return a.name < b.name; });
+
+  const unsigned int threadCounts[] = { 1, 2, 5, 0 };
+  for (const unsigned int threads : threadCounts)
+  {
+    DirectoryHasher hasher(daAll, threads);
+    hasher.setFileSizeLimits(1024, 65536);
+    std::vector<FileDigest> results;
+    if (!hasher.hashDirectory(root, results))
+    {
+      std::cout << "ERROR: Could not hash directory with " << threads << " threads!" << std::endl;
+      removeTree(root, files, directories);
+      return 1;
+    }
+    if (results.size() != files.size())
+    {
+      std::cout << "ERROR: Got " << results.size() << " results instead of "
+                << files.size() << " with " << threads << " threads!" << std::endl;
+      removeTree(root, files, directories);
+      return 1;
+    }
+    for (std::size_t i = 0; i < files.size(); ++i)
+    {
+      if ((results[i].fileName != files[i].name) || (results[i].size != files[i].length)
+          || !results[i].success)
+      {
+        std::cout << "ERROR: Unexpected result for file " << results[i].fileName
+                  << ", expected " << files[i].name << "!" << std::endl;
+        removeTree(root, files, directories);
+        return 1;
+      }
+      if (!equal(results[i].digests, expectedDigests(fileContent(files[i]))))
+      {
+        std::cout << "ERROR: Digests of " << files[i].name << " are wrong!" << std::endl
+                  << "SHA-256: " << results[i].digests.sha256.toHexString() << std::endl;
+        removeTree(root, files, directories);
+        return 1;
+      }
+    }
+  }
+
+  // The callback runs in the calling thread and only requested digests
+  // are computed.
+  {
+    DirectoryHasher hasher(daSHA256, 3);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::size_t count = 0;
+    bool wrongThread = false;
+    bool unexpectedDigest = false;
+    hasher.hashDirectory(root + "/", [&](const FileDigest& result)
+    {
+      ++count;
+      wrongThread = wrongThread || (std::this_thread::get_id() != caller);
+      unexpectedDigest = unexpectedDigest || !result.digests.sha1.isNull()
+                      || result.digests.sha256.isNull();
+    });
+    if ((count != files.size()) || wrongThread || unexpectedDigest)
+    {
+      std::cout << "ERROR: Callback got " << count << " results, wrong thread: "
+                << wrongThread << ", unexpected digests: " << unexpectedDigest << std::endl;
+      removeTree(root, files, directories);
+      return 1;
+    }
+  }
+  removeTree(root, files, directories);
+
+  // A callback that throws while many small files are still queued must not
+  // leave workers behind, i.e. hashDirectory() has to return. Without
+  // batching every file is a task of its own, so workers take tasks all the
+  // time, and several rounds make it likely that one of them is just taking
+  // a task when the queues are dropped.
+  {
+    std::string burstRoot;
+    if (!libstriezel::filesystem::directory::createTemp(burstRoot))
+    {
+      std::cout << "ERROR: Could not create temporary directory!" << std::endl;
+      return 1;
+    }
+    std::vector<TestFile> burstFiles;
+    for (unsigned int i = 0; i < 2000; ++i)
+    {
+      burstFiles.push_back({ "file" + std::to_string(i), i % 50, 5000 + i });
+      if (!writeFile(burstRoot + "/" + burstFiles.back().name, fileContent(burstFiles.back())))
+      {
+        std::cout << "ERROR: Could not write file " << burstFiles.back().name << "!" << std::endl;
+        removeTree(burstRoot, burstFiles, std::vector<std::string>());
+        return 1;
+      }
+    }
+    for (unsigned int round = 0; round < 300; ++round)
+    {
+      DirectoryHasher burstHasher(daSHA256, 8);
+      burstHasher.setFileSizeLimits(0, 65536);
+      bool caught = false;
+      try
+      {
+        burstHasher.hashDirectory(burstRoot, [](const FileDigest&)
+        {
+          throw std::runtime_error("callback failed");
+        });
+      }
+      catch (const std::runtime_error& ex)
+      {
+        caught = true;
+      }
+      if (!caught)
+      {
+        std::cout << "ERROR: Exception of the callback was not passed on!" << std::endl;
+        removeTree(burstRoot, burstFiles, std::vector<std::string>());
+        return 1;
+      }
+    }
+    removeTree(burstRoot, burstFiles, std::vector<std::string>());
+  }
+
+  // directory that does not exist
+  DirectoryHasher hasher(daSHA1, 2);
+  std::vector<FileDigest> results;
+  if (hasher.hashDirectory(root, results) || !results.empty())
+  {
+    std::cout << "ERROR: Missing directory was hashed!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,188 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../hash/HexEncoding.hpp"
+#include "../../../hash/sha1/sha1.hpp"
+#include "../../../hash/sha224/sha224.hpp"
+#include "../../../hash/sha256/sha256.hpp"
+#include "../../../hash/sha384/sha384.hpp"
+#include "../../../hash/sha512/sha512.hpp"
+
+using namespace libstriezel::hash;
+
+/* Checks the conversion of message digests to and from hexadecimal strings
+   with all available implementations. */
+
+uint64_t nextRandom(uint64_t& x)
+{
+  x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+  return x;
+}
+
+/* straightforward reference implementation of the hexadecimal representation */
+template<typename Digest>
+std::string referenceHex(const Digest& digest)
+{
+  const std::size_t words = sizeof(digest.hash) / sizeof(digest.hash[0]);
+  std::string result;
+  char buffer[17];
+  for (std::size_t i = 0; i < words; ++i)
+  {
+    if (sizeof(digest.hash[0]) == 4)
+      std::snprintf(buffer, sizeof(buffer), "%08lx", static_cast<unsigned long>(digest.hash[i]));
+    else
+      std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(digest.hash[i]));
+    result += buffer;
+  }
+  return result;
+}
+
+template<typename Digest>
+bool testDigestType(const std::string& name, bool (*isValid)(const std::string_view),
+                    void (*toChars)(const Digest*, const std::size_t, char*),
+                    bool (*fromChars)(const char*, const std::size_t, Digest*))
+{
+  const std::size_t words = sizeof(Digest::hash) / sizeof(Digest::hash[0]);
+  uint64_t x = 0x0123456789abcdefULL;
+  std::vector<Digest> digests(100);
+  for (Digest& digest : digests)
+  {
+    for (std::size_t i = 0; i < words; ++i)
+    {
+      digest.hash[i] = static_cast<decltype(digest.hash[0] + 0)>(nextRandom(x));
+    }
+  }
+
+  for (const Digest& digest : digests)
+  {
+    const std::string hex = digest.toHexString();
+    Digest parsed;
+    if ((hex != referenceHex(digest)) || (hex.size() != Digest::hexLength)
+        || !parsed.fromHexString(hex) || (parsed != digest) || !isValid(hex))
+    {
+      std::cout << "ERROR: " << name << " round trip failed for " << referenceHex(digest)
+                << ", got " << hex << "!" << std::endl;
+      return false;
+    }
+
+    // Every position has to reject characters next to the valid ranges.
+    const char invalid[] = { '/', ':', '`', 'g', 'A', 'F', ' ', '\0', '\x80', '\xff' };
+    for (std::size_t pos = 0; pos < hex.size(); ++pos)
+    {
+      for (const char c : invalid)
+      {
+        std::string broken = hex;
+        broken[pos] = c;
+        Digest unchanged = digest;
+        if (unchanged.fromHexString(broken) || (unchanged != digest) || isValid(broken))
+        {
+          std::cout << "ERROR: " << name << " accepted character " << static_cast<int>(c)
+                    << " at position " << pos << "!" << std::endl;
+          return false;
+        }
+      }
+    }
+    Digest unused;
+    if (unused.fromHexString(hex.substr(1)) || unused.fromHexString(hex + "0")
+        || isValid(hex.substr(1)) || isValid(""))
+    {
+      std::cout << "ERROR: " << name << " accepted a string of wrong length!" << std::endl;
+      return false;
+    }
+  }
+
+  // bulk conversion
+  std::string bulk(digests.size() * Digest::hexLength, ' ');
+  toChars(digests.data(), digests.size(), &bulk[0]);
+  std::vector<Digest> parsed(digests.size());
+  if (!fromChars(bulk.data(), digests.size(), parsed.data()) || (parsed != digests))
+  {
+    std::cout << "ERROR: " << name << " bulk round trip failed!" << std::endl;
+    return false;
+  }
+  for (std::size_t i = 0; i < digests.size(); ++i)
+  {
+    if (bulk.compare(i * Digest::hexLength, Digest::hexLength, referenceHex(digests[i])) != 0)
+    {
+      std::cout << "ERROR: " << name << " bulk encoding of digest " << i << " is wrong!" << std::endl;
+      return false;
+    }
+  }
+  bulk[17 * Digest::hexLength + 3] = 'X';
+  if (fromChars(bulk.data(), digests.size(), parsed.data()) || !parsed[17].isNull()
+      || (parsed[16] != digests[16]) || (parsed[18] != digests[18]))
+  {
+    std::cout << "ERROR: " << name << " bulk decoding did not detect invalid digest!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int main()
+{
+  const HexImplementation implementations[] = { HexImplementation::Scalar, HexImplementation::SSSE3 };
+  for (const HexImplementation impl : implementations)
+  {
+    if (!setHexImplementation(impl))
+    {
+      std::cout << "Info: Hex implementation " << static_cast<int>(impl)
+                << " is not supported, skipping it." << std::endl;
+      continue;
+    }
+    if (!testDigestType<SHA1::MessageDigest>("SHA-1", SHA1::isValidHash, SHA1::toHexChars, SHA1::fromHexChars)
+        || !testDigestType<SHA224::MessageDigest>("SHA-224", SHA224::isValidHash, SHA224::toHexChars, SHA224::fromHexChars)
+        || !testDigestType<SHA256::MessageDigest>("SHA-256", SHA256::isValidHash, SHA256::toHexChars, SHA256::fromHexChars)
+        || !testDigestType<SHA384::MessageDigest>("SHA-384", SHA384::isValidHash, SHA384::toHexChars, SHA384::fromHexChars)
+        || !testDigestType<SHA512::MessageDigest>("SHA-512", SHA512::isValidHash, SHA512::toHexChars, SHA512::fromHexChars))
+    {
+      std::cout << "ERROR: Failure with implementation " << static_cast<int>(impl) << "!" << std::endl;
+      return 1;
+    }
+
+    // raw byte conversion with lengths around the vector size
+    std::vector<uint8_t> bytes(100);
+    uint64_t x = 42;
+    for (auto & byte : bytes)
+    {
+      byte = static_cast<uint8_t>(nextRandom(x) >> 56);
+    }
+    for (std::size_t length = 0; length <= bytes.size(); ++length)
+    {
+      std::string hex(2 * length, ' ');
+      encodeHex(bytes.data(), length, &hex[0]);
+      std::vector<uint8_t> decoded(length);
+      if (!decodeHex(hex.data(), length, decoded.data())
+          || !std::equal(decoded.begin(), decoded.end(), bytes.begin())
+          || !isValidHex(hex.data(), hex.size()))
+      {
+        std::cout << "ERROR: Byte round trip failed for length " << length << "!" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
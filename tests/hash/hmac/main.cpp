@@ -0,0 +1,191 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../hash/Hmac.hpp"
+
+using namespace libstriezel::hash;
+
+/* Checks HMAC, PBKDF2 and HKDF against the test vectors of RFC 2202,
+   RFC 4231, RFC 6070 and RFC 5869. */
+
+std::string toHex(const uint8_t* data, const std::size_t length)
+{
+  std::string result(2 * length, '0');
+  encodeHex(data, length, &result[0]);
+  return result;
+}
+
+template<typename HmacType>
+bool checkHmac(const std::string& name, const std::string& key, const std::string& message,
+               const std::string& expected)
+{
+  const HmacType hmac(key.data(), key.size());
+  const std::string oneShot = hmac.compute(message.data(), message.size()).toHexString();
+  // same key, message passed in pieces
+  HmacType incremental(key.data(), key.size());
+  incremental.update("garbage", 7);
+  incremental.reset();
+  for (const char c : message)
+  {
+    incremental.update(&c, 1);
+  }
+  const std::string pieces = incremental.finalize().toHexString();
+  // object is reusable after finalize()
+  incremental.update(message.data(), message.size());
+  const std::string again = incremental.finalize().toHexString();
+  if ((oneShot != expected) || (pieces != expected) || (again != expected))
+  {
+    std::cerr << "Error: " << name << " failed.\n"
+              << "Expected:    " << expected << "\n"
+              << "compute():   " << oneShot << "\n"
+              << "update():    " << pieces << "\n"
+              << "second use:  " << again << "\n";
+    return false;
+  }
+  return true;
+}
+
+template<typename HmacType>
+bool checkPbkdf2(const std::string& name, const std::string& password, const std::string& salt,
+                 const uint32_t iterations, const std::string& expected)
+{
+  std::vector<uint8_t> output(expected.size() / 2);
+  if (!pbkdf2<HmacType>(password.data(), password.size(), salt.data(), salt.size(),
+                        iterations, output.data(), output.size()))
+  {
+    std::cerr << "Error: " << name << " returned false.\n";
+    return false;
+  }
+  const std::string actual = toHex(output.data(), output.size());
+  if (actual != expected)
+  {
+    std::cerr << "Error: " << name << " failed.\nExpected: " << expected
+              << "\nActual:   " << actual << "\n";
+    return false;
+  }
+  return true;
+}
+
+bool checkHkdf(const std::string& name, const std::vector<uint8_t>& salt,
+               const std::vector<uint8_t>& ikm, const std::vector<uint8_t>& info,
+               const std::string& expectedPrk, const std::string& expectedOkm)
+{
+  const SHA256::MessageDigest prk = hkdfExtract<HmacSHA256>(salt.data(), salt.size(), ikm.data(), ikm.size());
+  std::vector<uint8_t> okm(expectedOkm.size() / 2);
+  if (!hkdf<HmacSHA256>(salt.data(), salt.size(), ikm.data(), ikm.size(),
+                        info.data(), info.size(), okm.data(), okm.size()))
+  {
+    std::cerr << "Error: " << name << " returned false.\n";
+    return false;
+  }
+  if ((prk.toHexString() != expectedPrk) || (toHex(okm.data(), okm.size()) != expectedOkm))
+  {
+    std::cerr << "Error: " << name << " failed.\nPRK: " << prk.toHexString()
+              << "\nOKM: " << toHex(okm.data(), okm.size()) << "\n";
+    return false;
+  }
+  return true;
+}
+
+int main()
+{
+  const std::string key20(20, '\x0b');
+  const std::string jefe = "Jefe";
+  const std::string jefeMessage = "what do ya want for nothing?";
+  const std::string longKeyMessage = "Test Using Larger Than Block-Size Key - Hash Key First";
+
+  // RFC 2202
+  if (!checkHmac<HmacSHA1>("HMAC-SHA1 #1", key20, "Hi There", "b617318655057264e28bc0b6fb378c8ef146be00")
+      || !checkHmac<HmacSHA1>("HMAC-SHA1 #6", std::string(80, '\xaa'), longKeyMessage, "aa4ae5e15272d00e95705637ce8a3b55ed402112"))
+    return 1;
+
+  // RFC 4231
+  if (!checkHmac<HmacSHA256>("HMAC-SHA256 #1", key20, "Hi There",
+                             "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7")
+      || !checkHmac<HmacSHA256>("HMAC-SHA256 #2", jefe, jefeMessage,
+                                "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843")
+      || !checkHmac<HmacSHA256>("HMAC-SHA256 #6", std::string(131, '\xaa'), longKeyMessage,
+                                "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54")
+      || !checkHmac<HmacSHA224>("HMAC-SHA224 #2", jefe, jefeMessage,
+                                "a30e01098bc6dbbf45690f3a7e9e6d0f8bbea2a39e6148008fd05e44")
+      || !checkHmac<HmacSHA384>("HMAC-SHA384 #2", jefe, jefeMessage,
+                                "af45d2e376484031617f78d2b58a6b1b9c7ef464f5a01b47e42ec3736322445e8e2240ca5e69e2c78b3239ecfab21649")
+      || !checkHmac<HmacSHA512>("HMAC-SHA512 #1", key20, "Hi There",
+                                "87aa7cdea5ef619d4ff0b4241a1d6cb02379f4e2ce4ec2787ad0b30545e17cde"
+                                "daa833b7d6b8a702038b274eaea3f4e4be9d914eeb61f1702e696c203a126854")
+      || !checkHmac<HmacSHA512>("HMAC-SHA512 #6", std::string(131, '\xaa'), longKeyMessage,
+                                "80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f352"
+                                "6b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598"))
+    return 1;
+
+  // RFC 6070 and additional vectors for SHA-256 and SHA-512
+  if (!checkPbkdf2<HmacSHA1>("PBKDF2-SHA1 #1", "password", "salt", 1, "0c60c80f961f0e71f3a9b524af6012062fe037a6")
+      || !checkPbkdf2<HmacSHA1>("PBKDF2-SHA1 #3", "password", "salt", 4096, "4b007901b765489abead49d926f721d065a429c1")
+      || !checkPbkdf2<HmacSHA1>("PBKDF2-SHA1 #5", "passwordPASSWORDpassword", "saltSALTsaltSALTsaltSALTsaltSALTsalt",
+                                4096, "3d2eec4fe41c849b80c8d83662c0e44a8b291a964cf2f07038")
+      || !checkPbkdf2<HmacSHA1>("PBKDF2-SHA1 #6", std::string("pass\0word", 9), std::string("sa\0lt", 5),
+                                4096, "56fa6aa75548099dcc37d7f03425e0c3")
+      || !checkPbkdf2<HmacSHA256>("PBKDF2-SHA256", "password", "salt", 4096,
+                                  "c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134a")
+      || !checkPbkdf2<HmacSHA512>("PBKDF2-SHA512", "password", "salt", 1000,
+                                  "afe6c5530785b6cc6b1c6453384731bd5ee432ee549fd42fb6695779ad8a1c5b"
+                                  "f59de69c48f774efc4007d5298f9033c0241d5ab69305e7b64eceeb8d834cfec"
+                                  "6afdec3c1c23982a121f2d4be008889378a49a0dfb104f0d2856e38f44271cda"
+                                  "f6de4341"))
+    return 1;
+  uint8_t unused[4];
+  if (pbkdf2<HmacSHA256>("a", 1, "b", 1, 0, unused, 4))
+  {
+    std::cerr << "Error: PBKDF2 accepted zero iterations.\n";
+    return 1;
+  }
+
+  // RFC 5869
+  std::vector<uint8_t> salt;
+  for (uint8_t i = 0; i <= 0x0c; ++i)
+  {
+    salt.push_back(i);
+  }
+  std::vector<uint8_t> info;
+  for (uint8_t i = 0xf0; i <= 0xf9; ++i)
+  {
+    info.push_back(i);
+  }
+  const std::vector<uint8_t> ikm(22, 0x0b);
+  if (!checkHkdf("HKDF #1", salt, ikm, info,
+                 "077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5",
+                 "3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865")
+      || !checkHkdf("HKDF #3", std::vector<uint8_t>(), ikm, std::vector<uint8_t>(),
+                    "19ef24a32c717b167f33a91d6f648bdf96596776afdb6377ac434c1c293ccb04",
+                    "8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d9d201395faa4b61a96c8"))
+    return 1;
+  std::vector<uint8_t> tooLong(255 * 32 + 1);
+  if (hkdfExpand<HmacSHA256>(ikm.data(), ikm.size(), nullptr, 0, tooLong.data(), tooLong.size()))
+  {
+    std::cerr << "Error: HKDF accepted an output length above 255 blocks.\n";
+    return 1;
+  }
+
+  std::cout << "Passed test!\n";
+  return 0;
+}
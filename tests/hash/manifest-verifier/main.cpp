@@ -0,0 +1,184 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../filesystem/directory.hpp"
+#include "../../../filesystem/file.hpp"
+#include "../../../hash/ManifestVerifier.hpp"
+#include "../../../hash/sha1/Hasher.hpp"
+#include "../../../hash/sha256/Hasher.hpp"
+#include "../../../hash/sha384/Hasher.hpp"
+#include "../../../hash/sha512/Hasher.hpp"
+
+using namespace libstriezel::hash;
+
+/* Checks parsing of checksum manifests and the verification of the listed
+   files. */
+
+bool writeFile(const std::string& fileName, const std::string& content)
+{
+  std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  stream.write(content.data(), content.size());
+  stream.close();
+  return stream.good();
+}
+
+template<typename H>
+std::string digestOf(const std::string& content)
+{
+  H hasher;
+  hasher.update(content.data(), content.size());
+  return hasher.finalize().toHexString();
+}
+
+bool checkStatus(const std::vector<VerifyStatus>& results, const std::vector<VerifyStatus>& expected, const std::string& what)
+{
+  if (results == expected)
+    return true;
+  std::cout << "ERROR: Unexpected verification results for " << what << ":";
+  for (const VerifyStatus status : results)
+  {
+    std::cout << " " << static_cast<int>(status);
+  }
+  std::cout << std::endl;
+  return false;
+}
+
+int main()
+{
+  std::string dir;
+  if (!libstriezel::filesystem::directory::createTemp(dir))
+  {
+    std::cout << "ERROR: Could not create temporary directory!" << std::endl;
+    return 1;
+  }
+  const std::vector<std::string> names = { "plain.txt", "with space.bin", "back\\slash", "other" };
+  const std::vector<std::string> contents = { "abc", std::string(5000, 'x'), "escaped", "" };
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    if (!writeFile(dir + "/" + names[i], contents[i]))
+    {
+      std::cout << "ERROR: Could not write test file!" << std::endl;
+      return 1;
+    }
+  }
+
+  const std::string manifestText =
+      digestOf<SHA256::Hasher>(contents[0]) + "  plain.txt\n"
+    + digestOf<SHA512::Hasher>(contents[1]) + " *with space.bin\r\n"
+    + "\n"
+    + "\\" + digestOf<SHA1::Hasher>(contents[2]) + "  back\\\\slash\n"
+    + "SHA384 (other) = " + digestOf<SHA384::Hasher>(contents[3]) + "\n"
+    + "this is not a manifest line\n"
+    + digestOf<SHA256::Hasher>(contents[0]).substr(1) + "  too-short\n"
+    + "SHA512 (other) = " + digestOf<SHA256::Hasher>(contents[3]) + "\n"
+    + digestOf<SHA256::Hasher>(contents[0]) + "  missing";
+  const std::string manifestFile = dir + "/manifest.sha256";
+  Manifest manifest;
+  if (!writeFile(manifestFile, manifestText) || !manifest.load(manifestFile))
+  {
+    std::cout << "ERROR: Could not load manifest!" << std::endl;
+    return 1;
+  }
+
+  // 1. parsing
+  const std::vector<ManifestEntry>& entries = manifest.entries();
+  const std::vector<std::string> expectedNames = { "plain.txt", "with space.bin", "back\\slash", "other", "missing" };
+  const std::vector<std::size_t> expectedLines = { 1, 2, 4, 5, 9 };
+  const std::vector<DigestAlgorithm> expectedAlgorithms = { daSHA256, daSHA512, daSHA1, daSHA384, daSHA256 };
+  if ((entries.size() != expectedNames.size()) || (manifest.invalidLines() != 3))
+  {
+    std::cout << "ERROR: Manifest has " << entries.size() << " entries and "
+              << manifest.invalidLines() << " invalid lines!" << std::endl;
+    return 1;
+  }
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    if ((entries[i].fileName != expectedNames[i]) || (entries[i].line != expectedLines[i])
+        || (entries[i].algorithm != expectedAlgorithms[i]))
+    {
+      std::cout << "ERROR: Entry " << i << " is \"" << entries[i].fileName
+                << "\" in line " << entries[i].line << "!" << std::endl;
+      return 1;
+    }
+  }
+
+  // 2. verification with different concurrency
+  VerifyOptions options;
+  options.baseDirectory = dir;
+  std::vector<VerifyStatus> results;
+  const std::vector<VerifyStatus> expected = { VerifyStatus::Match, VerifyStatus::Match,
+      VerifyStatus::Match, VerifyStatus::Match, VerifyStatus::ReadError };
+  for (unsigned int threads = 0; threads <= 6; ++threads)
+  {
+    options.maxConcurrentFiles = threads;
+    if (verifyManifest(manifest, options, results) || !checkStatus(results, expected, "original files"))
+    {
+      std::cout << "ERROR: Verification with " << threads << " threads failed!" << std::endl;
+      return 1;
+    }
+  }
+
+  // 3. modified file
+  writeFile(dir + "/with space.bin", std::string(5000, 'y'));
+  manifest.loadFromString(manifestText.substr(0, manifestText.rfind('\n') + 1));
+  options.maxConcurrentFiles = 3;
+  if (verifyManifest(manifest, options, results)
+      || !checkStatus(results, { VerifyStatus::Match, VerifyStatus::Mismatch,
+          VerifyStatus::Match, VerifyStatus::Match }, "modified file"))
+    return 1;
+
+  // 4. fail fast stops after the mismatch, if files are checked one by one
+  options.maxConcurrentFiles = 1;
+  options.failFast = true;
+  if (verifyManifest(manifest, options, results)
+      || !checkStatus(results, { VerifyStatus::Match, VerifyStatus::Mismatch,
+          VerifyStatus::Skipped, VerifyStatus::Skipped }, "fail fast"))
+    return 1;
+
+  // 5. everything matches again
+  writeFile(dir + "/with space.bin", contents[1]);
+  options.maxConcurrentFiles = 4;
+  if (!verifyManifest(manifest, options, results))
+  {
+    std::cout << "ERROR: Verification of restored file failed!" << std::endl;
+    return 1;
+  }
+
+  for (const std::string& name : names)
+  {
+    libstriezel::filesystem::file::remove(dir + "/" + name);
+  }
+  libstriezel::filesystem::file::remove(manifestFile);
+  libstriezel::filesystem::directory::remove(dir);
+
+  // missing manifest
+  if (manifest.load(dir + "/manifest.sha256") || !manifest.entries().empty())
+  {
+    std::cout << "ERROR: Missing manifest was loaded!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+#include "../../../filesystem/file.hpp"
+#include "../../../hash/MultiDigest.hpp"
+#include "../../../hash/sha1/Hasher.hpp"
+#include "../../../hash/sha224/Hasher.hpp"
+#include "../../../hash/sha256/Hasher.hpp"
+#include "../../../hash/sha384/Hasher.hpp"
+#include "../../../hash/sha512/Hasher.hpp"
+
+using namespace libstriezel::hash;
+
+/* Checks that the multi-digest functions produce the same message digests
+   as the single algorithms. */
+
+/* computes the expected digests for the given data */
+MultiDigest expectedDigests(const std::vector<uint8_t>& data, const std::size_t length, const unsigned int algorithms)
+{
+  MultiDigest result;
+  if ((algorithms & daSHA1) != 0)
+  {
+    SHA1::Hasher hasher;
+    hasher.update(data.data(), length);
+    result.sha1 = hasher.finalize();
+  }
+  if ((algorithms & daSHA224) != 0)
+  {
+    SHA224::Hasher hasher;
+    hasher.update(data.data(), length);
+    result.sha224 = hasher.finalize();
+  }
+  if ((algorithms & daSHA256) != 0)
+  {
+    SHA256::Hasher hasher;
+    hasher.update(data.data(), length);
+    result.sha256 = hasher.finalize();
+  }
+  if ((algorithms & daSHA384) != 0)
+  {
+    SHA384::Hasher hasher;
+    hasher.update(data.data(), length);
+    result.sha384 = hasher.finalize();
+  }
+  if ((algorithms & daSHA512) != 0)
+  {
+    SHA512::Hasher hasher;
+    hasher.update(data.data(), length);
+    result.sha512 = hasher.finalize();
+  }
+  return result;
+}
+
+bool equal(const MultiDigest& a, const MultiDigest& b)
+{
+  return (a.sha1 == b.sha1) && (a.sha224 == b.sha224) && (a.sha256 == b.sha256)
+      && (a.sha384 == b.sha384) && (a.sha512 == b.sha512);
+}
+
+bool writeFile(const std::string& fileName, const std::vector<uint8_t>& data, const std::size_t length)
+{
+  std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  stream.write(reinterpret_cast<const char*>(data.data()), length);
+  stream.close();
+  return stream.good();
+}
+
+int main()
+{
+  // pseudo-random test data
+  std::vector<uint8_t> data(1024 * 1024 + 77);
+  uint32_t x = 0xfdb97531;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  const std::vector<std::size_t> lengths = { 0, 3, 200, 4096, data.size() };
+  const std::vector<unsigned int> algorithmSets = {
+    daAll, daSHA1 | daSHA256 | daSHA512, daSHA224, daSHA384 | daSHA1, 0
+  };
+  const std::vector<unsigned int> threadCounts = { 0, 1, 2, 5 };
+
+  for (const std::size_t length : lengths)
+  {
+    for (const unsigned int algorithms : algorithmSets)
+    {
+      const MultiDigest expected = expectedDigests(data, length, algorithms);
+      for (const unsigned int threads : threadCounts)
+      {
+        const MultiDigest computed = computeFromBuffer(data.data(), length, algorithms, threads);
+        if (!equal(expected, computed))
+        {
+          std::cout << "ERROR: Digests for " << length << " bytes with algorithm"
+                    << " flags " << algorithms << " and " << threads
+                    << " thread(s) are wrong!" << std::endl;
+          return 1;
+        }
+      }
+    }
+  }
+
+  // regular file, hashed via memory mapping
+  std::string fileName;
+  if (!libstriezel::filesystem::file::createTemp(fileName))
+  {
+    std::cout << "ERROR: Could not create temporary file!" << std::endl;
+    return 1;
+  }
+  if (!writeFile(fileName, data, data.size()))
+  {
+    std::cout << "ERROR: Could not write temporary file!" << std::endl;
+    libstriezel::filesystem::file::remove(fileName);
+    return 1;
+  }
+  const MultiDigest expected = expectedDigests(data, data.size(), daAll);
+  if (!equal(expected, computeFromFile(fileName, daAll)))
+  {
+    std::cout << "ERROR: Digests of regular file are wrong!" << std::endl;
+    libstriezel::filesystem::file::remove(fileName);
+    return 1;
+  }
+  libstriezel::filesystem::file::remove(fileName);
+
+  // named pipe, hashed via reading
+  const std::string pipeName = fileName + ".fifo";
+  if (mkfifo(pipeName.c_str(), 0600) != 0)
+  {
+    std::cout << "ERROR: Could not create named pipe!" << std::endl;
+    return 1;
+  }
+  std::thread writer([&]() { writeFile(pipeName, data, data.size()); });
+  const MultiDigest fromPipe = computeFromFile(pipeName, daAll);
+  writer.join();
+  libstriezel::filesystem::file::remove(pipeName);
+  if (!equal(expected, fromPipe))
+  {
+    std::cout << "ERROR: Digests of named pipe are wrong!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../../../hash/sha1/BufferSource.hpp"
+#include "../../../hash/sha1/BufferSourceUtility.hpp"
+#include "../../../hash/sha224/BufferSource.hpp"
+#include "../../../hash/sha224/BufferSourceUtility.hpp"
+#include "../../../hash/sha256/BufferSource.hpp"
+#include "../../../hash/sha256/BufferSourceUtility.hpp"
+#include "../../../hash/sha384/BufferSource.hpp"
+#include "../../../hash/sha384/BufferSourceUtility.hpp"
+#include "../../../hash/sha512/BufferSource.hpp"
+#include "../../../hash/sha512/BufferSourceUtility.hpp"
+
+/* Checks that the one-shot hash() functions produce the same message digests
+   as the message source based computation and that neither of them needs
+   heap memory. */
+
+// number of heap allocations since program start
+std::atomic<std::size_t> allocations(0);
+
+void* operator new(std::size_t size)
+{
+  ++allocations;
+  void* ptr = std::malloc(size > 0 ? size : 1);
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+template<typename Digest, typename SourceFunction, typename HashFunction>
+bool check(const std::string& name, const std::vector<uint8_t>& data,
+           SourceFunction fromSource, HashFunction oneShot, const std::string& abcDigest)
+{
+  for (std::size_t length = 0; length <= data.size(); ++length)
+  {
+    const std::size_t before = allocations.load();
+    const Digest expected = fromSource(data.data(), length);
+    const Digest computed = oneShot(data.data(), length);
+    const std::size_t count = allocations.load() - before;
+    if (count != 0)
+    {
+      std::cout << "ERROR: Hashing " << length << " bytes with " << name
+                << " allocated heap memory " << count << " time(s)!" << std::endl;
+      return false;
+    }
+    if (computed != expected)
+    {
+      std::cout << "ERROR: " << name << " digest of " << length << " bytes "
+                << "differs from the message source based digest!" << std::endl
+                << "Expected: " << expected.toHexString() << std::endl
+                << "Computed: " << computed.toHexString() << std::endl;
+      return false;
+    }
+  }
+
+  const std::string_view message = "abc";
+  const std::string hexDigest = oneShot(message.data(), message.size()).toHexString();
+  if (hexDigest != abcDigest)
+  {
+    std::cout << "ERROR: " << name << " message digest of \"abc\" is not as expected!" << std::endl
+              << "Expected: " << abcDigest << std::endl
+              << "Computed: " << hexDigest << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int main()
+{
+  // pseudo-random test data, covers up to four SHA-512 blocks
+  std::vector<uint8_t> data(520);
+  uint32_t x = 0x13579bdf;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  const bool passed =
+      check<SHA1::MessageDigest>("SHA-1", data,
+          [](const uint8_t* d, std::size_t len) { SHA1::BufferSource source(d, len * 8); return SHA1::computeFromSource(source); },
+          [](const void* d, std::size_t len) { return SHA1::hash(d, len); },
+          "a9993e364706816aba3e25717850c26c9cd0d89d")
+   && check<SHA224::MessageDigest>("SHA-224", data,
+          [](const uint8_t* d, std::size_t len) { SHA224::BufferSource source(d, len * 8); return SHA224::computeFromSource(source); },
+          [](const void* d, std::size_t len) { return SHA224::hash(d, len); },
+          "23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7")
+   && check<SHA256::MessageDigest>("SHA-256", data,
+          [](const uint8_t* d, std::size_t len) { SHA256::BufferSource source(d, len * 8); return SHA256::computeFromSource(source); },
+          [](const void* d, std::size_t len) { return SHA256::hash(d, len); },
+          "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad")
+   && check<SHA384::MessageDigest>("SHA-384", data,
+          [](const uint8_t* d, std::size_t len) { SHA384::BufferSource source(d, len * 8); return SHA384::computeFromSource(source); },
+          [](const void* d, std::size_t len) { return SHA384::hash(d, len); },
+          "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7")
+   && check<SHA512::MessageDigest>("SHA-512", data,
+          [](const uint8_t* d, std::size_t len) { SHA512::BufferSource source(d, len * 8); return SHA512::computeFromSource(source); },
+          [](const void* d, std::size_t len) { return SHA512::hash(d, len); },
+          "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+  if (!passed)
+    return 1;
+
+  // string_view overload and const buffers
+  const std::string_view text = "The quick brown fox jumps over the lazy dog";
+  const std::size_t before = allocations.load();
+  const SHA256::MessageDigest fromView = SHA256::hash(text);
+  const uint8_t* constData = reinterpret_cast<const uint8_t*>(text.data());
+  const SHA256::MessageDigest fromBuffer = SHA256::computeFromBuffer(constData, text.size() * 8);
+  if (allocations.load() != before)
+  {
+    std::cout << "ERROR: Hashing a string view allocated heap memory!" << std::endl;
+    return 1;
+  }
+  if ((fromView != fromBuffer)
+      || (fromView.toHexString() != "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592"))
+  {
+    std::cout << "ERROR: Message digest of the string view is not as expected!" << std::endl
+              << "Computed: " << fromView.toHexString() << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#if !defined(_WIN32)
+  #include <unistd.h>
+#endif
+#include "../../../filesystem/file.hpp"
+#include "../../../hash/sha1/FileSourceUtility.hpp"
+#include "../../../hash/sha1/ReadAheadUtility.hpp"
+#include "../../../hash/sha224/FileSourceUtility.hpp"
+#include "../../../hash/sha224/ReadAheadUtility.hpp"
+#include "../../../hash/sha256/FileSourceUtility.hpp"
+#include "../../../hash/sha256/ReadAheadUtility.hpp"
+#include "../../../hash/sha384/FileSourceUtility.hpp"
+#include "../../../hash/sha384/ReadAheadUtility.hpp"
+#include "../../../hash/sha512/FileSourceUtility.hpp"
+#include "../../../hash/sha512/ReadAheadUtility.hpp"
+
+/* Checks that the read-ahead hashing produces the same message digests as
+   computeFromFile() for several read sizes and queue depths, with and
+   without the page cache. */
+
+struct Setting
+{
+  std::size_t readSize;
+  unsigned int queueDepth;
+  libstriezel::hash::CacheMode cacheMode;
+};
+
+bool writeFile(const std::string& fileName, const std::vector<uint8_t>& data, const std::size_t length)
+{
+  std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  stream.write(reinterpret_cast<const char*>(data.data()), length);
+  stream.close();
+  return stream.good();
+}
+
+template<typename Digest>
+bool check(const Digest& expected, const Digest& actual, const std::string& algorithm,
+           const std::size_t length, const Setting& setting)
+{
+  if (expected == actual)
+    return true;
+  std::cout << "ERROR: " << algorithm << " digest of " << length << " bytes "
+            << "with read size " << setting.readSize << ", queue depth "
+            << setting.queueDepth << " and cache mode " << static_cast<int>(setting.cacheMode)
+            << " is wrong!" << std::endl
+            << "Expected: " << expected.toHexString() << std::endl
+            << "Computed: " << actual.toHexString() << std::endl;
+  return false;
+}
+
+int main()
+{
+  // pseudo-random test data
+  std::vector<uint8_t> data(3 * 1024 * 1024 + 517);
+  uint32_t x = 0x13579bdf;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  std::string fileName;
+  if (!libstriezel::filesystem::file::createTemp(fileName))
+  {
+    std::cout << "ERROR: Could not create temporary file!" << std::endl;
+    return 1;
+  }
+
+  const std::vector<std::size_t> lengths = { 0, 1, 111, 1000, 65536, data.size() };
+  using libstriezel::hash::CacheMode;
+  const std::vector<Setting> settings = {
+    { 1, 1, CacheMode::Normal }, { 7, 2, CacheMode::Normal }, { 4096, 3, CacheMode::Normal },
+    { 100000, 8, CacheMode::Normal },
+    { libstriezel::hash::ReadAheadReader::defaultReadSize, libstriezel::hash::ReadAheadReader::defaultQueueDepth, CacheMode::Normal },
+    // read sizes are rounded up to the alignment when bypassing the cache
+    { 7, 2, CacheMode::Bypass }, { 100000, 3, CacheMode::Bypass },
+    { libstriezel::hash::ReadAheadReader::defaultReadSize, libstriezel::hash::ReadAheadReader::defaultQueueDepth, CacheMode::Bypass }
+  };
+  for (const std::size_t length : lengths)
+  {
+    if (!writeFile(fileName, data, length))
+    {
+      std::cout << "ERROR: Could not write temporary file!" << std::endl;
+      libstriezel::filesystem::file::remove(fileName);
+      return 1;
+    }
+    const SHA1::MessageDigest sha1 = SHA1::computeFromFile(fileName);
+    const SHA224::MessageDigest sha224 = SHA224::computeFromFile(fileName);
+    const SHA256::MessageDigest sha256 = SHA256::computeFromFile(fileName);
+    const SHA384::MessageDigest sha384 = SHA384::computeFromFile(fileName);
+    const SHA512::MessageDigest sha512 = SHA512::computeFromFile(fileName);
+    for (const Setting& s : settings)
+    {
+      // reading byte by byte takes too long for the large file
+      if ((s.readSize < 100) && (s.cacheMode == CacheMode::Normal) && (length > 1000))
+        continue;
+      if (!check(sha1, SHA1::computeFromFileReadAhead(fileName, s.readSize, s.queueDepth, s.cacheMode), "SHA-1", length, s)
+          || !check(sha224, SHA224::computeFromFileReadAhead(fileName, s.readSize, s.queueDepth, s.cacheMode), "SHA-224", length, s)
+          || !check(sha256, SHA256::computeFromFileReadAhead(fileName, s.readSize, s.queueDepth, s.cacheMode), "SHA-256", length, s)
+          || !check(sha384, SHA384::computeFromFileReadAhead(fileName, s.readSize, s.queueDepth, s.cacheMode), "SHA-384", length, s)
+          || !check(sha512, SHA512::computeFromFileReadAhead(fileName, s.readSize, s.queueDepth, s.cacheMode), "SHA-512", length, s))
+      {
+        libstriezel::filesystem::file::remove(fileName);
+        return 1;
+      }
+    }
+  }
+  libstriezel::filesystem::file::remove(fileName);
+
+  // streams and pipes, which cannot be mapped or seeked
+  const std::string text(data.begin(), data.end());
+  std::istringstream stream(text);
+  SHA256::Hasher sha256;
+  sha256.update(data.data(), data.size());
+  if (SHA256::computeFromStream(stream) != sha256.finalize())
+  {
+    std::cout << "ERROR: Digest of stream is wrong!" << std::endl;
+    return 1;
+  }
+  #if !defined(_WIN32)
+  int pipeEnds[2];
+  if (pipe(pipeEnds) != 0)
+  {
+    std::cout << "ERROR: Could not create pipe!" << std::endl;
+    return 1;
+  }
+  // The writer uses odd piece sizes, so the reader gets short reads.
+  std::thread writer([&data, &pipeEnds]()
+  {
+    std::size_t offset = 0;
+    while (offset < data.size())
+    {
+      const ssize_t written = write(pipeEnds[1], data.data() + offset, std::min<std::size_t>(12345, data.size() - offset));
+      if (written <= 0)
+        break;
+      offset += static_cast<std::size_t>(written);
+    }
+    close(pipeEnds[1]);
+  });
+  const SHA512::MessageDigest pipeDigest = SHA512::computeFromDescriptor(pipeEnds[0]);
+  writer.join();
+  close(pipeEnds[0]);
+  SHA512::Hasher sha512;
+  sha512.update(data.data(), data.size());
+  if (pipeDigest != sha512.finalize())
+  {
+    std::cout << "ERROR: Digest of pipe is wrong!" << std::endl;
+    return 1;
+  }
+  #endif
+  if (!SHA1::computeFromDescriptor(-1).isNull())
+  {
+    std::cout << "ERROR: Digest of invalid descriptor is not the null digest!" << std::endl;
+    return 1;
+  }
+
+  // file that does not exist
+  if (!SHA256::computeFromFileReadAhead(fileName).isNull()
+      || !SHA256::computeFromFileReadAhead(fileName, 4096, 2, CacheMode::Bypass).isNull())
+  {
+    std::cout << "ERROR: Digest of missing file is not the null digest!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>
+#include "../../../../hash/sha256/sha256.hpp"
+#include "../../../../hash/sha256/BatchUtility.hpp"
+#include "../../../../hash/sha256/BufferSourceUtility.hpp"
+
+/*
+  The batch results are compared with the known digests from the other SHA-256
+  tests and with the results of computeFromBuffer() for messages of many
+  different lengths.
+*/
+
+const std::vector<std::pair<std::string, std::string> > tests =
+{
+  {"abc",
+   "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+  {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+   "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+  {"",
+   "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+  {std::string(1000, 'A'),
+   "c2e686823489ced2017f6059b8b239318b6364f6dcd835d0a519105a1eadd6e4"},
+  {std::string(1005, 'U'),
+   "f4d62ddec0f3dd90ea1380fa16a5ff8dc4c54b21740650f24afc4120903552b0"}
+};
+
+const std::vector<std::pair<SHA256::BatchImplementation, std::string> > implementations =
+{
+  { SHA256::BatchImplementation::Sequential, "sequential" },
+  { SHA256::BatchImplementation::SSE41, "SSE 4.1" },
+  { SHA256::BatchImplementation::AVX2, "AVX2" },
+  { SHA256::BatchImplementation::AVX512, "AVX-512" }
+};
+
+int main()
+{
+  // pseudo-random messages with lengths from 0 to 300 bytes and a few longer
+  std::vector<uint8_t> data(5000);
+  uint32_t x = 0xcafe;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+  std::vector<SHA256::BatchMessage> messages;
+  std::vector<std::string> expected;
+  for (std::size_t len = 0; len <= 300; ++len)
+  {
+    messages.push_back({ data.data() + len, len });
+  }
+  messages.push_back({ data.data(), 4096 });
+  messages.push_back({ data.data() + 3, 4999 - 3 });
+  for (const auto& msg : messages)
+  {
+    expected.push_back(SHA256::computeFromBuffer(const_cast<uint8_t*>(msg.data), msg.length * 8).toHexString());
+  }
+  for (const auto& item : tests)
+  {
+    messages.push_back({ reinterpret_cast<const uint8_t*>(item.first.c_str()), item.first.size() });
+    expected.push_back(item.second);
+  }
+
+  for (const auto& impl : implementations)
+  {
+    if (!SHA256::isSupported(impl.first))
+    {
+      std::cout << "Info: Implementation " << impl.second
+                << " is not supported on this machine, skipping it." << std::endl;
+      continue;
+    }
+    if (!SHA256::setBatchImplementation(impl.first))
+    {
+      std::cout << "ERROR: Could not activate implementation " << impl.second
+                << "!" << std::endl;
+      return 1;
+    }
+    std::cout << "Checking implementation " << impl.second << "..." << std::endl;
+    const std::vector<SHA256::MessageDigest> digests = SHA256::computeFromBuffers(messages);
+    if (digests.size() != messages.size())
+    {
+      std::cout << "ERROR: Number of digests does not match number of messages!" << std::endl;
+      return 1;
+    }
+    for (std::size_t i = 0; i < digests.size(); ++i)
+    {
+      if (digests[i].toHexString() != expected[i])
+      {
+        std::cout << "ERROR: Message digest of message #" << i << " ("
+                  << messages[i].length << " bytes) is not as expected!" << std::endl
+                  << "Expected digest:   " << expected[i] << std::endl
+                  << "Calculated digest: " << digests[i].toHexString() << std::endl;
+        return 1;
+      }
+    }
+    // a single message and an empty batch work, too
+    const std::vector<SHA256::BatchMessage> single(1, messages.back());
+    if (SHA256::computeFromBuffers(single).at(0).toHexString() != expected.back())
+    {
+      std::cout << "ERROR: Message digest of single message is not as expected!" << std::endl;
+      return 1;
+    }
+    if (!SHA256::computeFromBuffers(std::vector<SHA256::BatchMessage>()).empty())
+    {
+      std::cout << "ERROR: Empty batch does not return empty result!" << std::endl;
+      return 1;
+    }
+  }
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
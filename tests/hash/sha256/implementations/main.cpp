@@ -0,0 +1,111 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../../hash/sha256/sha256.hpp"
+#include "../../../../hash/sha256/BufferSourceUtility.hpp"
+#include "../../../../hash/sha256/compression.hpp"
+
+/* Checks that every supported implementation of the compression function
+   produces the same results as the scalar implementation. */
+
+const std::vector<std::pair<SHA256::Implementation, std::string> > implementations =
+{
+  { SHA256::Implementation::Scalar, "scalar" },
+  { SHA256::Implementation::SHANI, "SHA extensions" }
+};
+
+int main()
+{
+  // pseudo-random test data
+  std::vector<uint8_t> data(64 * 37);
+  uint32_t x = 0x12345678;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  // reference values from the scalar implementation
+  SHA256::setImplementation(SHA256::Implementation::Scalar);
+  std::vector<std::vector<uint32_t> > expected;
+  for (std::size_t blocks = 1; blocks <= 37; ++blocks)
+  {
+    SHA256::MessageDigest md;
+    md.hash[0] = 0x6a09e667;
+    SHA256::compressBlocks(md.hash, data.data(), blocks);
+    expected.push_back(std::vector<uint32_t>(md.hash, md.hash + 8));
+  }
+
+  for (const auto& impl : implementations)
+  {
+    if (!SHA256::isSupported(impl.first))
+    {
+      std::cout << "Info: Implementation " << impl.second
+                << " is not supported on this machine, skipping it." << std::endl;
+      continue;
+    }
+    if (!SHA256::setImplementation(impl.first))
+    {
+      std::cout << "ERROR: Could not activate implementation " << impl.second
+                << "!" << std::endl;
+      return 1;
+    }
+    std::cout << "Checking implementation " << impl.second << "..." << std::endl;
+    for (std::size_t blocks = 1; blocks <= 37; ++blocks)
+    {
+      // multiple blocks at once
+      SHA256::MessageDigest md;
+      md.hash[0] = 0x6a09e667;
+      SHA256::compressBlocks(md.hash, data.data(), blocks);
+      // single blocks, already converted to host byte order
+      SHA256::MessageDigest md_single;
+      md_single.hash[0] = 0x6a09e667;
+      for (std::size_t i = 0; i < blocks; ++i)
+      {
+        SHA256::MessageBlock block;
+        std::memcpy(block.words, &data[64 * i], 64);
+        block.reverseBlock();
+        SHA256::compressBlock(md_single.hash, block);
+      }
+      if (!std::equal(md.hash, md.hash + 8, expected[blocks - 1].begin())
+          || md != md_single)
+      {
+        std::cout << "ERROR: Result for " << blocks << " block(s) differs "
+                  << "from scalar implementation!" << std::endl;
+        return 1;
+      }
+    }
+    const std::string message = "abc";
+    const SHA256::MessageDigest md_abc = SHA256::computeFromBuffer(
+                reinterpret_cast<uint8_t*>(const_cast<char*>(message.c_str())),
+                message.size() * 8);
+    if (md_abc.toHexString() != "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad")
+    {
+      std::cout << "ERROR: Message digest of \"abc\" is not as expected!" << std::endl;
+      return 1;
+    }
+  }
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
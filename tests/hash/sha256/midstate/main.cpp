@@ -0,0 +1,172 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../../filesystem/file.hpp"
+#include "../../../../hash/sha256/BufferSourceUtility.hpp"
+#include "../../../../hash/sha256/FileSourceUtility.hpp"
+#include "../../../../hash/sha256/Hasher.hpp"
+
+/* Checks that hashing can be resumed from an exported midstate, both for
+   the Hasher class and for files that grow over time. */
+
+bool appendFile(const std::string& fileName, const std::vector<uint8_t>& data, const std::size_t offset, const std::size_t length)
+{
+  std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+  stream.write(reinterpret_cast<const char*>(data.data() + offset), length);
+  stream.close();
+  return stream.good();
+}
+
+int main()
+{
+  const std::size_t blockSize = 64;
+
+  // pseudo-random test data
+  std::vector<uint8_t> data(5000);
+  uint32_t x = 0x13579bdf;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  // 1. Hasher: export after some data, import into another hasher
+  for (std::size_t split = 0; split <= 300; split += 7)
+  {
+    SHA256::Hasher first;
+    first.update(data.data(), split);
+    const SHA256::Hasher::Midstate midstate = first.exportMidstate();
+    if ((midstate.length % blockSize != 0) || (midstate.length > split) || (split - midstate.length >= blockSize))
+    {
+      std::cout << "ERROR: Midstate after " << split << " bytes has length "
+                << midstate.length << "!" << std::endl;
+      return 1;
+    }
+    SHA256::Hasher second;
+    if (!second.importMidstate(midstate))
+    {
+      std::cout << "ERROR: Could not import midstate!" << std::endl;
+      return 1;
+    }
+    second.update(data.data() + midstate.length, 300 - midstate.length);
+    const SHA256::MessageDigest expected = SHA256::computeFromBuffer(data.data(), 300 * 8);
+    const SHA256::MessageDigest resumed = second.finalize();
+    if (resumed != expected)
+    {
+      std::cout << "ERROR: Resumed digest after split at " << split << " is wrong!"
+                << std::endl << "Expected: " << expected.toHexString()
+                << std::endl << "Resumed:  " << resumed.toHexString()
+                << std::endl;
+      return 1;
+    }
+  }
+
+  // 2. text form of the midstate
+  {
+    SHA256::Hasher hasher;
+    hasher.update(data.data(), 1000);
+    const SHA256::Hasher::Midstate midstate = hasher.exportMidstate();
+    const std::string text = midstate.toHexString();
+    SHA256::Hasher::Midstate parsed;
+    if ((text.size() != 8 * 8 + 16) || !parsed.fromHexString(text)
+        || (parsed.toHexString() != text) || (parsed.length != midstate.length))
+    {
+      std::cout << "ERROR: Midstate " << text << " does not survive the round trip!" << std::endl;
+      return 1;
+    }
+    // length is not a multiple of the block size
+    std::string badLength = text;
+    badLength[badLength.size() - 1] = '1';
+    // invalid character
+    std::string badCharacter = text;
+    badCharacter[3] = 'x';
+    if (parsed.fromHexString(badLength) || parsed.fromHexString(badCharacter)
+        || parsed.fromHexString(text.substr(1)))
+    {
+      std::cout << "ERROR: Invalid midstate text was accepted!" << std::endl;
+      return 1;
+    }
+    SHA256::Hasher::Midstate unaligned = midstate;
+    unaligned.length += 3;
+    if (hasher.importMidstate(unaligned))
+    {
+      std::cout << "ERROR: Midstate with incomplete block was imported!" << std::endl;
+      return 1;
+    }
+  }
+
+  // 3. file that grows, hashing resumes at the last checkpoint
+  std::string fileName;
+  if (!libstriezel::filesystem::file::createTemp(fileName))
+  {
+    std::cout << "ERROR: Could not create temporary file!" << std::endl;
+    return 1;
+  }
+  SHA256::Hasher::Midstate checkpoint = SHA256::Hasher().exportMidstate();
+  std::size_t fileSize = 0;
+  const std::size_t appendSizes[] = { 0, 1, 63, 64, 65, 200, 1000, 1, 3606 };
+  for (const std::size_t appended : appendSizes)
+  {
+    if (!appendFile(fileName, data, fileSize, appended))
+    {
+      std::cout << "ERROR: Could not write temporary file!" << std::endl;
+      libstriezel::filesystem::file::remove(fileName);
+      return 1;
+    }
+    fileSize += appended;
+    const SHA256::Hasher::Midstate resumeFrom = checkpoint;
+    const SHA256::MessageDigest resumed = SHA256::computeFromFile(fileName, resumeFrom, checkpoint);
+    const SHA256::MessageDigest expected = SHA256::computeFromFile(fileName);
+    if ((resumed != expected) || expected.isNull())
+    {
+      std::cout << "ERROR: Resumed digest for file with " << fileSize << " bytes is wrong!"
+                << std::endl << "Expected: " << expected.toHexString()
+                << std::endl << "Resumed:  " << resumed.toHexString()
+                << std::endl;
+      libstriezel::filesystem::file::remove(fileName);
+      return 1;
+    }
+    if (checkpoint.length != fileSize - fileSize % blockSize)
+    {
+      std::cout << "ERROR: Checkpoint for file with " << fileSize
+                << " bytes has length " << checkpoint.length << "!" << std::endl;
+      libstriezel::filesystem::file::remove(fileName);
+      return 1;
+    }
+  }
+
+  // 4. checkpoint beyond the end of the file
+  SHA256::Hasher::Midstate unused;
+  checkpoint.length += 2 * blockSize;
+  if (!SHA256::computeFromFile(fileName, checkpoint, unused).isNull())
+  {
+    std::cout << "ERROR: Checkpoint beyond end of file was accepted!" << std::endl;
+    libstriezel::filesystem::file::remove(fileName);
+    return 1;
+  }
+  libstriezel::filesystem::file::remove(fileName);
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
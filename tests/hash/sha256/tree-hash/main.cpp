@@ -0,0 +1,147 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../../filesystem/file.hpp"
+#include "../../../../hash/sha256/TreeHash.hpp"
+
+/* Checks the SHA-256 tree hash against values that were computed with an
+   independent implementation of the documented encoding. */
+
+struct TestCase
+{
+  std::size_t length;
+  std::size_t leafSize;
+  std::string root;
+};
+
+int main()
+{
+  // pseudo-random test data
+  std::vector<uint8_t> data(5000);
+  uint32_t x = 0x0badf00d;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  const std::vector<TestCase> cases = {
+    { 0, 64, "6e340b9cffb37a989ca544e6bb780a2c78901d3fb33738768511a30617afa01d" },
+    { 1, 64, "57de14353cddaf79d153b36121937a66cd3dc16722ade6e4b5ecf39d3f0cf2cd" },
+    { 64, 64, "c96ae1500ac37f8feb670ab613c9a7b0eaa3296a7fcf96e4d3144045513c0b4e" },
+    { 100, 64, "87b520e6706d179968bcc7549e788089ac3325983b546014b8df140d20299cbd" },
+    { 1000, 64, "72d5a4cecf86b1deccede26d0fda9ad0774d08bdc2b7d046c2013ad083f0f635" },
+    { 5000, 64, "d36ca542af0bb0b2a5748c20a62bbb51928643ff244ef72adb12bd7b7468f97c" },
+    { 5000, 1000, "a31af1cf95a675f2c045327538b861b68b378b832043842e1b63f198d3081211" },
+    { 5000, 7, "cc54b9c7ad68cddb0c0a4b09456061ee839fe3998259f77771d290654b84bbc9" }
+  };
+
+  for (const TestCase& tc : cases)
+  {
+    for (const unsigned int threads : { 1u, 3u, 0u })
+    {
+      const SHA256::MessageDigest root = SHA256::computeTreeHashFromBuffer(data.data(), tc.length, tc.leafSize, threads);
+      if (root.toHexString() != tc.root)
+      {
+        std::cout << "ERROR: Tree hash of " << tc.length << " bytes with leaf size "
+                  << tc.leafSize << " and " << threads << " thread(s) is wrong!" << std::endl
+                  << "Expected: " << tc.root << std::endl
+                  << "Computed: " << root.toHexString() << std::endl;
+        return 1;
+      }
+    }
+    if (SHA256::leafCount(tc.length, tc.leafSize) != SHA256::computeLeafHashes(data.data(), tc.length, tc.leafSize).size())
+    {
+      std::cout << "ERROR: leafCount() does not match the number of leaf hashes!" << std::endl;
+      return 1;
+    }
+  }
+
+  // file-based computation
+  std::string fileName;
+  if (!libstriezel::filesystem::file::createTemp(fileName))
+  {
+    std::cout << "ERROR: Could not create temporary file!" << std::endl;
+    return 1;
+  }
+  {
+    std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+  }
+  const SHA256::MessageDigest fileRoot = SHA256::computeTreeHashFromFile(fileName, 64, 2);
+  libstriezel::filesystem::file::remove(fileName);
+  if (fileRoot.toHexString() != cases[5].root)
+  {
+    std::cout << "ERROR: Tree hash of file is wrong!" << std::endl
+              << "Expected: " << cases[5].root << std::endl
+              << "Computed: " << fileRoot.toHexString() << std::endl;
+    return 1;
+  }
+
+  // verification of leaf ranges
+  const std::vector<SHA256::MessageDigest> leaves = SHA256::computeLeafHashes(data.data(), data.size(), 64);
+  const SHA256::MessageDigest root = SHA256::computeRoot(leaves);
+  if (!SHA256::verifyLeafRange(&data[64 * 10], 64 * 5, 10, 64, leaves, root))
+  {
+    std::cout << "ERROR: Valid leaf range was not verified!" << std::endl;
+    return 1;
+  }
+  // last leaf of the input, 5000 % 64 = 8 bytes
+  if (!SHA256::verifyLeafRange(&data[64 * 78], 8, 78, 64, leaves, root))
+  {
+    std::cout << "ERROR: Valid last leaf was not verified!" << std::endl;
+    return 1;
+  }
+  // incomplete leaf in the middle
+  if (SHA256::verifyLeafRange(&data[64 * 10], 64 * 5 - 1, 10, 64, leaves, root))
+  {
+    std::cout << "ERROR: Incomplete leaf range was verified!" << std::endl;
+    return 1;
+  }
+  // wrong leaf index
+  if (SHA256::verifyLeafRange(&data[64 * 10], 64 * 5, 11, 64, leaves, root))
+  {
+    std::cout << "ERROR: Leaf range with wrong index was verified!" << std::endl;
+    return 1;
+  }
+  // modified data
+  std::vector<uint8_t> modified(data.begin() + 64 * 10, data.begin() + 64 * 15);
+  modified[100] ^= 0x01;
+  if (SHA256::verifyLeafRange(modified.data(), modified.size(), 10, 64, leaves, root))
+  {
+    std::cout << "ERROR: Modified leaf range was verified!" << std::endl;
+    return 1;
+  }
+  // wrong root
+  SHA256::MessageDigest wrongRoot = root;
+  wrongRoot.hash[3] ^= 0x100;
+  if (SHA256::verifyLeafRange(&data[64 * 10], 64 * 5, 10, 64, leaves, wrongRoot))
+  {
+    std::cout << "ERROR: Leaf range was verified against wrong root!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../../hash/sha384/BufferSource.hpp"
+#include "../../../../hash/sha384/Hasher.hpp"
+
+/* Checks that the incremental hasher produces the same message digests as
+   the message source based computation, no matter how the data is split. */
+
+int main()
+{
+  // pseudo-random test data
+  std::vector<uint8_t> data(1000);
+  uint32_t x = 0x87654321;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  const std::vector<std::size_t> pieceSizes = { 1, 3, 55, 56, 63, 64, 65, 111, 112, 127, 128, 129, 500 };
+  SHA384::Hasher hasher;
+  for (std::size_t length = 0; length <= data.size(); ++length)
+  {
+    SHA384::BufferSource source(data.data(), length * 8);
+    const SHA384::MessageDigest expected = SHA384::computeFromSource(source);
+
+    // whole data at once
+    hasher.update(data.data(), length);
+    if (hasher.length() != length)
+    {
+      std::cout << "ERROR: Hasher reports wrong length " << hasher.length()
+                << " instead of " << length << "!" << std::endl;
+      return 1;
+    }
+    if (hasher.finalize() != expected)
+    {
+      std::cout << "ERROR: Digest of " << length << " bytes in one piece "
+                << "differs from the expected value!" << std::endl;
+      return 1;
+    }
+
+    // data in pieces of various sizes, reusing the finalized hasher
+    for (const std::size_t pieceSize : pieceSizes)
+    {
+      for (std::size_t offset = 0; offset < length; offset += pieceSize)
+      {
+        hasher.update(&data[offset], std::min(pieceSize, length - offset));
+      }
+      if (hasher.finalize() != expected)
+      {
+        std::cout << "ERROR: Digest of " << length << " bytes in pieces of "
+                  << pieceSize << " bytes differs from the expected value!"
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  // known test vector
+  const std::string message = "abc";
+  hasher.update("a", 1);
+  hasher.reset();
+  hasher.update(message.c_str(), message.size());
+  const std::string hexDigest = hasher.finalize().toHexString();
+  if (hexDigest != "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7")
+  {
+    std::cout << "ERROR: Message digest of \"abc\" is not as expected!" << std::endl
+              << "Expected: cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7" << std::endl
+              << "Computed: " << hexDigest << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../../hash/sha512/BufferSource.hpp"
+#include "../../../../hash/sha512/Hasher.hpp"
+
+/* Checks that the incremental hasher produces the same message digests as
+   the message source based computation, no matter how the data is split. */
+
+int main()
+{
+  // pseudo-random test data
+  std::vector<uint8_t> data(1000);
+  uint32_t x = 0x87654321;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  const std::vector<std::size_t> pieceSizes = { 1, 3, 55, 56, 63, 64, 65, 111, 112, 127, 128, 129, 500 };
+  SHA512::Hasher hasher;
+  for (std::size_t length = 0; length <= data.size(); ++length)
+  {
+    SHA512::BufferSource source(data.data(), length * 8);
+    const SHA512::MessageDigest expected = SHA512::computeFromSource(source);
+
+    // whole data at once
+    hasher.update(data.data(), length);
+    if (hasher.length() != length)
+    {
+      std::cout << "ERROR: Hasher reports wrong length " << hasher.length()
+                << " instead of " << length << "!" << std::endl;
+      return 1;
+    }
+    if (hasher.finalize() != expected)
+    {
+      std::cout << "ERROR: Digest of " << length << " bytes in one piece "
+                << "differs from the expected value!" << std::endl;
+      return 1;
+    }
+
+    // data in pieces of various sizes, reusing the finalized hasher
+    for (const std::size_t pieceSize : pieceSizes)
+    {
+      for (std::size_t offset = 0; offset < length; offset += pieceSize)
+      {
+        hasher.update(&data[offset], std::min(pieceSize, length - offset));
+      }
+      if (hasher.finalize() != expected)
+      {
+        std::cout << "ERROR: Digest of " << length << " bytes in pieces of "
+                  << pieceSize << " bytes differs from the expected value!"
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  // known test vector
+  const std::string message = "abc";
+  hasher.update("a", 1);
+  hasher.reset();
+  hasher.update(message.c_str(), message.size());
+  const std::string hexDigest = hasher.finalize().toHexString();
+  if (hexDigest != "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f")
+  {
+    std::cout << "ERROR: Message digest of \"abc\" is not as expected!" << std::endl
+              << "Expected: ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f" << std::endl
+              << "Computed: " << hexDigest << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../../hash/sha512/sha512.hpp"
+#include "../../../../hash/sha512/BufferSourceUtility.hpp"
+#include "../../../../hash/sha512/compression.hpp"
+
+/* Checks that every supported implementation of the compression function
+   produces the same results as the scalar implementation. */
+
+const std::vector<std::pair<SHA512::Implementation, std::string> > implementations =
+{
+  { SHA512::Implementation::Scalar, "scalar" },
+  { SHA512::Implementation::AVX2, "AVX2" },
+  { SHA512::Implementation::AVX512, "AVX-512" }
+};
+
+int main()
+{
+  // pseudo-random test data
+  std::vector<uint8_t> data(128 * 37);
+  uint32_t x = 0x12345678;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  // reference values from the scalar implementation
+  SHA512::setImplementation(SHA512::Implementation::Scalar);
+  std::vector<std::vector<uint64_t> > expected;
+  for (std::size_t blocks = 1; blocks <= 37; ++blocks)
+  {
+    SHA512::MessageDigest md;
+    md.hash[0] = 0x6a09e667f3bcc908;
+    SHA512::compressBlocks(md.hash, data.data(), blocks);
+    expected.push_back(std::vector<uint64_t>(md.hash, md.hash + 8));
+  }
+
+  for (const auto& impl : implementations)
+  {
+    if (!SHA512::isSupported(impl.first))
+    {
+      std::cout << "Info: Implementation " << impl.second
+                << " is not supported on this machine, skipping it." << std::endl;
+      continue;
+    }
+    if (!SHA512::setImplementation(impl.first))
+    {
+      std::cout << "ERROR: Could not activate implementation " << impl.second
+                << "!" << std::endl;
+      return 1;
+    }
+    std::cout << "Checking implementation " << impl.second << "..." << std::endl;
+    for (std::size_t blocks = 1; blocks <= 37; ++blocks)
+    {
+      // multiple blocks at once
+      SHA512::MessageDigest md;
+      md.hash[0] = 0x6a09e667f3bcc908;
+      SHA512::compressBlocks(md.hash, data.data(), blocks);
+      // single blocks, already converted to host byte order
+      SHA512::MessageDigest md_single;
+      md_single.hash[0] = 0x6a09e667f3bcc908;
+      for (std::size_t i = 0; i < blocks; ++i)
+      {
+        SHA512::MessageBlock block;
+        std::memcpy(block.words, &data[128 * i], 128);
+        block.reverseBlock();
+        SHA512::compressBlock(md_single.hash, block);
+      }
+      if (!std::equal(md.hash, md.hash + 8, expected[blocks - 1].begin())
+          || md != md_single)
+      {
+        std::cout << "ERROR: Result for " << blocks << " block(s) differs "
+                  << "from scalar implementation!" << std::endl;
+        return 1;
+      }
+    }
+    const std::string message = "abc";
+    const SHA512::MessageDigest md_abc = SHA512::computeFromBuffer(
+                reinterpret_cast<uint8_t*>(const_cast<char*>(message.c_str())),
+                message.size() * 8);
+    if (md_abc.toHexString() != "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+                               "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f")
+    {
+      std::cout << "ERROR: Message digest of \"abc\" is not as expected!" << std::endl;
+      return 1;
+    }
+  }
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
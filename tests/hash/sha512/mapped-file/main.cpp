@@ -0,0 +1,108 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../../filesystem/file.hpp"
+#include "../../../../hash/sha512/FileSource.hpp"
+#include "../../../../hash/sha512/FileSourceUtility.hpp"
+#include "../../../../hash/sha512/MappedFileSource.hpp"
+
+/* Checks that the memory-mapped file source produces the same message
+   digests as the stream-based file source. */
+
+bool writeFile(const std::string& fileName, const std::vector<uint8_t>& data, const std::size_t length)
+{
+  std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  stream.write(reinterpret_cast<const char*>(data.data()), length);
+  stream.close();
+  return stream.good();
+}
+
+int main()
+{
+  // pseudo-random test data
+  std::vector<uint8_t> data(1100);
+  uint32_t x = 0x2468ace0;
+  for (auto & byte : data)
+  {
+    x = x * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+
+  std::string fileName;
+  if (!libstriezel::filesystem::file::createTemp(fileName))
+  {
+    std::cout << "ERROR: Could not create temporary file!" << std::endl;
+    return 1;
+  }
+
+  for (std::size_t length = 0; length <= data.size(); ++length)
+  {
+    if (!writeFile(fileName, data, length))
+    {
+      std::cout << "ERROR: Could not write temporary file!" << std::endl;
+      libstriezel::filesystem::file::remove(fileName);
+      return 1;
+    }
+    SHA512::FileSource streamSource;
+    SHA512::MappedFileSource mappedSource;
+    if (!streamSource.open(fileName) || !mappedSource.open(fileName))
+    {
+      std::cout << "ERROR: Could not open temporary file!" << std::endl;
+      libstriezel::filesystem::file::remove(fileName);
+      return 1;
+    }
+    if (mappedSource.size() != length)
+    {
+      std::cout << "ERROR: Mapped file has size " << mappedSource.size()
+                << " instead of " << length << "!" << std::endl;
+      libstriezel::filesystem::file::remove(fileName);
+      return 1;
+    }
+    const SHA512::MessageDigest expected = SHA512::computeFromSource(streamSource);
+    const SHA512::MessageDigest mapped = SHA512::computeFromSource(mappedSource);
+    const SHA512::MessageDigest fromFile = SHA512::computeFromFile(fileName);
+    if ((mapped != expected) || (fromFile != expected))
+    {
+      std::cout << "ERROR: Digests for file with " << length << " bytes differ!"
+                << std::endl << "Stream source: " << expected.toHexString()
+                << std::endl << "Mapped source: " << mapped.toHexString()
+                << std::endl << "computeFromFile(): " << fromFile.toHexString()
+                << std::endl;
+      libstriezel::filesystem::file::remove(fileName);
+      return 1;
+    }
+  }
+  libstriezel::filesystem::file::remove(fileName);
+
+  // directories cannot be mapped
+  SHA512::MappedFileSource directorySource;
+  if (directorySource.open("."))
+  {
+    std::cout << "ERROR: Directory could be opened as mapped file!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
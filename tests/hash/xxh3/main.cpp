@@ -0,0 +1,206 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../../hash/xxh3/BufferSourceUtility.hpp"
+#include "../../../hash/xxh3/FileSourceUtility.hpp"
+#include "../../../hash/xxh3/Hasher.hpp"
+#include "../../../hash/xxh3/accumulate.hpp"
+
+/* Checks XXH3 against values of xxHash 0.8. The input consists of the bytes
+   0, 1, ..., 250, 0, 1, ... repeated up to the given length. The lengths
+   cover each of the short input paths as well as full and partial blocks. */
+
+struct TestVector
+{
+  std::size_t length;
+  uint64_t seed;
+  uint64_t hash64;
+  std::string hash128;
+};
+
+const std::vector<TestVector> vectors = {
+    { 0, 0x0ULL, 0x2d06800538d394c2ULL, "99aa06d3014798d86001c324468d497f" },
+    { 1, 0x0ULL, 0xc44bdff4074eecdbULL, "a6cd5e9392000f6ac44bdff4074eecdb" },
+    { 3, 0x0ULL, 0x5f4299fc161c9cbbULL, "e3b55f57945a17cf5f4299fc161c9cbb" },
+    { 4, 0x0ULL, 0x60dab036a58211f2ULL, "eb70bf5fc779e9e6a6111d53e80a3db5" },
+    { 8, 0x0ULL, 0x3a1c2d7c85af88f8ULL, "e1e4432a62217fe4cfd50c61c8bb98c1" },
+    { 9, 0x0ULL, 0xe9612598145bb9dcULL, "16c769d83e4aebce907931979dca3746" },
+    { 16, 0x0ULL, 0x8355e3a6f61770dbULL, "72950631827607e2842812cc870dcae2" },
+    { 17, 0x0ULL, 0x9ef341a99de37328ULL, "685bc458b37d057fc06e233df7729217" },
+    { 128, 0x0ULL, 0x85c6174c7ff4c46bULL, "14792fc3af88dc6c05321a0b64d67b41" },
+    { 129, 0x0ULL, 0xec7642b431ba3e5aULL, "dd5e74ac6b45f54ebc30b63382b09a3b" },
+    { 240, 0x0ULL, 0x375a384d957fe865ULL, "65b5be86da5540e7c92b68e16f83bbb6" },
+    { 241, 0x0ULL, 0x02e8cd95421c6d02ULL, "1da1cb61bcb8a2a102e8cd95421c6d02" },
+    { 1024, 0x0ULL, 0xe5d78bafa45b2aa5ULL, "d0ac1f7b93bf57b9e5d78bafa45b2aa5" },
+    { 1025, 0x0ULL, 0xe95c42288f28186eULL, "2882ebca04ec915ce95c42288f28186e" },
+    { 1088, 0x0ULL, 0x1a848d807034c403ULL, "295519bc52981c5c1a848d807034c403" },
+    { 2049, 0x0ULL, 0x6c9600c0e506e2aeULL, "39a54bc93f74921b6c9600c0e506e2ae" },
+    { 65536, 0x0ULL, 0xaaae63800707a868ULL, "f5e7bc5d3d8675bfaaae63800707a868" },
+    { 100003, 0x0ULL, 0xacf33ba3cf61e369ULL, "b02e921ecad88f0facf33ba3cf61e369" },
+    { 0, 0x9E3779B97F4A7C15ULL, 0x602b0e2cd6662c8bULL, "d142977a2cca554b4ca5176998171787" },
+    { 1, 0x9E3779B97F4A7C15ULL, 0x062b185e4e01441aULL, "e366b8c99a31df50062b185e4e01441a" },
+    { 3, 0x9E3779B97F4A7C15ULL, 0xbe1fd1f503b5d59eULL, "bf2a55a01a4ef588be1fd1f503b5d59e" },
+    { 4, 0x9E3779B97F4A7C15ULL, 0x89878861fce0da55ULL, "2a8b9789cf496def55d8df42be2c2082" },
+    { 8, 0x9E3779B97F4A7C15ULL, 0xb82d9ef5fd6b3172ULL, "59d3dcef02ca1563549c1de02797ab53" },
+    { 9, 0x9E3779B97F4A7C15ULL, 0xfe11eeff350b91efULL, "d8398d01b57318a697967290810c979c" },
+    { 16, 0x9E3779B97F4A7C15ULL, 0x3d392960bfd9df8aULL, "5071618c2d2c17b4e463c7e2458d78d5" },
+    { 17, 0x9E3779B97F4A7C15ULL, 0x89e5f063c641de9fULL, "4edfa847c1b8df88cba03fc2363de8bc" },
+    { 128, 0x9E3779B97F4A7C15ULL, 0x77bf966868f4b200ULL, "04d3d3bfc357ddef1ea8c8dcd452ca0d" },
+    { 129, 0x9E3779B97F4A7C15ULL, 0x747f159fdd2d2177ULL, "47a798bb1fd7483f952bac83a81876ae" },
+    { 240, 0x9E3779B97F4A7C15ULL, 0xe6e766db0868c372ULL, "f0bc4cae6b4ab7eb5bd854a1231155f7" },
+    { 241, 0x9E3779B97F4A7C15ULL, 0x172114de208c5a80ULL, "aa071ba293e7f7d8172114de208c5a80" },
+    { 1024, 0x9E3779B97F4A7C15ULL, 0x19244dd37041be92ULL, "dad6f2892d33341119244dd37041be92" },
+    { 1025, 0x9E3779B97F4A7C15ULL, 0xc52f40c41d849838ULL, "466bf76d82789d57c52f40c41d849838" },
+    { 1088, 0x9E3779B97F4A7C15ULL, 0xd0df4282ced49e82ULL, "6a7e992f40cbabfdd0df4282ced49e82" },
+    { 2049, 0x9E3779B97F4A7C15ULL, 0x1a7fe50cfb617d3bULL, "ee0a5cc66f4b9e751a7fe50cfb617d3b" },
+    { 65536, 0x9E3779B97F4A7C15ULL, 0x85ca963e5412bf45ULL, "f1330ad90aa8173585ca963e5412bf45" },
+    { 100003, 0x9E3779B97F4A7C15ULL, 0x7abb1be8029285c7ULL, "a6d7c249ef44e2ed7abb1be8029285c7" },
+};
+
+/* returns the test input of the given length */
+std::vector<uint8_t> testInput(const std::size_t length)
+{
+  std::vector<uint8_t> input(length);
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    input[i] = static_cast<uint8_t>(i % 251);
+  }
+  return input;
+}
+
+/* checks computed hash values and prints an error message on mismatch */
+bool check(const std::string& what, const TestVector& vector, const uint64_t hash64, const XXH3::Hash128& hash128)
+{
+  if ((hash64 == vector.hash64) && (hash128.toHexString() == vector.hash128))
+    return true;
+  std::cerr << "Error: " << what << " of " << vector.length << " bytes with seed "
+            << vector.seed << " failed.\n"
+            << "Expected: " << std::hex << vector.hash64 << " and " << vector.hash128 << "\n"
+            << "Computed: " << hash64 << std::dec << " and " << hash128.toHexString() << "\n";
+  return false;
+}
+
+/* checks all ways to compute the hash values with the current implementation */
+bool checkVectors()
+{
+  for (const TestVector& vector : vectors)
+  {
+    const std::vector<uint8_t> input = testInput(vector.length);
+    if (!check("computeFromBuffer()", vector,
+               XXH3::computeFromBuffer64(input.data(), input.size(), vector.seed),
+               XXH3::computeFromBuffer128(input.data(), input.size(), vector.seed)))
+      return false;
+    XXH3::Hasher hasher(vector.seed);
+    hasher.update(input.data(), input.size());
+    if (!check("Hasher", vector, hasher.digest64(), hasher.digest128()))
+      return false;
+    // pieces of odd sizes, which end within stripes, blocks and the buffer
+    const std::size_t pieceSizes[] = { 1, 63, 200, 1000, 3000 };
+    for (const std::size_t pieceSize : pieceSizes)
+    {
+      hasher.reset();
+      for (std::size_t offset = 0; offset < input.size(); offset += pieceSize)
+      {
+        hasher.update(input.data() + offset, std::min(pieceSize, input.size() - offset));
+      }
+      if (hasher.length() != input.size())
+      {
+        std::cerr << "Error: Hasher::length() returned " << hasher.length()
+                  << " instead of " << input.size() << ".\n";
+        return false;
+      }
+      if (!check("Hashing in pieces of " + std::to_string(pieceSize) + " bytes", vector,
+                 hasher.digest64(), hasher.digest128()))
+        return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  // hex round trip
+  XXH3::Hash128 hash;
+  if (!hash.isNull() || !hash.fromHexString(vectors[0].hash128)
+      || (hash.toHexString() != vectors[0].hash128)
+      || hash.fromHexString("99aa06d3014798d86001c324468d497")
+      || hash.fromHexString("99AA06D3014798D86001C324468D497F"))
+  {
+    std::cerr << "Error: Conversion from or to hexadecimal string failed!\n";
+    return 1;
+  }
+
+  const XXH3::Implementation implementations[] = {
+    XXH3::Implementation::Scalar, XXH3::Implementation::SSE2,
+    XXH3::Implementation::AVX2, XXH3::Implementation::AVX512
+  };
+  for (const XXH3::Implementation impl : implementations)
+  {
+    if (!XXH3::setImplementation(impl))
+    {
+      std::cout << "Info: Implementation " << static_cast<int>(impl)
+                << " is not supported on this machine, skipping it.\n";
+      continue;
+    }
+    if (XXH3::getImplementation() != impl)
+    {
+      std::cerr << "Error: Implementation was not changed!\n";
+      return 1;
+    }
+    if (!checkVectors())
+    {
+      std::cerr << "Implementation " << static_cast<int>(impl) << " failed.\n";
+      return 1;
+    }
+  }
+
+  // files, mapped or read sequentially if empty
+  const std::string fileName = "xxh3_test_file.bin";
+  for (const std::size_t index : { std::size_t(0), vectors.size() - 1 })
+  {
+    const TestVector& vector = vectors[index];
+    const std::vector<uint8_t> input = testInput(vector.length);
+    std::ofstream stream(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    stream.write(reinterpret_cast<const char*>(input.data()), input.size());
+    stream.close();
+    uint64_t hash64 = 0;
+    XXH3::Hash128 hash128;
+    const bool success = XXH3::computeFromFile64(fileName, hash64, vector.seed)
+                      && XXH3::computeFromFile128(fileName, hash128, vector.seed)
+                      && check("computeFromFile()", vector, hash64, hash128);
+    std::remove(fileName.c_str());
+    if (!success)
+      return 1;
+  }
+  uint64_t hash64 = 0;
+  if (XXH3::computeFromFile64("does-not-exist.bin", hash64))
+  {
+    std::cerr << "Error: Hash of a missing file was computed!\n";
+    return 1;
+  }
+
+  std::cout << "Passed test!\n";
+  return 0;
+}
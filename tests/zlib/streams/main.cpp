@@ -0,0 +1,271 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of a test suite for striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "../../../zlib/CompressionFunctions.hpp"
+#include "../../../zlib/Compressor.hpp"
+#include "../../../zlib/Decompressor.hpp"
+
+/* Checks that the zlib stream classes produce data that is compatible with
+   the one-shot functions, no matter how input and output are split. */
+
+using namespace libstriezel::zlib;
+
+// creates partially compressible test data of the given size
+std::vector<uint8_t> createData(const std::size_t size)
+{
+  std::vector<uint8_t> data(size);
+  uint32_t x = 0x2468ace0;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    x = x * 1664525 + 1013904223;
+    // every fourth kilobyte is random, the rest is text-like
+    data[i] = ((i / 1024) % 4 == 0) ? static_cast<uint8_t>(x >> 24)
+                                      : static_cast<uint8_t>('a' + (x >> 24) % 8);
+  }
+  return data;
+}
+
+// compresses data in pieces of the given size with an output function
+bool compressInPieces(const std::vector<uint8_t>& data, const std::size_t pieceSize, std::vector<uint8_t>& compressed)
+{
+  compressed.clear();
+  const OutputFunction append = [&compressed](const uint8_t* out, const std::size_t length)
+  {
+    compressed.insert(compressed.end(), out, out + length);
+    return true;
+  };
+  Compressor compressor(6);
+  for (std::size_t offset = 0; offset < data.size(); offset += pieceSize)
+  {
+    if (!compressor.compress(&data[offset], std::min(pieceSize, data.size() - offset), append))
+      return false;
+  }
+  if (!compressor.finish(append))
+    return false;
+  return (compressor.totalIn() == data.size()) && (compressor.totalOut() == compressed.size());
+}
+
+// decompresses data in pieces of the given size with an output function
+StreamStatus decompressInPieces(Decompressor& decompressor, const std::vector<uint8_t>& compressed,
+                                const std::size_t pieceSize, std::vector<uint8_t>& result)
+{
+  result.clear();
+  const OutputFunction append = [&result](const uint8_t* out, const std::size_t length)
+  {
+    result.insert(result.end(), out, out + length);
+    return true;
+  };
+  StreamStatus status = StreamStatus::Ok;
+  for (std::size_t offset = 0; (offset < compressed.size()) && (status == StreamStatus::Ok); offset += pieceSize)
+  {
+    status = decompressor.decompress(&compressed[offset], std::min(pieceSize, compressed.size() - offset), append);
+  }
+  return status;
+}
+
+int main()
+{
+  const std::vector<uint8_t> data = createData(3 * 1024 * 1024 + 12345);
+
+  // compression in pieces of various sizes, checked with one-shot decompress()
+  std::vector<uint8_t> compressed;
+  for (const std::size_t pieceSize : { std::size_t(1000), std::size_t(65536 * 3 + 7), data.size() })
+  {
+    if (!compressInPieces(data, pieceSize, compressed))
+    {
+      std::cout << "ERROR: Compression in pieces of " << pieceSize << " bytes failed!" << std::endl;
+      return 1;
+    }
+    std::vector<uint8_t> result(data.size());
+    if (!decompress(compressed.data(), compressed.size(), result.data(), result.size()) || (result != data))
+    {
+      std::cout << "ERROR: Data compressed in pieces of " << pieceSize << " bytes "
+                << "cannot be decompressed by decompress()!" << std::endl;
+      return 1;
+    }
+  }
+
+  // decompression in pieces of various sizes
+  for (const std::size_t pieceSize : { std::size_t(1), std::size_t(4099), compressed.size() })
+  {
+    Decompressor decompressor;
+    std::vector<uint8_t> result;
+    const StreamStatus status = decompressInPieces(decompressor, compressed, pieceSize, result);
+    if ((status != StreamStatus::Finished) || !decompressor.finished() || (result != data)
+        || (decompressor.totalIn() != compressed.size()) || (decompressor.totalOut() != data.size()))
+    {
+      std::cout << "ERROR: Decompression in pieces of " << pieceSize << " bytes failed!" << std::endl;
+      return 1;
+    }
+  }
+
+  // small caller buffers on both sides
+  {
+    const std::vector<uint8_t> small = createData(20000);
+    Compressor compressor(9);
+    std::vector<uint8_t> packed;
+    uint8_t buffer[5];
+    std::size_t offset = 0;
+    while (offset < small.size())
+    {
+      std::size_t consumed = 0;
+      std::size_t produced = 0;
+      if (!compressor.compress(&small[offset], std::min<std::size_t>(13, small.size() - offset), consumed,
+                               buffer, sizeof(buffer), produced))
+      {
+        std::cout << "ERROR: Compression into small buffers failed!" << std::endl;
+        return 1;
+      }
+      offset += consumed;
+      packed.insert(packed.end(), buffer, buffer + produced);
+    }
+    StreamStatus status = StreamStatus::Ok;
+    while (status == StreamStatus::Ok)
+    {
+      std::size_t produced = 0;
+      status = compressor.finish(buffer, sizeof(buffer), produced);
+      packed.insert(packed.end(), buffer, buffer + produced);
+    }
+    if (status != StreamStatus::Finished)
+    {
+      std::cout << "ERROR: Finishing compression into small buffers failed!" << std::endl;
+      return 1;
+    }
+
+    Decompressor decompressor;
+    std::vector<uint8_t> unpacked;
+    offset = 0;
+    status = StreamStatus::Ok;
+    while (status == StreamStatus::Ok)
+    {
+      std::size_t consumed = 0;
+      std::size_t produced = 0;
+      status = decompressor.decompress(&packed[offset], std::min<std::size_t>(3, packed.size() - offset), consumed,
+                                       buffer, sizeof(buffer), produced);
+      offset += consumed;
+      unpacked.insert(unpacked.end(), buffer, buffer + produced);
+    }
+    if ((status != StreamStatus::Finished) || (offset != packed.size()) || (unpacked != small))
+    {
+      std::cout << "ERROR: Decompression into small buffers failed!" << std::endl;
+      return 1;
+    }
+  }
+
+  // output of one-shot compress() can be decompressed by the stream
+  {
+    std::vector<uint8_t> input(data.begin(), data.begin() + 100000);
+    uint32_t compSize = 1024;
+    uint8_t* compBuffer = new uint8_t[compSize];
+    uint32_t usedSize = 0;
+    if (!compress(input.data(), input.size(), compBuffer, compSize, usedSize))
+    {
+      delete[] compBuffer;
+      std::cout << "ERROR: One-shot compression failed!" << std::endl;
+      return 1;
+    }
+    const std::vector<uint8_t> packed(compBuffer, compBuffer + usedSize);
+    delete[] compBuffer;
+    Decompressor decompressor;
+    std::vector<uint8_t> result;
+    if ((decompressInPieces(decompressor, packed, 777, result) != StreamStatus::Finished) || (result != input))
+    {
+      std::cout << "ERROR: Output of compress() cannot be decompressed by the stream!" << std::endl;
+      return 1;
+    }
+  }
+
+  // data after the end of the stream is not consumed
+  {
+    std::vector<uint8_t> trailing(compressed);
+    trailing.insert(trailing.end(), 100, 0x55);
+    Decompressor decompressor;
+    std::vector<uint8_t> result;
+    if ((decompressInPieces(decompressor, trailing, trailing.size(), result) != StreamStatus::Finished)
+        || (decompressor.totalIn() != compressed.size()) || (result != data))
+    {
+      std::cout << "ERROR: Trailing data is not handled properly!" << std::endl;
+      return 1;
+    }
+  }
+
+  // truncated data does not reach the end of the stream
+  {
+    const std::vector<uint8_t> truncated(compressed.begin(), compressed.end() - 10);
+    Decompressor decompressor;
+    std::vector<uint8_t> result;
+    if ((decompressInPieces(decompressor, truncated, 65536, result) != StreamStatus::Ok) || decompressor.finished())
+    {
+      std::cout << "ERROR: Truncated data is not detected!" << std::endl;
+      return 1;
+    }
+    // the decompressor can be reused after a reset
+    if (!decompressor.reset()
+        || (decompressInPieces(decompressor, compressed, 65536, result) != StreamStatus::Finished)
+        || (result != data))
+    {
+      std::cout << "ERROR: Decompression after reset failed!" << std::endl;
+      return 1;
+    }
+  }
+
+  // corrupt data is an error
+  {
+    std::vector<uint8_t> corrupt(compressed);
+    corrupt[0] = 0xFF;
+    Decompressor decompressor;
+    std::vector<uint8_t> result;
+    if (decompressInPieces(decompressor, corrupt, corrupt.size(), result) != StreamStatus::Error)
+    {
+      std::cout << "ERROR: Corrupt data is not detected!" << std::endl;
+      return 1;
+    }
+  }
+
+  // an output function can abort the operation
+  {
+    Decompressor decompressor;
+    const OutputFunction reject = [](const uint8_t*, const std::size_t) { return false; };
+    if (decompressor.decompress(compressed.data(), compressed.size(), reject) != StreamStatus::Error)
+    {
+      std::cout << "ERROR: Decompression was not aborted by the output function!" << std::endl;
+      return 1;
+    }
+  }
+
+  // invalid compression levels are rejected
+  try
+  {
+    Compressor compressor(42);
+    std::cout << "ERROR: Compressor accepts invalid level 42!" << std::endl;
+    return 1;
+  }
+  catch (const std::runtime_error& ex)
+  {
+    // expected
+  }
+
+  std::cout << "Passed test!" << std::endl;
+  return 0;
+}
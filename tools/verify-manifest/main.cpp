@@ -0,0 +1,148 @@
+/*
+ -----------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -----------------------------------------------------------------------------
+*/
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../../hash/ManifestVerifier.hpp"
+
+/* Command line program that checks files against sha256sum-style checksum
+   manifests, similar to "sha256sum --check", but with parallel hashing. */
+
+void showHelp()
+{
+  std::cout << "verify-manifest [OPTIONS] MANIFEST...\n"
+            << "\n"
+            << "Checks files against checksum manifests as created by sha1sum,\n"
+            << "sha224sum, sha256sum, sha384sum or sha512sum.\n"
+            << "\n"
+            << "options:\n"
+            << "  -d DIR, --directory DIR   resolve relative file names in DIR\n"
+            << "  -j N, --jobs N            read at most N files at the same time\n"
+            << "  --fail-fast               stop at the first file that does not match\n"
+            << "  -q, --quiet               do not print a line for matching files\n"
+            << "  -h, --help                show this help and exit\n";
+}
+
+int main(int argc, char** argv)
+{
+  libstriezel::hash::VerifyOptions options;
+  bool quiet = false;
+  std::vector<std::string> manifests;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string param(argv[i]);
+    if ((param == "--help") || (param == "-h"))
+    {
+      showHelp();
+      return 0;
+    }
+    else if ((param == "--directory") || (param == "-d"))
+    {
+      if (i + 1 >= argc)
+      {
+        std::cerr << "Error: " << param << " requires a directory.\n";
+        return 2;
+      }
+      options.baseDirectory = argv[++i];
+    }
+    else if ((param == "--jobs") || (param == "-j"))
+    {
+      int jobs = 0;
+      if (i + 1 < argc)
+        jobs = std::atoi(argv[++i]);
+      if (jobs <= 0)
+      {
+        std::cerr << "Error: " << param << " requires a positive number.\n";
+        return 2;
+      }
+      options.maxConcurrentFiles = static_cast<unsigned int>(jobs);
+    }
+    else if (param == "--fail-fast")
+      options.failFast = true;
+    else if ((param == "--quiet") || (param == "-q"))
+      quiet = true;
+    else if (!param.empty() && (param[0] == '-') && (param != "-"))
+    {
+      std::cerr << "Error: Unknown option " << param << ".\n";
+      return 2;
+    }
+    else
+      manifests.push_back(param);
+  }
+  if (manifests.empty())
+  {
+    std::cerr << "Error: No manifest was given.\n";
+    showHelp();
+    return 2;
+  }
+
+  bool allMatch = true;
+  for (const std::string& manifestFile : manifests)
+  {
+    libstriezel::hash::Manifest manifest;
+    if (!manifest.load((manifestFile == "-") ? "/dev/stdin" : manifestFile))
+    {
+      std::cerr << "Error: Could not read manifest " << manifestFile << ".\n";
+      allMatch = false;
+      continue;
+    }
+    if (manifest.invalidLines() > 0)
+    {
+      std::cerr << "Warning: " << manifest.invalidLines() << " line(s) of "
+                << manifestFile << " are improperly formatted.\n";
+    }
+    std::vector<libstriezel::hash::VerifyStatus> results;
+    allMatch = libstriezel::hash::verifyManifest(manifest, options, results) && allMatch;
+
+    std::size_t mismatches = 0;
+    std::size_t readErrors = 0;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      const std::string_view fileName = manifest.entries()[i].fileName;
+      switch (results[i])
+      {
+        case libstriezel::hash::VerifyStatus::Match:
+             if (!quiet)
+               std::cout << fileName << ": OK\n";
+             break;
+        case libstriezel::hash::VerifyStatus::Mismatch:
+             std::cout << fileName << ": FAILED\n";
+             ++mismatches;
+             break;
+        case libstriezel::hash::VerifyStatus::ReadError:
+             std::cout << fileName << ": FAILED open or read\n";
+             ++readErrors;
+             break;
+        case libstriezel::hash::VerifyStatus::Skipped:
+             break;
+      }//swi
+    }
+    if (mismatches > 0)
+      std::cerr << "Warning: " << mismatches << " computed checksum(s) did NOT match.\n";
+    if (readErrors > 0)
+      std::cerr << "Warning: " << readErrors << " listed file(s) could not be read.\n";
+    if (options.failFast && !allMatch)
+      break;
+  }
+  return allMatch ? 0 : 1;
+}
@@ -0,0 +1,229 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Compressor.hpp"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace libstriezel::zlib
+{
+
+// size of the buffer that is used for output functions
+const std::size_t cChunkSize = 65536;
+
+Compressor::Compressor(const int level)
+: m_Stream(),
+  m_Finished(false),
+  m_Failed(false),
+  m_TotalIn(0),
+  m_TotalOut(0),
+  m_Chunk()
+{
+  /* allocate deflate state */
+  m_Stream.zalloc = Z_NULL;
+  m_Stream.zfree = Z_NULL;
+  m_Stream.opaque = Z_NULL;
+  m_Stream.avail_in = 0;
+  m_Stream.next_in = Z_NULL;
+  const int z_return = deflateInit(&m_Stream, level);
+  switch (z_return)
+  {
+    case Z_OK:
+         break;
+    case Z_MEM_ERROR:
+         throw std::runtime_error("libstriezel::zlib::Compressor: Not enough memory to initialize z_stream!");
+    case Z_VERSION_ERROR:
+         throw std::runtime_error("libstriezel::zlib::Compressor: Incompatible library version!");
+    case Z_STREAM_ERROR:
+         throw std::runtime_error("libstriezel::zlib::Compressor: " + std::to_string(level) + " is not a valid compression level!");
+    default:
+         throw std::runtime_error("libstriezel::zlib::Compressor: Could not initialize z_stream!");
+  }
+}
+
+Compressor::~Compressor()
+{
+  (void) deflateEnd(&m_Stream);
+}
+
+int Compressor::run(const int flush, const uint8_t* input, const std::size_t inputLength, std::size_t& consumed,
+                    uint8_t* output, const std::size_t outputLength, std::size_t& produced)
+{
+  // zlib counts available bytes with 32 bit integers, so larger buffers are
+  // passed in several pieces
+  const std::size_t cMaxPiece = std::numeric_limits<uInt>::max();
+  consumed = 0;
+  produced = 0;
+  int z_return = Z_OK;
+  while ((produced < outputLength) && ((flush != Z_NO_FLUSH) || (consumed < inputLength)))
+  {
+    const std::size_t inPiece = std::min(inputLength - consumed, cMaxPiece);
+    const std::size_t outPiece = std::min(outputLength - produced, cMaxPiece);
+    m_Stream.next_in = const_cast<uint8_t*>(input) + consumed;
+    m_Stream.avail_in = static_cast<uInt>(inPiece);
+    m_Stream.next_out = output + produced;
+    m_Stream.avail_out = static_cast<uInt>(outPiece);
+    z_return = deflate(&m_Stream, flush);
+    const std::size_t usedIn = inPiece - m_Stream.avail_in;
+    const std::size_t usedOut = outPiece - m_Stream.avail_out;
+    consumed += usedIn;
+    produced += usedOut;
+    if ((z_return == Z_STREAM_END) || (z_return == Z_STREAM_ERROR))
+      break;
+    // Z_BUF_ERROR: no progress was possible, which is not fatal
+    if ((usedIn == 0) && (usedOut == 0))
+      break;
+  }
+  m_Stream.next_in = Z_NULL;
+  m_Stream.avail_in = 0;
+  m_TotalIn += consumed;
+  m_TotalOut += produced;
+  return z_return;
+}
+
+bool Compressor::compress(const void* input, const std::size_t inputLength, std::size_t& consumed,
+                          uint8_t* output, const std::size_t outputLength, std::size_t& produced)
+{
+  consumed = 0;
+  produced = 0;
+  if (m_Failed || m_Finished)
+  {
+    std::cerr << "zlib::Compressor::compress: Error: Stream is already "
+              << (m_Failed ? "broken" : "finished") << "!\n";
+    return false;
+  }
+  if (((input == nullptr) && (inputLength > 0)) || ((output == nullptr) && (outputLength > 0)))
+  {
+    std::cerr << "zlib::Compressor::compress: Error: Invalid buffer values given!\n";
+    return false;
+  }
+  const int z_return = run(Z_NO_FLUSH, static_cast<const uint8_t*>(input), inputLength, consumed,
+                           output, outputLength, produced);
+  if (z_return == Z_STREAM_ERROR)
+  {
+    m_Failed = true;
+    std::cerr << "zlib::Compressor::compress: Error while calling deflate()!\n";
+    return false;
+  }
+  return true;
+}
+
+bool Compressor::compress(const void* input, const std::size_t inputLength, const OutputFunction& output)
+{
+  if (m_Chunk.empty())
+    m_Chunk.resize(cChunkSize);
+  const uint8_t* data = static_cast<const uint8_t*>(input);
+  std::size_t remaining = inputLength;
+  do
+  {
+    std::size_t consumed = 0;
+    std::size_t produced = 0;
+    if (!compress(data, remaining, consumed, m_Chunk.data(), m_Chunk.size(), produced))
+      return false;
+    if ((produced > 0) && !output(m_Chunk.data(), produced))
+    {
+      m_Failed = true;
+      return false;
+    }
+    data += consumed;
+    remaining -= consumed;
+  } while (remaining > 0);
+  return true;
+}
+
+StreamStatus Compressor::finish(uint8_t* output, const std::size_t outputLength, std::size_t& produced)
+{
+  produced = 0;
+  if (m_Failed)
+  {
+    std::cerr << "zlib::Compressor::finish: Error: Stream is already broken!\n";
+    return StreamStatus::Error;
+  }
+  if ((output == nullptr) || (outputLength == 0))
+  {
+    std::cerr << "zlib::Compressor::finish: Error: Invalid buffer values given!\n";
+    return StreamStatus::Error;
+  }
+  m_Finished = true;
+  std::size_t consumed = 0;
+  const int z_return = run(Z_FINISH, nullptr, 0, consumed, output, outputLength, produced);
+  switch (z_return)
+  {
+    case Z_STREAM_END:
+         return StreamStatus::Finished;
+    case Z_OK: // not enough output buffer
+    case Z_BUF_ERROR:
+         return StreamStatus::Ok;
+    default:
+         m_Failed = true;
+         std::cerr << "zlib::Compressor::finish: Error while calling deflate() (code="
+                   << z_return << ")!\n";
+         return StreamStatus::Error;
+  }
+}
+
+bool Compressor::finish(const OutputFunction& output)
+{
+  if (m_Chunk.empty())
+    m_Chunk.resize(cChunkSize);
+  StreamStatus status = StreamStatus::Ok;
+  while (status == StreamStatus::Ok)
+  {
+    std::size_t produced = 0;
+    status = finish(m_Chunk.data(), m_Chunk.size(), produced);
+    if (status == StreamStatus::Error)
+      return false;
+    if ((produced > 0) && !output(m_Chunk.data(), produced))
+    {
+      m_Failed = true;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Compressor::reset()
+{
+  if (deflateReset(&m_Stream) != Z_OK)
+  {
+    m_Failed = true;
+    std::cerr << "zlib::Compressor::reset: Error: Could not reset z_stream!\n";
+    return false;
+  }
+  m_Finished = false;
+  m_Failed = false;
+  m_TotalIn = 0;
+  m_TotalOut = 0;
+  return true;
+}
+
+uint64_t Compressor::totalIn() const
+{
+  return m_TotalIn;
+}
+
+uint64_t Compressor::totalOut() const
+{
+  return m_TotalOut;
+}
+
+} // namespace
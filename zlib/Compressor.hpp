@@ -0,0 +1,158 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_ZLIB_COMPRESSOR_HPP
+#define LIBSTRIEZEL_ZLIB_COMPRESSOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <zlib.h>
+#include "StreamStatus.hpp"
+
+namespace libstriezel::zlib
+{
+
+/** \brief stateful zlib compression of data of arbitrary size
+ *
+ * Input can be passed in pieces of any size, so data of several gigabytes
+ * can be compressed in constant memory. The compressed data is either
+ * written to buffers of the caller or passed to an OutputFunction.
+ * The result has the same zlib format as the data created by compress().
+ */
+class Compressor
+{
+  public:
+    /** \brief constructor
+     *
+     * \param level  compression level, should be in [0;9], where 0 is no
+     *               compression and 9 is best compression
+     * \remarks Throws an exception, if the zlib stream cannot be initialized.
+     */
+    explicit Compressor(const int level = 6);
+
+
+    /** \brief destructor */
+    ~Compressor();
+
+
+    Compressor(const Compressor& other) = delete;
+    Compressor& operator=(const Compressor& other) = delete;
+
+
+    /** \brief compresses the next piece of input into the given buffer
+     *
+     * \param input         pointer to the uncompressed data
+     * \param inputLength   length of the uncompressed data in bytes
+     * \param consumed      receives the number of input bytes that were used
+     * \param output        buffer that receives the compressed data
+     * \param outputLength  size of the output buffer in bytes
+     * \param produced      receives the number of bytes written to output
+     * \return Returns true in case of success, or false if an error occurred.
+     * \remarks Input is consumed until all of it is used or until the output
+     *          buffer is full. In the latter case the function has to be
+     *          called again with the remaining input and a new buffer.
+     *          Compressed data may be held back until later calls, so
+     *          produced can be zero even if input was consumed.
+     */
+    bool compress(const void* input, const std::size_t inputLength, std::size_t& consumed,
+                  uint8_t* output, const std::size_t outputLength, std::size_t& produced);
+
+
+    /** \brief compresses the next piece of input
+     *
+     * \param input        pointer to the uncompressed data
+     * \param inputLength  length of the uncompressed data in bytes
+     * \param output       function that receives the compressed data
+     * \return Returns true, if all input was compressed.
+     *         Returns false, if an error occurred or output returned false.
+     */
+    bool compress(const void* input, const std::size_t inputLength, const OutputFunction& output);
+
+
+    /** \brief writes the remaining compressed data into the given buffer
+     *
+     * \param output        buffer that receives the compressed data
+     * \param outputLength  size of the output buffer in bytes
+     * \param produced      receives the number of bytes written to output
+     * \return Returns StreamStatus::Finished, if the compressed stream is
+     *         complete. Returns StreamStatus::Ok, if the output buffer is
+     *         full and finish() has to be called again. Returns
+     *         StreamStatus::Error, if an error occurred.
+     * \remarks No more input can be passed after finish() was called,
+     *          unless the compressor is reset.
+     */
+    StreamStatus finish(uint8_t* output, const std::size_t outputLength, std::size_t& produced);
+
+
+    /** \brief writes the remaining compressed data
+     *
+     * \param output  function that receives the compressed data
+     * \return Returns true, if the compressed stream is complete.
+     *         Returns false, if an error occurred or output returned false.
+     */
+    bool finish(const OutputFunction& output);
+
+
+    /** \brief resets the compressor to start a new stream with the same level
+     *
+     * \return Returns true in case of success, or false if an error occurred.
+     */
+    bool reset();
+
+
+    /** \brief gets the number of uncompressed bytes passed to the compressor
+     *
+     * \return Returns the number of input bytes since the last reset.
+     */
+    uint64_t totalIn() const;
+
+
+    /** \brief gets the number of compressed bytes created by the compressor
+     *
+     * \return Returns the number of output bytes since the last reset.
+     */
+    uint64_t totalOut() const;
+  private:
+    /** \brief calls deflate() with pieces that fit into the 32 bit counters of zlib
+     *
+     * \param flush         flush mode for deflate()
+     * \param input         pointer to the uncompressed data
+     * \param inputLength   length of the uncompressed data in bytes
+     * \param consumed      receives the number of input bytes that were used
+     * \param output        buffer that receives the compressed data
+     * \param outputLength  size of the output buffer in bytes
+     * \param produced      receives the number of bytes written to output
+     * \return Returns the last return code of deflate().
+     */
+    int run(const int flush, const uint8_t* input, const std::size_t inputLength, std::size_t& consumed,
+            uint8_t* output, const std::size_t outputLength, std::size_t& produced);
+
+    z_stream m_Stream;             /**< zlib stream state */
+    bool m_Finished;               /**< whether the stream has been finished */
+    bool m_Failed;                 /**< whether an error occurred */
+    uint64_t m_TotalIn;            /**< number of uncompressed bytes */
+    uint64_t m_TotalOut;           /**< number of compressed bytes */
+    std::vector<uint8_t> m_Chunk;  /**< buffer for output functions */
+}; //class
+
+} // namespace
+
+#endif // LIBSTRIEZEL_ZLIB_COMPRESSOR_HPP
@@ -0,0 +1,195 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Decompressor.hpp"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace libstriezel::zlib
+{
+
+// size of the buffer that is used for output functions
+const std::size_t cChunkSize = 65536;
+
+Decompressor::Decompressor()
+: m_Stream(),
+  m_Finished(false),
+  m_Failed(false),
+  m_TotalIn(0),
+  m_TotalOut(0),
+  m_Chunk()
+{
+  /* allocate inflate state */
+  m_Stream.zalloc = Z_NULL;
+  m_Stream.zfree = Z_NULL;
+  m_Stream.opaque = Z_NULL;
+  m_Stream.avail_in = 0;
+  m_Stream.next_in = Z_NULL;
+  const int z_return = inflateInit(&m_Stream);
+  switch (z_return)
+  {
+    case Z_OK:
+         break;
+    case Z_MEM_ERROR:
+         throw std::runtime_error("libstriezel::zlib::Decompressor: Not enough memory to initialize z_stream!");
+    case Z_VERSION_ERROR:
+         throw std::runtime_error("libstriezel::zlib::Decompressor: Incompatible library version!");
+    default:
+         throw std::runtime_error("libstriezel::zlib::Decompressor: Could not initialize z_stream!");
+  }
+}
+
+Decompressor::~Decompressor()
+{
+  (void) inflateEnd(&m_Stream);
+}
+
+StreamStatus Decompressor::decompress(const void* input, const std::size_t inputLength, std::size_t& consumed,
+                                      uint8_t* output, const std::size_t outputLength, std::size_t& produced)
+{
+  consumed = 0;
+  produced = 0;
+  if (m_Failed)
+  {
+    std::cerr << "zlib::Decompressor::decompress: Error: Stream is already broken!\n";
+    return StreamStatus::Error;
+  }
+  if (m_Finished)
+    return StreamStatus::Finished;
+  if (((input == nullptr) && (inputLength > 0)) || (output == nullptr) || (outputLength == 0))
+  {
+    std::cerr << "zlib::Decompressor::decompress: Error: Invalid buffer values given!\n";
+    return StreamStatus::Error;
+  }
+
+  // zlib counts available bytes with 32 bit integers, so larger buffers are
+  // passed in several pieces
+  const std::size_t cMaxPiece = std::numeric_limits<uInt>::max();
+  const uint8_t* data = static_cast<const uint8_t*>(input);
+  int z_return = Z_OK;
+  while (produced < outputLength)
+  {
+    const std::size_t inPiece = std::min(inputLength - consumed, cMaxPiece);
+    const std::size_t outPiece = std::min(outputLength - produced, cMaxPiece);
+    m_Stream.next_in = const_cast<uint8_t*>(data) + consumed;
+    m_Stream.avail_in = static_cast<uInt>(inPiece);
+    m_Stream.next_out = output + produced;
+    m_Stream.avail_out = static_cast<uInt>(outPiece);
+    z_return = inflate(&m_Stream, Z_NO_FLUSH);
+    const std::size_t usedIn = inPiece - m_Stream.avail_in;
+    const std::size_t usedOut = outPiece - m_Stream.avail_out;
+    consumed += usedIn;
+    produced += usedOut;
+    if ((z_return != Z_OK) && (z_return != Z_BUF_ERROR))
+      break;
+    // Z_BUF_ERROR: no progress was possible, i.e. more input is needed
+    if ((usedIn == 0) && (usedOut == 0))
+      break;
+  }
+  m_Stream.next_in = Z_NULL;
+  m_Stream.avail_in = 0;
+  m_TotalIn += consumed;
+  m_TotalOut += produced;
+
+  switch (z_return)
+  {
+    case Z_OK:
+    case Z_BUF_ERROR:
+         return StreamStatus::Ok;
+    case Z_STREAM_END:
+         m_Finished = true;
+         return StreamStatus::Finished;
+    case Z_NEED_DICT:
+    case Z_DATA_ERROR:
+         m_Failed = true;
+         std::cerr << "zlib::Decompressor::decompress: Error: Compressed data is invalid";
+         if (m_Stream.msg != nullptr)
+           std::cerr << " (" << m_Stream.msg << ")";
+         std::cerr << "!\n";
+         return StreamStatus::Error;
+    default:
+         m_Failed = true;
+         std::cerr << "zlib::Decompressor::decompress: Error while calling inflate() (code="
+                   << z_return << ")!\n";
+         return StreamStatus::Error;
+  }
+}
+
+StreamStatus Decompressor::decompress(const void* input, const std::size_t inputLength, const OutputFunction& output)
+{
+  if (m_Chunk.empty())
+    m_Chunk.resize(cChunkSize);
+  const uint8_t* data = static_cast<const uint8_t*>(input);
+  std::size_t remaining = inputLength;
+  while (true)
+  {
+    std::size_t consumed = 0;
+    std::size_t produced = 0;
+    const StreamStatus status = decompress(data, remaining, consumed, m_Chunk.data(), m_Chunk.size(), produced);
+    if (status == StreamStatus::Error)
+      return status;
+    if ((produced > 0) && !output(m_Chunk.data(), produced))
+    {
+      m_Failed = true;
+      return StreamStatus::Error;
+    }
+    data += consumed;
+    remaining -= consumed;
+    if (status == StreamStatus::Finished)
+      return status;
+    // A full chunk may mean that inflate() holds back more output.
+    if (((remaining == 0) && (produced < m_Chunk.size())) || ((consumed == 0) && (produced == 0)))
+      return StreamStatus::Ok;
+  }
+}
+
+bool Decompressor::finished() const
+{
+  return m_Finished;
+}
+
+bool Decompressor::reset()
+{
+  if (inflateReset(&m_Stream) != Z_OK)
+  {
+    m_Failed = true;
+    std::cerr << "zlib::Decompressor::reset: Error: Could not reset z_stream!\n";
+    return false;
+  }
+  m_Finished = false;
+  m_Failed = false;
+  m_TotalIn = 0;
+  m_TotalOut = 0;
+  return true;
+}
+
+uint64_t Decompressor::totalIn() const
+{
+  return m_TotalIn;
+}
+
+uint64_t Decompressor::totalOut() const
+{
+  return m_TotalOut;
+}
+
+} // namespace
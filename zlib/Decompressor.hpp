@@ -0,0 +1,132 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_ZLIB_DECOMPRESSOR_HPP
+#define LIBSTRIEZEL_ZLIB_DECOMPRESSOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <zlib.h>
+#include "StreamStatus.hpp"
+
+namespace libstriezel::zlib
+{
+
+/** \brief stateful zlib decompression of data of arbitrary size
+ *
+ * Compressed input can be passed in pieces of any size and the size of the
+ * decompressed data does not have to be known in advance. The decompressed
+ * data is either written to buffers of the caller or passed to an
+ * OutputFunction, so large streams can be decompressed in constant memory.
+ */
+class Decompressor
+{
+  public:
+    /** \brief constructor
+     *
+     * \remarks Throws an exception, if the zlib stream cannot be initialized.
+     */
+    Decompressor();
+
+
+    /** \brief destructor */
+    ~Decompressor();
+
+
+    Decompressor(const Decompressor& other) = delete;
+    Decompressor& operator=(const Decompressor& other) = delete;
+
+
+    /** \brief decompresses the next piece of input into the given buffer
+     *
+     * \param input         pointer to the compressed data
+     * \param inputLength   length of the compressed data in bytes
+     * \param consumed      receives the number of input bytes that were used
+     * \param output        buffer that receives the decompressed data
+     * \param outputLength  size of the output buffer in bytes
+     * \param produced      receives the number of bytes written to output
+     * \return Returns StreamStatus::Finished, if the end of the compressed
+     *         stream was reached. Data after the end is not consumed.
+     *         Returns StreamStatus::Ok, if more input is needed or if the
+     *         output buffer is full. In the latter case the function has to
+     *         be called again with the remaining input and a new buffer.
+     *         Returns StreamStatus::Error, if the data is corrupt or an
+     *         error occurred.
+     */
+    StreamStatus decompress(const void* input, const std::size_t inputLength, std::size_t& consumed,
+                            uint8_t* output, const std::size_t outputLength, std::size_t& produced);
+
+
+    /** \brief decompresses the next piece of input
+     *
+     * \param input        pointer to the compressed data
+     * \param inputLength  length of the compressed data in bytes
+     * \param output       function that receives the decompressed data
+     * \return Returns StreamStatus::Finished, if the end of the compressed
+     *         stream was reached. Data after the end is ignored, totalIn()
+     *         tells where the stream ended. Returns StreamStatus::Ok, if all
+     *         input was used and more input is needed. Returns
+     *         StreamStatus::Error, if the data is corrupt, an error occurred
+     *         or output returned false.
+     */
+    StreamStatus decompress(const void* input, const std::size_t inputLength, const OutputFunction& output);
+
+
+    /** \brief checks whether the end of the compressed stream was reached
+     *
+     * \return Returns true, if the stream is complete.
+     * \remarks If all input has been passed and this is still false, then
+     *          the compressed data is truncated.
+     */
+    bool finished() const;
+
+
+    /** \brief resets the decompressor to start with a new stream
+     *
+     * \return Returns true in case of success, or false if an error occurred.
+     */
+    bool reset();
+
+
+    /** \brief gets the number of compressed bytes used by the decompressor
+     *
+     * \return Returns the number of input bytes since the last reset.
+     */
+    uint64_t totalIn() const;
+
+
+    /** \brief gets the number of decompressed bytes
+     *
+     * \return Returns the number of output bytes since the last reset.
+     */
+    uint64_t totalOut() const;
+  private:
+    z_stream m_Stream;             /**< zlib stream state */
+    bool m_Finished;               /**< whether the end of the stream was reached */
+    bool m_Failed;                 /**< whether an error occurred */
+    uint64_t m_TotalIn;            /**< number of compressed bytes */
+    uint64_t m_TotalOut;           /**< number of decompressed bytes */
+    std::vector<uint8_t> m_Chunk;  /**< buffer for output functions */
+}; //class
+
+} // namespace
+
+#endif // LIBSTRIEZEL_ZLIB_DECOMPRESSOR_HPP
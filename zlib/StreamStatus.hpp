@@ -0,0 +1,50 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of striezel's common code library.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef LIBSTRIEZEL_ZLIB_STREAMSTATUS_HPP
+#define LIBSTRIEZEL_ZLIB_STREAMSTATUS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace libstriezel::zlib
+{
+
+/** \brief result of an operation of a compression or decompression stream */
+enum class StreamStatus
+{
+  Ok,       /**< operation succeeded, the stream expects more data or calls */
+  Finished, /**< the end of the compressed stream has been reached */
+  Error     /**< an error occurred, the stream cannot be used any more */
+};
+
+
+/** \brief function that receives the output of a stream
+ *
+ * The function gets a pointer to the next piece of output data and its
+ * length in bytes. The data is only valid during the call. The function
+ * returns true, if the data was handled, or false to abort the operation.
+ */
+typedef std::function<bool(const uint8_t* data, const std::size_t length)> OutputFunction;
+
+} // namespace
+
+#endif // LIBSTRIEZEL_ZLIB_STREAMSTATUS_HPP